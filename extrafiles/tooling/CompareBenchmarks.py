@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""
+Compares two JSON result files of the networkit_benchmarks target, e.g. of the
+last release (baseline) and of the current build (contender):
+
+	networkit_benchmarks --benchmark_out=contender.json --benchmark_out_format=json \
+		--benchmark_repetitions=5
+
+If the files contain repetitions, the medians are compared; otherwise the mean
+of all runs of a benchmark. The tool prints the relative change of each
+benchmark and returns a non-zero exit code if any benchmark is slower than the
+baseline by more than the threshold.
+"""
+import argparse
+import json
+import re
+import sys
+
+UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+def loadResults(path, metric):
+	with open(path) as f:
+		data = json.load(f)
+
+	medians = {}
+	runs = {}
+	for bench in data.get("benchmarks", []):
+		if bench.get("error_occurred"):
+			continue
+		value = bench[metric] * UNIT_TO_NS[bench.get("time_unit", "ns")]
+		name = bench.get("run_name", bench["name"])
+		if bench.get("run_type") == "aggregate":
+			if bench.get("aggregate_name") == "median":
+				medians[name] = value
+		else:
+			runs.setdefault(name, []).append(value)
+
+	results = {name: sum(values) / len(values) for name, values in runs.items()}
+	results.update(medians)
+	return data.get("context", {}), results
+
+def formatTime(ns):
+	for unit in ["ns", "us", "ms"]:
+		if ns < 1e3:
+			return "{:.1f} {}".format(ns, unit)
+		ns /= 1e3
+	return "{:.2f} s".format(ns)
+
+def main():
+	parser = argparse.ArgumentParser(description = "Compare two google-benchmark JSON files.")
+	parser.add_argument("baseline", help = "JSON output of the reference version")
+	parser.add_argument("contender", help = "JSON output of the version under test")
+	parser.add_argument("-t", "--threshold", type = float, default = 0.1,
+		help = "relative slowdown that counts as regression (default: 0.1)")
+	parser.add_argument("-m", "--metric", choices = ["real_time", "cpu_time"], default = "real_time",
+		help = "time to compare (default: real_time)")
+	parser.add_argument("-f", "--filter", default = ".*",
+		help = "only compare benchmarks whose name matches this regular expression")
+	args = parser.parse_args()
+
+	baseContext, base = loadResults(args.baseline, args.metric)
+	newContext, new = loadResults(args.contender, args.metric)
+
+	for key in ["num_cpus", "mhz_per_cpu", "networkit_threads", "library_build_type"]:
+		if baseContext.get(key) != newContext.get(key):
+			print("Warning: {} differs: {} vs. {}".format(key, baseContext.get(key), newContext.get(key)))
+	if newContext.get("library_build_type") == "debug":
+		print("Warning: the contender was built in debug mode")
+
+	nameFilter = re.compile(args.filter)
+	names = sorted(name for name in set(base) | set(new) if nameFilter.search(name))
+	if not names:
+		print("No benchmarks to compare.")
+		return 1
+
+	width = max(len(name) for name in names)
+	print("{:<{w}}  {:>12}  {:>12}  {:>8}".format("Benchmark", "Baseline", "Contender", "Change", w = width))
+	regressions = []
+	for name in names:
+		if name not in base or name not in new:
+			status = "only in baseline" if name in base else "only in contender"
+			print("{:<{w}}  {}".format(name, status, w = width))
+			continue
+		change = new[name] / base[name] - 1.0 if base[name] > 0 else 0.0
+		mark = ""
+		if change > args.threshold:
+			mark = "  REGRESSION"
+			regressions.append(name)
+		elif change < -args.threshold:
+			mark = "  improved"
+		print("{:<{w}}  {:>12}  {:>12}  {:>+7.1f}%{}".format(
+			name, formatTime(base[name]), formatTime(new[name]), 100 * change, mark, w = width))
+
+	if regressions:
+		print("\n{} of {} benchmarks are more than {:.0f}% slower than the baseline.".format(
+			len(regressions), len(names), 100 * args.threshold))
+		return 1
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -8,10 +8,18 @@
 #ifndef NETWORKIT_ALGEBRAIC_GRAPH_BLAS_HPP_
 #define NETWORKIT_ALGEBRAIC_GRAPH_BLAS_HPP_
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <omp.h>
+
 #include <networkit/algebraic/AlgebraicGlobals.hpp>
 #include <networkit/algebraic/Semirings.hpp>
 #include <networkit/algebraic/SparseAccumulator.hpp>
+#include <networkit/algebraic/SparseVector.hpp>
 #include <networkit/algebraic/Vector.hpp>
 
 /**
@@ -20,6 +28,180 @@
  */
 namespace GraphBLAS {
 
+// ****************************************************
+// 					Masks and options
+// ****************************************************
+
+/**
+ * Structural mask of a vector operation: entry i of the result is only computed if
+ * entries[i] != complement. A default constructed mask allows all entries.
+ */
+struct VectorMask {
+    const std::vector<bool> *entries = nullptr;
+    bool complement = false;
+
+    bool allows(NetworKit::index i) const {
+        return entries == nullptr || (*entries)[i] != complement;
+    }
+};
+
+/**
+ * Traversal direction of MxSpV.
+ */
+enum class SpMSpVDirection {
+    //! PUSH if it visits fewer than nnz(A) / pushPullRatio matrix entries, otherwise PULL.
+    AUTO,
+    //! Scatters the columns of the matrix that belong to the nonzeros of the vector.
+    PUSH,
+    //! Computes each unmasked entry as the product of a row of the matrix with the vector.
+    PULL
+};
+
+//! Work ratio between PULL and PUSH above which MxSpV pushes in the AUTO mode.
+constexpr NetworKit::count pushPullRatio = 16;
+
+//! Minimum number of matrix entries visited by a PUSH of MxSpV for which it runs in parallel.
+constexpr NetworKit::count parallelPushWork = 1 << 14;
+
+//! Rows of a matrix product with fewer than numberOfColumns / hashAccumulatorRatio
+//! multiplications are accumulated in a HashAccumulator instead of a SparseAccumulator.
+constexpr NetworKit::count hashAccumulatorRatio = 16;
+
+/**
+ * Reusable buffers of MxSpV for matrices with the given numbers of rows and columns. A sequence
+ * of products that share a workspace, e.g., the iterations of a traversal, does not allocate or
+ * fill dense arrays in each call; a product only resets the entries it touched.
+ */
+struct SpMSpVWorkspace {
+    SpMSpVWorkspace(NetworKit::count numberOfRows, NetworKit::count numberOfColumns)
+        : xDense(numberOfColumns), inX(numberOfColumns, 0), yDense(numberOfRows),
+          inY(numberOfRows, 0), accumulators(omp_get_max_threads()) {}
+
+    NetworKit::count numberOfRows() const noexcept { return yDense.size(); }
+    NetworKit::count numberOfColumns() const noexcept { return xDense.size(); }
+
+    // The buffers are only used by MxSpV; all flags are unset between two products.
+
+    // dense copy of the vector for PULL
+    std::vector<double> xDense;
+    std::vector<uint8_t> inX;
+    // dense result with the list of its stored positions
+    std::vector<double> yDense;
+    std::vector<uint8_t> inY;
+    std::vector<NetworKit::index> touched;
+    // per-thread accumulators for PUSH, created by the thread that uses them
+    std::vector<std::unique_ptr<NetworKit::SparseAccumulator>> accumulators;
+};
+
+namespace Impl {
+
+/*
+ * Gustavson's row-by-row product A * B, restricted to the nonzero positions of *mask if mask is
+ * not null. A symbolic phase counts the nonzeros of each row of the result, so the numeric phase
+ * can write all rows in parallel to their final positions. Rows with few multiplications are
+ * accumulated in a hash table, all others in a dense SparseAccumulator.
+ */
+template <class SemiRing, class Matrix>
+Matrix multiply(const Matrix &A, const Matrix &B, const Matrix *mask) {
+    using NetworKit::count;
+    using NetworKit::index;
+    using NetworKit::omp_index;
+    const count nRows = A.numberOfRows();
+    const count nCols = B.numberOfColumns();
+
+    // upper bound of the number of nonzeros of each row of the result
+    std::vector<count> bound(nRows);
+#pragma omp parallel for schedule(dynamic, 256)
+    for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+        count flops = 0;
+        A.forNonZeroElementsInRow(i, [&](index k, double) { flops += B.nnzInRow(k); });
+        bound[i] = mask ? std::min(flops, mask->nnzInRow(i)) : flops;
+    }
+
+    std::vector<index> rowIdx(nRows + 1, 0);
+    std::vector<index> columnIdx;
+    std::vector<double> nonZeros;
+
+    auto multiplyRows = [&](const bool numeric) {
+#pragma omp parallel
+        {
+            std::unique_ptr<NetworKit::SparseAccumulator> spa;
+            NetworKit::HashAccumulator hash;
+            // allowed[j] == i iff the mask contains (i, j)
+            std::vector<index> allowed(mask ? nCols : 0, NetworKit::none);
+            auto keepFirst = [](double a, double) { return a; };
+
+            auto scatterRow = [&](const index i, auto &accumulator) {
+                A.forNonZeroElementsInRow(i, [&](index k, double a) {
+                    B.forNonZeroElementsInRow(k, [&](index j, double b) {
+                        if (mask && allowed[j] != i)
+                            return;
+                        if (numeric)
+                            accumulator.scatter(SemiRing::mult(a, b), j, *SemiRing::add);
+                        else
+                            accumulator.scatter(0.0, j, keepFirst);
+                    });
+                });
+            };
+
+#pragma omp for schedule(dynamic, 64)
+            for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+                if (bound[i] == 0)
+                    continue;
+                if (mask)
+                    mask->forNonZeroElementsInRow(i, [&](index j, double) { allowed[j] = i; });
+
+                index pos = numeric ? rowIdx[i] : 0;
+                auto store = [&](index j, double value) {
+                    columnIdx[pos] = j;
+                    nonZeros[pos] = value;
+                    ++pos;
+                };
+
+                if (bound[i] * hashAccumulatorRatio < nCols) {
+                    hash.reset(bound[i]);
+                    scatterRow(i, hash);
+                    if (numeric)
+                        hash.gather(store);
+                    else
+                        rowIdx[i + 1] = hash.size();
+                    hash.clear();
+                } else {
+                    if (!spa)
+                        spa = std::make_unique<NetworKit::SparseAccumulator>(nCols);
+                    scatterRow(i, *spa);
+                    if (numeric)
+                        spa->gather([&](index, index j, double value) { store(j, value); });
+                    else
+                        rowIdx[i + 1] = spa->size();
+                    spa->increaseRow();
+                }
+            }
+        }
+    };
+
+    multiplyRows(false);
+    for (index i = 0; i < nRows; ++i)
+        rowIdx[i + 1] += rowIdx[i];
+    columnIdx.resize(rowIdx[nRows]);
+    nonZeros.resize(rowIdx[nRows]);
+    multiplyRows(true);
+
+    if constexpr (std::is_constructible_v<Matrix, count, count, std::vector<index>,
+                                          std::vector<index>, std::vector<double>, double, bool>) {
+        return Matrix(nRows, nCols, rowIdx, columnIdx, nonZeros, A.getZero(), true);
+    } else {
+        std::vector<NetworKit::Triplet> triplets(nonZeros.size());
+#pragma omp parallel for schedule(dynamic, 256)
+        for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i)
+            for (index k = rowIdx[i]; k < rowIdx[i + 1]; ++k)
+                triplets[k] = {static_cast<index>(i), columnIdx[k], nonZeros[k]};
+        return Matrix(nRows, nCols, triplets, A.getZero());
+    }
+}
+
+} // namespace Impl
+
 // ****************************************************
 // 						Operations
 // ****************************************************
@@ -92,7 +274,8 @@ Matrix eWiseBinOp(const Matrix &A, const Matrix &B, L binOp) {
 /**
  * Computes the matrix-matrix multiplication of @a A and @a B. Note that
  * A.numberOfColumns() must be equal to B.numberOfRows() and the zero elements
- * must be the same. The default Semiring is the ArithmeticSemiring.
+ * must be the same. The rows are computed in parallel by Gustavson's algorithm in a symbolic and
+ * a numeric phase. The default Semiring is the ArithmeticSemiring.
  * @param A
  * @param B
  * @return The result of the multiplication A * B.
@@ -102,23 +285,7 @@ Matrix MxM(const Matrix &A, const Matrix &B) {
     assert(A.numberOfColumns() == B.numberOfRows());
     assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
 
-    std::vector<NetworKit::Triplet> triplets;
-    NetworKit::SparseAccumulator spa(B.numberOfRows());
-    for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-        A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-            B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-                spa.scatter(SemiRing::mult(w1, w2), j, *SemiRing::add);
-            });
-        });
-
-        spa.gather([&](NetworKit::index i, NetworKit::index j, double value) {
-            triplets.push_back({i, j, value});
-        });
-
-        spa.increaseRow();
-    }
-
-    return Matrix(A.numberOfRows(), B.numberOfColumns(), triplets, A.getZero());
+    return Impl::multiply<SemiRing, Matrix>(A, B, nullptr);
 }
 
 /**
@@ -136,24 +303,7 @@ void MxM(const Matrix &A, const Matrix &B, Matrix &C) {
     assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero()
            && C.getZero() == SemiRing::zero());
 
-    std::vector<NetworKit::Triplet> triplets;
-    NetworKit::SparseAccumulator spa(B.numberOfRows());
-    for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-        A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-            B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-                spa.scatter(SemiRing::mult(w1, w2), j, *SemiRing::add);
-            });
-        });
-
-        spa.gather([&](NetworKit::index i, NetworKit::index j, double value) {
-            triplets.push_back({i, j, value});
-        });
-
-        spa.increaseRow();
-    }
-
-    Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
-    C = eWiseBinOp<SemiRing, Matrix>(C, temp, *SemiRing::add);
+    C = eWiseBinOp<SemiRing, Matrix>(C, MxM<SemiRing>(A, B), *SemiRing::add);
 }
 
 /**
@@ -172,24 +322,168 @@ void MxM(const Matrix &A, const Matrix &B, Matrix &C, F accum) {
     assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero()
            && C.getZero() == SemiRing::zero());
 
-    std::vector<NetworKit::Triplet> triplets;
-    NetworKit::SparseAccumulator spa(B.numberOfRows());
-    for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-        A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-            B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-                spa.scatter(SemiRing::mult(w1, w2), j, *SemiRing::add);
-            });
-        });
+    C = eWiseBinOp<SemiRing, Matrix>(C, MxM<SemiRing>(A, B), accum);
+}
+
+/**
+ * Computes the entries of the matrix-matrix multiplication of @a A and @a B at the nonzero
+ * positions of the mask @a M, e.g., (A*A)(i,j) for the edges (i,j) of a graph. Positions of @a M
+ * to which no product contributes are not stored. The default Semiring is the
+ * ArithmeticSemiring.
+ * @param A
+ * @param B
+ * @param M
+ * @return The masked result of the multiplication A * B.
+ */
+template <class SemiRing = ArithmeticSemiring, class Matrix>
+Matrix maskedMxM(const Matrix &A, const Matrix &B, const Matrix &M) {
+    assert(A.numberOfColumns() == B.numberOfRows());
+    assert(M.numberOfRows() == A.numberOfRows() && M.numberOfColumns() == B.numberOfColumns());
+    assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
 
-        spa.gather([&](NetworKit::index i, NetworKit::index j, double value) {
-            triplets.push_back({i, j, value});
+    return Impl::multiply<SemiRing, Matrix>(A, B, &M);
+}
+
+/**
+ * Computes the product y = A * x of the matrix @a A and the sparse vector @a x. Only the entries
+ * of y allowed by @a mask are computed; entries to which no nonzero of @a x contributes are not
+ * stored. PUSH scatters the rows of the transpose @a At that belong to the nonzeros of @a x, so
+ * its work is proportional to their number of nonzeros; large pushes are split over per-thread
+ * accumulators. PULL computes every unmasked entry of y from a row of @a A in parallel. The
+ * buffers of @a workspace are reused, so repeated products do not allocate dense arrays. The
+ * default Semiring is the ArithmeticSemiring.
+ * @param A
+ * @param At The transpose of @a A.
+ * @param x
+ * @param workspace Buffers for the dimensions of @a A.
+ * @param mask
+ * @param direction
+ * @return The sparse result vector, sorted by position.
+ */
+template <class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::SparseVector MxSpV(const Matrix &A, const Matrix &At, const NetworKit::SparseVector &x,
+                              SpMSpVWorkspace &workspace, VectorMask mask = {},
+                              SpMSpVDirection direction = SpMSpVDirection::AUTO) {
+    using NetworKit::count;
+    using NetworKit::index;
+    using NetworKit::omp_index;
+    assert(A.numberOfColumns() == x.getDimension());
+    assert(At.numberOfRows() == A.numberOfColumns() && At.numberOfColumns() == A.numberOfRows());
+    assert(A.getZero() == SemiRing::zero() && x.getZero() == SemiRing::zero());
+    assert(workspace.numberOfRows() == A.numberOfRows()
+           && workspace.numberOfColumns() == A.numberOfColumns());
+
+    auto &ws = workspace;
+    const count nRows = A.numberOfRows();
+    NetworKit::SparseVector y(nRows, SemiRing::zero());
+
+    count pushWork = 0;
+    x.forNonZeroElements([&](index j, double) { pushWork += At.nnzInRow(j); });
+    if (direction == SpMSpVDirection::AUTO)
+        direction = pushWork * pushPullRatio < A.nnz() ? SpMSpVDirection::PUSH
+                                                       : SpMSpVDirection::PULL;
+
+    if (direction == SpMSpVDirection::PUSH) {
+        if (ws.accumulators.size() < static_cast<count>(omp_get_max_threads()))
+            ws.accumulators.resize(omp_get_max_threads());
+#pragma omp parallel if (pushWork >= parallelPushWork)
+        {
+            auto &spa = ws.accumulators[omp_get_thread_num()];
+            if (!spa)
+                spa = std::make_unique<NetworKit::SparseAccumulator>(nRows);
+#pragma omp for schedule(static)
+            for (omp_index k = 0; k < static_cast<omp_index>(x.nnz()); ++k) {
+                const double xj = x.valueAt(k);
+                At.forNonZeroElementsInRow(x.positionAt(k), [&](index i, double value) {
+                    if (mask.allows(i))
+                        spa->scatter(SemiRing::mult(value, xj), i, *SemiRing::add);
+                });
+            }
+        }
+
+        count usedAccumulators = 0;
+        for (const auto &spa : ws.accumulators)
+            usedAccumulators += spa && spa->size() > 0;
+
+        for (auto &spa : ws.accumulators) {
+            if (!spa || spa->size() == 0)
+                continue;
+            if (usedAccumulators == 1) {
+                spa->gather([&](index, index i, double value) { y.insert(i, value); });
+            } else {
+                // combine the partial results in the order of the threads
+                spa->gather([&](index, index i, double value) {
+                    if (ws.inY[i]) {
+                        ws.yDense[i] = SemiRing::add(ws.yDense[i], value);
+                    } else {
+                        ws.inY[i] = 1;
+                        ws.yDense[i] = value;
+                        ws.touched.push_back(i);
+                    }
+                });
+            }
+            spa->increaseRow();
+        }
+
+        std::sort(ws.touched.begin(), ws.touched.end());
+        for (const index i : ws.touched) {
+            y.insert(i, ws.yDense[i]);
+            ws.inY[i] = 0;
+        }
+        ws.touched.clear();
+        return y;
+    }
+
+    x.forNonZeroElements([&](index j, double xj) {
+        ws.xDense[j] = xj;
+        ws.inX[j] = 1;
+    });
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+        if (!mask.allows(i))
+            continue;
+        double yi = SemiRing::zero();
+        bool stored = false;
+        A.forNonZeroElementsInRow(i, [&](index j, double value) {
+            if (!ws.inX[j])
+                return;
+            const double product = SemiRing::mult(value, ws.xDense[j]);
+            yi = stored ? SemiRing::add(yi, product) : product;
+            stored = true;
         });
+        if (stored) {
+            ws.yDense[i] = yi;
+            ws.inY[i] = 1;
+        }
+    }
 
-        spa.increaseRow();
+    for (index i = 0; i < nRows; ++i) {
+        if (ws.inY[i]) {
+            y.insert(i, ws.yDense[i]);
+            ws.inY[i] = 0;
+        }
     }
+    x.forNonZeroElements([&](index j, double) { ws.inX[j] = 0; });
+    return y;
+}
 
-    Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
-    C = eWiseBinOp<SemiRing, Matrix>(C, temp, accum);
+/**
+ * Computes the product y = A * x of the matrix @a A and the sparse vector @a x like the overload
+ * with a workspace, but allocates the buffers for this product only.
+ * @param A
+ * @param At The transpose of @a A.
+ * @param x
+ * @param mask
+ * @param direction
+ * @return The sparse result vector, sorted by position.
+ */
+template <class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::SparseVector MxSpV(const Matrix &A, const Matrix &At, const NetworKit::SparseVector &x,
+                              VectorMask mask = {},
+                              SpMSpVDirection direction = SpMSpVDirection::AUTO) {
+    SpMSpVWorkspace workspace(A.numberOfRows(), A.numberOfColumns());
+    return MxSpV<SemiRing>(A, At, x, workspace, mask, direction);
 }
 
 /**
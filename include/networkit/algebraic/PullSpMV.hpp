@@ -0,0 +1,96 @@
+/*
+ * PullSpMV.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_ALGEBRAIC_PULL_SPMV_HPP_
+#define NETWORKIT_ALGEBRAIC_PULL_SPMV_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * Precision of the matrix entries and of the input vector of a PullSpMV.
+ */
+enum class SpMVPrecision : char {
+    DOUBLE = 0,
+    SINGLE = 1,
+};
+
+/**
+ * @ingroup algebraic
+ * Snapshot of the adjacency matrix of a graph for repeated pull-based sparse matrix-vector
+ * products y = A x, where y[u] is the weighted sum of x over the in-neighbors of u (or, if
+ * requested, over the out-neighbors of u). This is the kernel of iterative centralities such as
+ * PageRank, KatzCentrality and EigenvectorCentrality.
+ *
+ * The columns are split into segments of segmentSize consecutive node ids. The edges are stored
+ * segment by segment, such that one product streams the edge array once while the random reads
+ * of x are confined to one segment at a time, which is small enough to stay in cache. Within a
+ * segment, column indices are stored as 32-bit offsets relative to the segment start and the
+ * neighbors of each row are sorted, so the inner loop is a vectorizable gather. For unweighted
+ * graphs, no weights are stored at all.
+ *
+ * The matrix entries and x are stored with type T (float or double); the products are always
+ * accumulated and returned in double precision. Using float halves the memory traffic of the
+ * edge weights and of the gathered values at the price of a relative error of about 1e-7 per
+ * entry of x.
+ */
+template <typename T>
+class PullSpMV final {
+public:
+    //! Default number of columns per segment.
+    static constexpr count defaultSegmentSize = count{1} << 20;
+
+    /**
+     * Creates the snapshot of @a G in parallel. Does not keep a reference to @a G.
+     *
+     * @param G The graph, a Graph or a CSRGraph.
+     * @param outNeighbors If true, y[u] sums over the out-neighbors instead of the in-neighbors
+     * of u. For undirected graphs, both are the same.
+     * @param segmentSize Number of columns per segment; must be a power of two, at most 2^32.
+     */
+    template <class GraphType>
+    PullSpMV(const GraphType &G, bool outNeighbors = false,
+             count segmentSize = defaultSegmentSize);
+
+    /**
+     * @return The number of rows and columns, i.e., the upper node id bound of the graph.
+     */
+    count numberOfRows() const noexcept { return n; }
+
+    /**
+     * @return The number of column segments.
+     */
+    count numberOfSegments() const noexcept { return segmentBegin.size() - 1; }
+
+    /**
+     * Computes y = A x. @a y is resized to numberOfRows(); rows without entries are set to zero.
+     *
+     * @param x Input vector with numberOfRows() entries.
+     * @param y Output vector.
+     */
+    void multiply(const std::vector<T> &x, std::vector<double> &y) const;
+
+private:
+    count n;
+    unsigned segmentShift;
+
+    // Rows of segment s are the entries [segmentBegin[s], segmentBegin[s + 1]) of rowIds; the
+    // edges of the k-th row entry are [rowBegin[k], rowBegin[k + 1]) of columns and weights.
+    std::vector<index> segmentBegin;
+    std::vector<node> rowIds;
+    std::vector<index> rowBegin;
+    std::vector<uint32_t> columns;
+    std::vector<T> weights; // empty if the graph is unweighted
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_ALGEBRAIC_PULL_SPMV_HPP_
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 #include <networkit/Globals.hpp>
@@ -97,6 +98,11 @@ public:
         return nonZeros;
     }
 
+    /**
+     * @return The number of positions with a valid value in the current row.
+     */
+    count size() const noexcept { return indices.size(); }
+
     /**
      * Sets the SparseAccumulator to the next row which invalidates all currently stored data.
      */
@@ -106,6 +112,110 @@ public:
     }
 };
 
+/**
+ * Hash-based counterpart of the SparseAccumulator for rows with few values. The values are stored
+ * in an open-addressing table whose capacity is proportional to the number of distinct positions
+ * of the current row instead of the dimension, so it stays in cache and is cheap to reset.
+ */
+class HashAccumulator final {
+private:
+    static constexpr index empty = none;
+
+    /** positions stored in the table, empty for free slots */
+    std::vector<index> keys;
+
+    /** values of the stored positions */
+    std::vector<double> values;
+
+    /** occupied slots of the current row */
+    std::vector<index> slots;
+
+    /** capacity of the current row minus one; the capacity is a power of two */
+    index capacityMask = 0;
+
+    /** number of bits dropped by the hash function */
+    unsigned shift = 63;
+
+    index slotOf(index pos) const {
+        // Fibonacci hashing, the upper bits of the product are the best mixed
+        return static_cast<index>((static_cast<uint64_t>(pos) * UINT64_C(0x9E3779B97F4A7C15))
+                                  >> shift);
+    }
+
+public:
+    /**
+     * Prepares the accumulator for a row with at most @a maxSize distinct positions. Must be
+     * called before the first value of a row is scattered.
+     */
+    void reset(count maxSize) {
+        clear();
+        count capacity = 16;
+        unsigned bits = 4;
+        while (capacity < 2 * maxSize) {
+            capacity <<= 1;
+            ++bits;
+        }
+        if (keys.size() < capacity) {
+            keys.assign(capacity, empty);
+            values.resize(capacity);
+        }
+        capacityMask = capacity - 1;
+        shift = 64 - bits;
+    }
+
+    /**
+     * Stores @a value at @a pos. If a value is already stored at @a pos then we call the binary
+     * handle function with the stored value and the new @a value as arguments.
+     * @param value The value to store or add at @a pos.
+     * @param pos The position.
+     * @param handle (double, double) -> double
+     */
+    template <typename L>
+    void scatter(double value, index pos, L &handle) {
+        assert(slots.size() <= capacityMask);
+        for (index slot = slotOf(pos);; slot = (slot + 1) & capacityMask) {
+            if (keys[slot] == pos) {
+                values[slot] = handle(values[slot], value);
+                return;
+            }
+            if (keys[slot] == empty) {
+                keys[slot] = pos;
+                values[slot] = value;
+                slots.push_back(slot);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Calls handle(index pos, double value) for the stored values of the current row by
+     * increasing position.
+     * @return The number of stored values.
+     */
+    template <typename L>
+    count gather(L handle) {
+        std::sort(slots.begin(), slots.end(),
+                  [&](index a, index b) { return keys[a] < keys[b]; });
+        for (index slot : slots)
+            handle(keys[slot], values[slot]);
+        return slots.size();
+    }
+
+    /**
+     * @return The number of distinct positions of the current row.
+     */
+    count size() const noexcept { return slots.size(); }
+
+    /**
+     * Removes all values of the current row.
+     */
+    void clear() {
+        for (index slot : slots)
+            keys[slot] = empty;
+        slots.clear();
+    }
+};
+
 } /* namespace NetworKit */
 
 #endif // NETWORKIT_ALGEBRAIC_SPARSE_ACCUMULATOR_HPP_
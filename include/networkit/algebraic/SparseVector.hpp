@@ -0,0 +1,143 @@
+/*
+ * SparseVector.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_ALGEBRAIC_SPARSE_VECTOR_HPP_
+#define NETWORKIT_ALGEBRAIC_SPARSE_VECTOR_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/algebraic/Vector.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup algebraic
+ * A column vector that only stores its nonzero entries as (index, value) pairs. All other entries
+ * are equal to the zero element of the vector. It is used as the sparse operand of
+ * GraphBLAS::MxSpV, e.g., for the frontier of a traversal.
+ */
+class SparseVector final {
+public:
+    /** Constructs an empty vector of dimension 0. */
+    SparseVector() = default;
+
+    /**
+     * Constructs a vector of dimension @a dimension without nonzero entries.
+     * @param dimension
+     * @param zero The zero element (default is 0).
+     */
+    SparseVector(count dimension, double zero = 0.0) : dimension(dimension), zero(zero) {}
+
+    /**
+     * @return The dimension of the vector.
+     */
+    count getDimension() const noexcept { return dimension; }
+
+    /**
+     * @return The zero element of the vector.
+     */
+    double getZero() const noexcept { return zero; }
+
+    /**
+     * @return The number of stored entries.
+     */
+    count nnz() const noexcept { return indices.size(); }
+
+    /**
+     * Appends the entry @a value at position @a i. The position must not be stored yet.
+     */
+    void insert(index i, double value) {
+        assert(i < dimension);
+        if (!indices.empty() && indices.back() > i)
+            isSorted = false;
+        indices.push_back(i);
+        values.push_back(value);
+    }
+
+    /**
+     * Removes all entries, the dimension is kept.
+     */
+    void clear() {
+        indices.clear();
+        values.clear();
+        isSorted = true;
+    }
+
+    /**
+     * @return True if the entries are sorted by position.
+     */
+    bool sorted() const noexcept { return isSorted; }
+
+    /**
+     * Sorts the entries by position.
+     */
+    void sort() {
+        if (isSorted)
+            return;
+        std::vector<index> permutation(indices.size());
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::sort(permutation.begin(), permutation.end(),
+                  [&](index a, index b) { return indices[a] < indices[b]; });
+        std::vector<index> sortedIndices(indices.size());
+        std::vector<double> sortedValues(values.size());
+        for (index k = 0; k < permutation.size(); ++k) {
+            sortedIndices[k] = indices[permutation[k]];
+            sortedValues[k] = values[permutation[k]];
+        }
+        indices = std::move(sortedIndices);
+        values = std::move(sortedValues);
+        isSorted = true;
+    }
+
+    /**
+     * @return The position of the @a k-th stored entry in the order of insertion.
+     */
+    index positionAt(index k) const {
+        assert(k < indices.size());
+        return indices[k];
+    }
+
+    /**
+     * @return The value of the @a k-th stored entry in the order of insertion.
+     */
+    double valueAt(index k) const {
+        assert(k < values.size());
+        return values[k];
+    }
+
+    /**
+     * Calls handle(index i, double value) for all stored entries in the order of insertion.
+     */
+    template <typename L>
+    void forNonZeroElements(L handle) const {
+        for (index k = 0; k < indices.size(); ++k)
+            handle(indices[k], values[k]);
+    }
+
+    /**
+     * @return The dense representation of this vector.
+     */
+    Vector toVector() const {
+        Vector result(dimension, zero);
+        forNonZeroElements([&](index i, double value) { result[i] = value; });
+        return result;
+    }
+
+private:
+    count dimension = 0;
+    double zero = 0.0;
+    bool isSorted = true;
+    std::vector<index> indices;
+    std::vector<double> values;
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_ALGEBRAIC_SPARSE_VECTOR_HPP_
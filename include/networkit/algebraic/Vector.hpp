@@ -12,6 +12,7 @@
 #include <cmath>
 #include <numeric>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <networkit/Globals.hpp>
@@ -154,6 +155,30 @@ public:
      */
     static double innerProduct(const Vector &v1, const Vector &v2);
 
+    /**
+     * Computes the inner product of @a v1 and @a v2 and the squared length of @a v1 in a single
+     * pass over the vectors.
+     * @return The pair (<v1, v2>, <v1, v1>).
+     */
+    static std::pair<double, double> innerProductAndSquaredLength(const Vector &v1,
+                                                                  const Vector &v2);
+
+    /**
+     * Computes the Euclidean distance of @a v1 and @a v2, i.e. the length of v1 - v2, without
+     * creating the difference vector.
+     */
+    static double distance(const Vector &v1, const Vector &v2);
+
+    /**
+     * Computes result = alpha * A * x + beta * result row by row, without temporary vectors. If
+     * the dimension of @a result does not match the number of rows of @a A, @a result is replaced
+     * by a zero vector of the right dimension first. For beta = 0, the old values of @a result are
+     * not read.
+     */
+    template <class Matrix>
+    static void matrixVectorProduct(const Matrix &A, const Vector &x, Vector &result,
+                                    double alpha = 1.0, double beta = 0.0);
+
     /**
      * Computes the inner product (dot product) of this vector and @a other.
      * @return The result of the inner product.
@@ -242,6 +267,29 @@ public:
      */
     Vector &operator-=(double value);
 
+    /**
+     * Adds @a alpha times @a x to this vector (y = alpha * x + y).
+     * Note that the dimensions of the vectors have to be the same.
+     * @return Reference to this vector.
+     */
+    Vector &axpy(double alpha, const Vector &x);
+
+    /**
+     * Replaces this vector by @a alpha times @a x plus @a beta times this vector
+     * (y = alpha * x + beta * y).
+     * Note that the dimensions of the vectors have to be the same.
+     * @return Reference to this vector.
+     */
+    Vector &axpby(double alpha, const Vector &x, double beta);
+
+    /**
+     * Exchanges the values of this vector and @a other without copying them.
+     */
+    void swap(Vector &other) noexcept {
+        values.swap(other.values);
+        std::swap(transposed, other.transposed);
+    }
+
     /**
      * Applies the unary function @a unaryElementFunction to each value in the Vector. Note that it
      * must hold that the function applied to the zero element of this matrix returns the zero
@@ -316,6 +364,22 @@ Vector Vector::operator*(const Matrix &matrix) const {
     return result;
 }
 
+template <class Matrix>
+void Vector::matrixVectorProduct(const Matrix &A, const Vector &x, Vector &result, double alpha,
+                                 double beta) {
+    assert(!x.isTransposed());
+    assert(A.numberOfColumns() == x.getDimension());
+    if (result.getDimension() != A.numberOfRows())
+        result = Vector(A.numberOfRows());
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(A.numberOfRows()); ++i) {
+        double sum = 0.0;
+        A.forNonZeroElementsInRow(i, [&](index j, double value) { sum += value * x[j]; });
+        result[i] = beta == 0.0 ? alpha * sum : alpha * sum + beta * result[i];
+    }
+}
+
 template <typename F>
 void Vector::apply(F unaryElementFunction) {
 #pragma omp parallel for
@@ -9,6 +9,7 @@
 #define NETWORKIT_ALGEBRAIC_ALGORITHMS_ALGEBRAIC_BFS_HPP_
 
 #include <networkit/algebraic/GraphBLAS.hpp>
+#include <networkit/algebraic/SparseVector.hpp>
 #include <networkit/algebraic/Vector.hpp>
 #include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
@@ -17,7 +18,10 @@ namespace NetworKit {
 
 /**
  * @ingroup algebraic
- * Implementation of Breadth-First-Search using the GraphBLAS interface.
+ * Implementation of Breadth-First-Search using the GraphBLAS interface. In each step, the
+ * frontier of newly reached nodes is multiplied with the adjacency matrix over the min-plus
+ * semiring (GraphBLAS::MxSpV). For unweighted graphs, the product is masked by the nodes that
+ * have not been reached yet; for weighted graphs, nodes whose distance improves are revisited.
  */
 template <class Matrix>
 class AlgebraicBFS : public Algorithm {
@@ -29,7 +33,8 @@ public:
      * @param source
      */
     AlgebraicBFS(const Graph &graph, node source)
-        : At(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero()).transpose()), source(source) {}
+        : A(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero())), At(A.transpose()),
+          source(source), weighted(graph.isWeighted()) {}
 
     /**
      * Runs a bfs using the GraphBLAS interface from the source node.
@@ -47,8 +52,9 @@ public:
     }
 
 private:
-    Matrix At;
+    Matrix A, At;
     node source;
+    bool weighted;
     Vector distances;
 };
 
@@ -58,11 +64,27 @@ void AlgebraicBFS<Matrix>::run() {
     distances = Vector(n, std::numeric_limits<double>::infinity());
     distances[source] = 0;
 
-    Vector oldDist;
-    do {
-        oldDist = distances;
-        GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-    } while (oldDist != distances);
+    // with unit weights, the first distance of a node is final
+    std::vector<bool> reached(n, false);
+    reached[source] = true;
+    const GraphBLAS::VectorMask unreached{weighted ? nullptr : &reached, true};
+
+    GraphBLAS::SpMSpVWorkspace workspace(At.numberOfRows(), At.numberOfColumns());
+    SparseVector frontier(n, MinPlusSemiring::zero());
+    frontier.insert(source, 0);
+    while (frontier.nnz() > 0) {
+        // the distances are pulled along the rows of At, i.e., the in-edges of each node
+        const SparseVector next =
+            GraphBLAS::MxSpV<MinPlusSemiring>(At, A, frontier, workspace, unreached);
+        frontier.clear();
+        next.forNonZeroElements([&](index v, double distance) {
+            if (distance < distances[v]) {
+                distances[v] = distance;
+                reached[v] = true;
+                frontier.insert(v, distance);
+            }
+        });
+    }
 
     hasRun = true;
 }
@@ -11,6 +11,7 @@
 #include <cassert>
 
 #include <networkit/algebraic/GraphBLAS.hpp>
+#include <networkit/algebraic/SparseVector.hpp>
 #include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 
@@ -18,7 +19,9 @@ namespace NetworKit {
 
 /**
  * @ingroup algebraic
- * Implementation of the Bellman-Ford algorithm using the GraphBLAS interface.
+ * Implementation of the Bellman-Ford algorithm using the GraphBLAS interface. Each round only
+ * relaxes the out-edges of the nodes whose distance improved in the previous round, by
+ * multiplying them as a sparse vector with the adjacency matrix (GraphBLAS::MxSpV).
  */
 template <class Matrix>
 class AlgebraicBellmanFord : public Algorithm {
@@ -30,8 +33,8 @@ public:
      * @param source
      */
     AlgebraicBellmanFord(const Graph &graph, node source)
-        : At(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero()).transpose()), source(source),
-          negCycle(false) {}
+        : A(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero())), At(A.transpose()),
+          source(source), negCycle(false) {}
 
     /** Default destructor */
     ~AlgebraicBellmanFord() = default;
@@ -61,7 +64,7 @@ public:
     }
 
 private:
-    const Matrix At;
+    const Matrix A, At;
     node source;
     Vector distances;
     bool negCycle;
@@ -72,14 +75,26 @@ void AlgebraicBellmanFord<Matrix>::run() {
     count n = At.numberOfRows();
     distances = Vector(n, std::numeric_limits<double>::infinity());
     distances[source] = 0;
+    negCycle = false;
 
-    for (index k = 1; k < n; ++k) {
-        GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
+    GraphBLAS::SpMSpVWorkspace workspace(At.numberOfRows(), At.numberOfColumns());
+    SparseVector frontier(n, MinPlusSemiring::zero());
+    frontier.insert(source, 0);
+
+    // Without negative cycles, all distances are final after n - 1 rounds. Otherwise, some
+    // distance still improves in round n.
+    for (index round = 1; round <= n && frontier.nnz() > 0; ++round) {
+        const SparseVector next = GraphBLAS::MxSpV<MinPlusSemiring>(At, A, frontier, workspace);
+        frontier.clear();
+        next.forNonZeroElements([&](index v, double distance) {
+            if (distance < distances[v]) {
+                distances[v] = distance;
+                frontier.insert(v, distance);
+            }
+        });
+        negCycle = round == n && frontier.nnz() > 0;
     }
 
-    Vector oldDist = distances;
-    GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-    negCycle = (oldDist != distances);
     hasRun = true;
 }
 
@@ -92,13 +92,14 @@ void AlgebraicPageRank<Matrix>::run() {
     count n = M.numberOfRows();
     double teleportProb = (1.0 - damp) / (double)n;
     Vector rank(n, 1.0 / (double)n);
-    Vector lastRank;
+    Vector lastRank(n);
 
+    // rank = M * lastRank + teleportProb, the two vectors are swapped instead of copied
     do {
-        lastRank = rank;
-        rank = M * rank;
-        rank.apply([&](double value) { return value += teleportProb; });
-    } while ((rank - lastRank).length() > tol);
+        rank.swap(lastRank);
+        rank.fill(teleportProb);
+        GraphBLAS::MxV(M, lastRank, rank);
+    } while (Vector::distance(rank, lastRank) > tol);
 
     double sum = 0.0;
 #pragma omp parallel for reduction(+ : sum)
@@ -8,13 +8,17 @@
 #ifndef NETWORKIT_ALGEBRAIC_ALGORITHMS_ALGEBRAIC_TRIANGLE_COUNTING_HPP_
 #define NETWORKIT_ALGEBRAIC_ALGORITHMS_ALGEBRAIC_TRIANGLE_COUNTING_HPP_
 
+#include <networkit/algebraic/GraphBLAS.hpp>
 #include <networkit/base/Algorithm.hpp>
 
 namespace NetworKit {
 
 /**
  * @ingroup algebraic
- * Implements a triangle counting algorithm for nodes based on algebraic methods.
+ * Implements a triangle counting algorithm for nodes based on algebraic methods. The number of
+ * triangles of node i is given by the diagonal entry (A^3)(i,i) = sum_j (A^2)(i,j) * A(j,i). Thus,
+ * only the entries of A^2 at the nonzero positions of the transpose of A are computed
+ * (GraphBLAS::maskedMxM).
  */
 template <class Matrix>
 class AlgebraicTriangleCounting : public Algorithm {
@@ -58,14 +62,16 @@ private:
 
 template <class Matrix>
 void AlgebraicTriangleCounting<Matrix>::run() {
-    Matrix powA = A * A * A;
+    const Matrix At = directed ? A.transpose() : A;
+    const Matrix closedWalks = GraphBLAS::eWiseMult(GraphBLAS::maskedMxM(A, A, At), At);
+    const Vector diagonal = GraphBLAS::rowReduce(closedWalks);
 
     nodeScores.clear();
     nodeScores.resize(A.numberOfRows(), 0);
 
 #pragma omp parallel for
-    for (omp_index i = 0; i < static_cast<omp_index>(powA.numberOfRows()); ++i) {
-        nodeScores[i] = directed ? powA(i, i) : powA(i, i) / 2.0;
+    for (omp_index i = 0; i < static_cast<omp_index>(A.numberOfRows()); ++i) {
+        nodeScores[i] = directed ? diagonal[i] : diagonal[i] / 2.0;
     }
 
     hasRun = true;
@@ -40,6 +40,13 @@ uint64_t getSeed();
  */
 std::mt19937_64 &getURNG();
 
+/**
+ * @returns an URNG for the sub-stream @a stream of @a seed. The sequence only depends on both
+ * values, so work that is split into numbered chunks with one stream each is reproducible
+ * independent of the number of threads.
+ */
+std::mt19937_64 streamURNG(uint64_t seed, uint64_t stream);
+
 /**
  * @returns an integer distributed uniformly in an inclusive range;
  * @param upperBound the upper bound, default = UNINT64_T_MAX
@@ -40,6 +40,67 @@ public:
      * nodes (=a star)
      */
     double maximum() override;
+
+    /**
+     * Sets the number of sources that are processed together on unweighted graphs (default: the
+     * largest batch size whose buffers fit into the memory budget, at most maxBatchSize). The
+     * shortest path DAGs of a batch are computed by one bit-parallel BFS in which all threads
+     * cooperate, so the memory is at most 24 + 40 * batchSize bytes per node, independent of the
+     * number of threads; on graphs of small diameter, it is closer to 24 + 16 * batchSize. A
+     * batch size of 0 runs one BFS per thread instead, which needs considerably more memory per
+     * thread. Weighted graphs always use one Dijkstra per thread.
+     *
+     * @param batchSize The number of sources per batch, at most maxBatchSize, or none to choose
+     * it from the memory budget again.
+     */
+    void setBatchSize(count batchSize);
+
+    /**
+     * @return The number of sources that are processed together on unweighted graphs.
+     */
+    count getBatchSize() const noexcept;
+
+    /**
+     * Sets the number of bytes that the buffers of run() should not exceed (default:
+     * defaultMemoryBudget). Unless a batch size is set, the largest batch whose buffers fit into
+     * the budget is used, but at least one source. If one BFS or Dijkstra runs per thread, fewer
+     * threads are used if their buffers would exceed the budget, but at least one.
+     *
+     * @param bytes The memory budget in bytes.
+     */
+    void setMemoryBudget(count bytes) { memoryBudget = bytes; }
+
+    //! Maximum number of sources per batch, one per bit of a machine word.
+    static constexpr count maxBatchSize = 64;
+
+    //! Default memory budget of run(), 1 GiB.
+    static constexpr count defaultMemoryBudget = count{1} << 30;
+
+    /**
+     * @return The largest batch size (at least 1, at most maxBatchSize) whose buffers fit into
+     * @a memoryBudget bytes for a graph with @a upperNodeIdBound node ids.
+     */
+    static count batchSizeFor(count upperNodeIdBound, count memoryBudget) noexcept;
+
+    /**
+     * Adds the unnormalized betweenness of the nodes of the unweighted graph @a G to @a scores
+     * and, unless @a edgeScores is null, the one of its edges to @a edgeScores; run() calls this
+     * on the graph passed in the constructor for batch sizes other than 0. @a GraphType is Graph
+     * or CSRGraph.
+     *
+     * @param k The number of sources per batch, in [1, maxBatchSize].
+     * @param scores Vector with upperNodeIdBound() entries.
+     * @param edgeScores Null or vector with upperEdgeIdBound() entries.
+     */
+    template <class GraphType>
+    static void computeBatched(const GraphType &G, count k, std::vector<double> &scores,
+                               std::vector<double> *edgeScores);
+
+private:
+    count batchSize = none; // none: chosen from the memory budget
+    count memoryBudget = defaultMemoryBudget;
+
+    void runPerThread();
 };
 
 } /* namespace NetworKit */
@@ -0,0 +1,137 @@
+/*
+ * DynCoreDecomposition.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
+#define NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <networkit/auxiliary/HashUtils.hpp>
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/centrality/Centrality.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Maintains the core numbers of an unweighted graph under edge insertions and removals. Like
+ * ParallelCoreDecomposition, self-loops are ignored and directed graphs are treated as undirected.
+ * The graph must not contain multi-edges.
+ *
+ * The updates follow the order-based approach of Zhang et al. (ICDE 2017): a peeling order of the
+ * nodes (the k-order) is maintained together with the number of neighbors of each node that come
+ * later in this order, which never exceeds its core number.
+ * - An edge insertion increases the core numbers by at most one. Only nodes that come after the
+ *   earlier endpoint in the order and are adjacent to a node whose core number may increase are
+ *   visited, in the order. The promoted nodes move to the front of the next higher core.
+ * - An edge removal decreases the core numbers by at most one. Starting from the endpoints, nodes
+ *   are demoted while they have fewer neighbors of at least their core number than their core
+ *   number; they move to the end of the next lower core.
+ * The order is kept in a linked list with integer labels that are redistributed locally when two
+ * adjacent labels run out of space.
+ *
+ * A batch is applied edge by edge: first the removals, then the insertions. Until an edge has
+ * been processed, the graph is seen as it was before the batch. The events are expected after
+ * the graph has been modified.
+ */
+class DynCoreDecomposition final : public Centrality, public DynAlgorithm {
+
+public:
+    /**
+     * @param G The graph.
+     */
+    DynCoreDecomposition(const Graph &G);
+
+    /**
+     * Computes the core numbers and the k-order from scratch.
+     */
+    void run() override;
+
+    /**
+     * Updates the core numbers after an edge insertion or removal, or a node addition, removal or
+     * restoration. Weight events are ignored. If a node with incident edges has been removed
+     * without the removal events of its edges, the core numbers are recomputed from scratch.
+     */
+    void update(GraphEvent event) override;
+
+    /**
+     * Updates the core numbers after a batch of events, see update().
+     */
+    void updateBatch(const std::vector<GraphEvent> &batch) override;
+
+    /**
+     * @return The core number of node @a u.
+     */
+    count coreNumber(node u) const {
+        assureFinished();
+        return core[u];
+    }
+
+    /**
+     * @return The maximum core number.
+     */
+    count maxCoreNumber() const;
+
+    /**
+     * @return The number of nodes visited by the last update, which bounds its running time
+     * together with their degrees.
+     */
+    count numberOfVisitedNodes() const {
+        assureFinished();
+        return visited;
+    }
+
+private:
+    std::vector<count> core;
+    // number of nodes per core number
+    std::vector<count> coreSize;
+    // number of neighbors that come later in the k-order
+    std::vector<count> laterDegree;
+    count visited = 0;
+
+    // The k-order is a linked list of nodes and one sentinel per core number, which precedes the
+    // nodes of this core number. Sentinel k is stored as item k | sentinelFlag.
+    std::vector<uint64_t> nodeLabel, sentinelLabel;
+    std::vector<uint64_t> nodeNext, nodePrev, sentinelNext, sentinelPrev;
+    uint64_t tail = none;
+
+    // Scratch space of the updates; all entries are reset after an update.
+    std::vector<count> scratch;
+    std::vector<uint8_t> state;
+    std::vector<node> touched;
+
+    // Edges of the current batch that have not been processed yet: inserted edges are skipped,
+    // removed edges are added to the adjacency of the graph.
+    std::unordered_set<std::pair<node, node>, Aux::PairHash> pending;
+    std::unordered_map<node, std::vector<node>> removedOut, removedIn;
+
+    void setCore(node u, count k);
+    void addNodes();
+    void insertEdge(node u, node v);
+    void removeEdge(node u, node v);
+    void resetScratch();
+
+    template <typename Handle>
+    void forIncidentNodes(node u, Handle handle) const;
+
+    bool precedes(node u, node v) const { return nodeLabel[u] < nodeLabel[v]; }
+    uint64_t &label(uint64_t item);
+    uint64_t &next(uint64_t item);
+    uint64_t &prev(uint64_t item);
+    uint64_t sentinel(count k);
+    void unlink(uint64_t item);
+    void insertAfter(uint64_t anchor, uint64_t item);
+    void relabelAfter(uint64_t anchor);
+    void relabelAll();
+};
+
+} /* namespace NetworKit */
+#endif // NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
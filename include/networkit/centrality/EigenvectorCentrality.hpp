@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_CENTRALITY_EIGENVECTOR_CENTRALITY_HPP_
 #define NETWORKIT_CENTRALITY_EIGENVECTOR_CENTRALITY_HPP_
 
+#include <networkit/algebraic/PullSpMV.hpp>
 #include <networkit/centrality/Centrality.hpp>
 
 namespace NetworKit {
@@ -20,6 +21,9 @@ namespace NetworKit {
 class EigenvectorCentrality final : public Centrality {
     const double tol; // error tolerance
 
+    template <typename T>
+    void runWithPrecision();
+
 public:
     /**
      * Constructs an EigenvectorCentrality object for the given Graph @a G. @a tol defines the
@@ -35,6 +39,10 @@ public:
      * Computes eigenvector centrality on the graph passed in constructor.
      */
     void run() override;
+
+    // Precision of the edge weights and scores in the matrix-vector products. With SINGLE, the
+    // tolerance is raised to the rounding error of the vector length in float.
+    SpMVPrecision precision = SpMVPrecision::DOUBLE;
 };
 
 } /* namespace NetworKit */
@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_CENTRALITY_KATZ_CENTRALITY_HPP_
 #define NETWORKIT_CENTRALITY_KATZ_CENTRALITY_HPP_
 
+#include <networkit/algebraic/PullSpMV.hpp>
 #include <networkit/centrality/Centrality.hpp>
 
 namespace NetworKit {
@@ -29,6 +30,9 @@ enum EdgeDirection : char {
 class KatzCentrality : public Centrality {
     std::vector<double> values;
 
+    template <typename T>
+    void runWithPrecision();
+
 protected:
     const double alpha; // damping
     const double beta;  // constant centrality amount
@@ -56,6 +60,10 @@ public:
 
     // Whether to count in-edges or out-edges
     EdgeDirection edgeDirection = EdgeDirection::IN_EDGES;
+
+    // Precision of the edge weights and scores in the matrix-vector products. With SINGLE, the
+    // tolerance is raised to the rounding error of the vector length in float.
+    SpMVPrecision precision = SpMVPrecision::DOUBLE;
 };
 
 } /* namespace NetworKit */
@@ -12,6 +12,7 @@
 #include <limits>
 #include <memory>
 
+#include <networkit/algebraic/PullSpMV.hpp>
 #include <networkit/centrality/Centrality.hpp>
 
 namespace NetworKit {
@@ -34,6 +35,9 @@ namespace NetworKit {
  * NOTE: There is an inconsistency in the definition in Newman's book (Ch. 7) regarding
  * directed graphs; we follow the verbal description, which requires to sum over the incoming
  * edges (as opposed to outgoing ones).
+ *
+ * Each iteration is a pull-based sparse matrix-vector product on a PullSpMV snapshot of the
+ * graph, which is taken at the beginning of run().
  */
 class PageRank final : public Centrality {
 
@@ -87,6 +91,24 @@ public:
     // Norm used as stopping criterion
     Norm norm = Norm::L2_NORM;
 
+    // Precision of the edge weights and scores in the matrix-vector products. With SINGLE, the
+    // tolerance is raised to the rounding error of the scores in float.
+    SpMVPrecision precision = SpMVPrecision::DOUBLE;
+
+    /**
+     * Computes the PageRank scores of @a G with the given parameters; run() calls this on the
+     * graph passed in the constructor. @a GraphType is Graph or CSRGraph and @a T (float or
+     * double) is the precision of the matrix-vector products.
+     *
+     * @param[in,out] scores The start vector with upperNodeIdBound() entries, which is replaced by
+     * the scores.
+     * @return The number of iterations.
+     */
+    template <typename T, class GraphType>
+    static count computeScores(const GraphType &G, double damp, double tol, bool normalized,
+                               SinkHandling distributeSinks, Norm norm, count maxIterations,
+                               std::vector<double> &scores);
+
 private:
     double damp;
     double tol;
@@ -94,6 +116,9 @@ private:
     bool normalized;
     SinkHandling distributeSinks;
     std::atomic<double> max;
+
+    template <typename T>
+    void runWithPrecision();
 };
 
 } /* namespace NetworKit */
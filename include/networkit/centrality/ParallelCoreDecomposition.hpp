@@ -0,0 +1,145 @@
+/*
+ * ParallelCoreDecomposition.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_PARALLEL_CORE_DECOMPOSITION_HPP_
+#define NETWORKIT_CENTRALITY_PARALLEL_CORE_DECOMPOSITION_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <networkit/centrality/Centrality.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Parallel k-core decomposition. The core number of a node u is the largest k such that u is
+ * part of a subgraph in which every node has degree at least k. If edge weights are used, the
+ * degree is replaced by the weighted degree, which yields the s-cores of the graph (Eidsaa and
+ * Almaas, 2013); the scores are then real numbers.
+ *
+ * Unlike CoreDecomposition, graphs with self-loops are supported; self-loops are ignored.
+ * Directed graphs are treated as undirected, i.e., the degree of a node is the sum of its in-
+ * and out-degree. Two algorithms are available:
+ *
+ * - PEELING (default): bucket-synchronous peeling in the style of Julienne (Dhulipala et al.,
+ *   SPAA 2017). In each round, all remaining nodes with the smallest (weighted) degree are
+ *   removed in parallel and the degrees of their neighbors are decreased atomically; only nodes
+ *   whose degree changed are moved to a new bucket. Unweighted degrees are kept in an array of
+ *   buckets, weighted degrees in a lazy heap.
+ * - H_INDEX: starting from the degrees, each node repeatedly replaces its value by the
+ *   (weighted) h-index of the values of its neighbors, which converges to the core numbers (Lü et
+ *   al., Nature Communications 2016). All nodes whose neighborhood changed are updated in
+ *   parallel per iteration. With a bounded number of iterations, the scores are upper bounds of
+ *   the core numbers that are often exact for most nodes.
+ */
+class ParallelCoreDecomposition final : public Centrality {
+
+public:
+    enum class Mode : uint8_t {
+        //! Exact bucket-synchronous peeling (default).
+        PEELING,
+        //! Iterative h-index refinement; exact if it converges within maxIterations.
+        H_INDEX
+    };
+
+    /**
+     * Hierarchy of the connected components of the cores. Component c is a connected component
+     * of the level[c]-core; its parent is the smallest component of a lower core that contains
+     * it, or none. A component is only created at the levels at which it contains nodes with
+     * this core number, so the hierarchy has at most as many components as the graph has nodes.
+     */
+    struct CoreHierarchy {
+        //! Core level of each component.
+        std::vector<double> level;
+        //! Parent of each component, none for the components of the lowest core of each
+        //! connected component of the graph.
+        std::vector<index> parent;
+        //! Maps each node to the component that contains it at the level of its own core
+        //! number (its shell).
+        Partition shells;
+    };
+
+    /**
+     * @param G The graph.
+     * @param useEdgeWeights If true and @a G is weighted, the s-cores are computed. Edge weights
+     * must not be negative.
+     */
+    ParallelCoreDecomposition(const Graph &G, bool useEdgeWeights = false);
+
+    /**
+     * Sets the algorithm, see Mode.
+     */
+    void setMode(Mode mode) { this->mode = mode; }
+
+    /**
+     * Computes the core numbers.
+     */
+    void run() override;
+
+    /**
+     * @return The number of peeling rounds or h-index iterations of the last run.
+     */
+    count numberOfIterations() const {
+        assureFinished();
+        return iterations;
+    }
+
+    /**
+     * @return True if the h-index iteration converged, i.e., the scores are the exact core
+     * numbers. Always true for PEELING.
+     */
+    bool hasConverged() const {
+        assureFinished();
+        return converged;
+    }
+
+    /**
+     * @return The maximum core number.
+     */
+    double maxCoreNumber() const {
+        assureFinished();
+        return maxCore;
+    }
+
+    /**
+     * @return Partition of the nodes into shells, i.e., nodes with the same core number are in
+     * the same subset. For the unweighted decomposition, the subset ids are the core numbers;
+     * for s-cores, they are the ranks of the distinct core values.
+     */
+    Partition getPartition() const;
+
+    /**
+     * Computes the hierarchy of the connected components of the cores in O(m log n) time.
+     */
+    CoreHierarchy getCoreHierarchy() const;
+
+    /**
+     * @return The maximum (weighted) degree of the graph, which bounds the core numbers.
+     */
+    double maximum() override;
+
+    //! Maximum number of iterations of the H_INDEX mode.
+    count maxIterations = none;
+
+private:
+    const bool weighted;
+    Mode mode = Mode::PEELING;
+    count iterations = 0;
+    bool converged = false;
+    double maxCore = 0;
+
+    template <typename Key>
+    void runPeeling();
+
+    template <typename Key>
+    void runHIndex();
+};
+
+} /* namespace NetworKit */
+#endif // NETWORKIT_CENTRALITY_PARALLEL_CORE_DECOMPOSITION_HPP_
@@ -24,6 +24,12 @@ namespace NetworKit {
  * The running time in practice depends on the structure of the graph. In
  * particular for complex networks it is usually quite fast, even graphs with
  * millions of edges can usually be processed in less than a minute.
+ *
+ * The nodes of the degeneracy order are distributed dynamically among the threads, starting
+ * with the nodes of highest core number. Subproblems with at most a few thousand candidate and
+ * excluded nodes are solved on a bit matrix where the pivot is chosen using word-wise
+ * intersections; large ones of them are split into OpenMP tasks, one per branch, that are
+ * picked up by idle threads. The order in which cliques are found is not deterministic.
  */
 class MaximalCliques final : public Algorithm {
 
@@ -48,10 +54,17 @@ public:
      * Note that the reference is to an internal object, the callback should not assume that
      * this reference is still valid after it returned.
      *
+     * By default, the callback is never called concurrently: each thread buffers a bounded
+     * number of cliques and hands them to the callback while holding a lock. If
+     * @a concurrentCallback is set, the callback is called directly by the thread that found
+     * the clique and thus has to be thread-safe.
+     *
      * @param G The graph to list cliques for
      * @param callback The callback to call for each clique.
+     * @param concurrentCallback If the callback may be called from several threads at once.
      */
-    MaximalCliques(const Graph &G, std::function<void(const std::vector<node> &)> callback);
+    MaximalCliques(const Graph &G, std::function<void(const std::vector<node> &)> callback,
+                   bool concurrentCallback = false);
 
     /**
      * Execute the maximal clique listing algorithm.
@@ -76,6 +89,7 @@ private:
 
     std::function<void(const std::vector<node> &)> callback;
     bool maximumOnly;
+    bool concurrentCallback = false;
 };
 
 } // namespace NetworKit
@@ -22,14 +22,29 @@ namespace NetworKit {
  * that the maximum number of its neighbors have. The procedure is stopped when every vertex
  * has the label that at least half of its neighbors have.
  *
+ * Only the nodes in the neighborhood of a node that changed its label in the previous iteration
+ * are processed again; the label weights of a node's neighborhood are accumulated in a dense
+ * array per thread. Ties are broken in favor of the current label, then of the smallest label.
  */
 class PLP final : public CommunityDetectionAlgorithm {
 
+public:
+    enum class Mode : uint8_t {
+        //! Labels are updated in place, so nodes see the labels already updated in the same
+        //! iteration (default).
+        ASYNCHRONOUS,
+        //! The nodes are processed in the color classes of a greedy coloring; the nodes of a class
+        //! are evaluated on the labels after the previous class. The result does not depend on
+        //! the number of threads, and the labels cannot oscillate between iterations.
+        SYNCHRONOUS
+    };
+
 private:
     count updateThreshold = 0;
-    count maxIterations;
+    count maxIterations = none;
     count nIterations = 0;     //!< number of iterations in last run
     std::vector<count> timing; //!< running times for each iteration
+    Mode mode = Mode::ASYNCHRONOUS;
 
 public:
     /**
@@ -64,6 +79,13 @@ public:
      */
     void setUpdateThreshold(count th);
 
+    /**
+     * Sets whether labels are updated asynchronously (default) or synchronously.
+     *
+     * @param mode The update mode.
+     */
+    void setMode(Mode mode) { this->mode = mode; }
+
     /**
      * Get number of iterations in last run.
      *
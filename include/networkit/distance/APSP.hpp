@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_DISTANCE_APSP_HPP_
 #define NETWORKIT_DISTANCE_APSP_HPP_
 
+#include <functional>
 #include <memory>
 
 #include <networkit/base/Algorithm.hpp>
@@ -38,6 +39,20 @@ public:
      */
     void run() override;
 
+    using RowCallback = std::function<void(node, const std::vector<edgeweight> &)>;
+
+    /**
+     * Computes the shortest paths from each node to all other nodes without
+     * storing them. Each finished row is passed to @a handle together with its
+     * source and discarded afterwards, so the memory needed is independent of
+     * the number of rows. @a handle is called in parallel from several threads;
+     * the row is only valid during the call. getDistances() is not available
+     * afterwards.
+     *
+     * @param handle Takes parameters <code>(node source, const std::vector<edgeweight> &row)</code>.
+     */
+    void streamRows(const RowCallback &handle);
+
     /**
      * Returns a vector of weighted distances between node pairs.
      *
@@ -60,6 +75,8 @@ public:
     }
 
 protected:
+    void initSSSPs();
+
     const Graph &G;
     std::vector<std::vector<edgeweight>> distances;
     std::vector<std::unique_ptr<SSSP>> sssps;
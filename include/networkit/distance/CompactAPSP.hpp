@@ -0,0 +1,86 @@
+/*
+ * CompactAPSP.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_COMPACT_APSP_HPP_
+#define NETWORKIT_DISTANCE_COMPACT_APSP_HPP_
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * All-pairs shortest path distances stored in a compact row-major matrix of
+ * type @a DistanceType. Integral types (uint8_t, uint16_t, uint32_t) can hold
+ * hop counts of unweighted graphs, float halves the memory of weighted
+ * distances compared to APSP. Unreachable pairs are stored as
+ * CompactAPSP::infDist.
+ *
+ * If a path is given, the matrix is written to that file instead of being kept
+ * in memory; the file is mapped into memory afterwards, so only the pages that
+ * are accessed are loaded. The file contains the n x n distances row by row
+ * without a header, n being the upper node id bound of the graph.
+ *
+ * The class is instantiated for uint8_t, uint16_t, uint32_t and float.
+ */
+template <typename DistanceType>
+class CompactAPSP final : public Algorithm {
+    static_assert(std::is_arithmetic<DistanceType>::value, "DistanceType must be arithmetic");
+
+public:
+    //! Value stored for pairs of nodes that are not connected.
+    static constexpr DistanceType infDist = std::numeric_limits<DistanceType>::max();
+
+    /**
+     * Creates the CompactAPSP class for @a G.
+     *
+     * @param G The graph. Must be unweighted if DistanceType is integral.
+     * @param path If not empty, the distances are stored in this file.
+     */
+    CompactAPSP(const Graph &G, std::string path = "");
+
+    /**
+     * Computes the shortest paths from each node to all other nodes in parallel.
+     * Throws if a finite distance is not representable by DistanceType.
+     */
+    void run() override;
+
+    /**
+     * Returns the distance from u to v, or infDist if v is not reachable from u.
+     */
+    DistanceType getDistance(node u, node v) const {
+        assureFinished();
+        return data[u * n + v];
+    }
+
+    /**
+     * Returns a pointer to the distances from @a u to all nodes; the row has
+     * upperNodeIdBound() entries.
+     */
+    const DistanceType *getRow(node u) const {
+        assureFinished();
+        return data + u * n;
+    }
+
+private:
+    const Graph *G;
+    std::string path;
+    count n = 0;
+    std::vector<DistanceType> inMemory;
+    MemoryMappedFile mappedFile;
+    const DistanceType *data = nullptr;
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_DISTANCE_COMPACT_APSP_HPP_
@@ -0,0 +1,66 @@
+/*
+ * DeltaStepping.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
+#define NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
+
+#include <networkit/distance/SSSP.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Parallel delta-stepping SSSP algorithm (Meyer and Sanders, "Delta-stepping:
+ * a parallelizable shortest path algorithm", J. Algorithms 2003).
+ *
+ * Nodes are kept in buckets of width delta according to their tentative
+ * distance. The smallest non-empty bucket is settled by relaxing light edges
+ * (weight <= delta) in parallel until the bucket stays empty; then the heavy
+ * edges of all nodes settled in this bucket are relaxed once. Small values of
+ * delta approach Dijkstra's algorithm, large values approach Bellman-Ford.
+ * Edge weights must be non-negative. Predecessors and numbers of paths are
+ * computed after the distances are final; with zero-weight edges the number of
+ * paths between nodes at equal distance is not well-defined.
+ */
+class DeltaStepping final : public SSSP {
+
+public:
+    /**
+     * Creates the DeltaStepping class for @a G and the source node @a source.
+     *
+     * @param G The graph.
+     * @param source The source node.
+     * @param storePaths Paths are reconstructable and the number of paths is
+     *        stored.
+     * @param storeNodesSortedByDistance Store a vector of nodes ordered in
+     *        increasing distance from the source.
+     * @param target The target node. If set, the search stops as soon as the
+     *        distance of @a target is final.
+     * @param delta The bucket width. If zero, the average edge weight is used.
+     */
+    DeltaStepping(const Graph &G, node source, bool storePaths = true,
+                  bool storeNodesSortedByDistance = false, node target = none,
+                  edgeweight delta = 0);
+
+    /**
+     * Computes the shortest paths from the source to all other nodes.
+     */
+    void run() override;
+
+    /**
+     * Returns the bucket width used in the last run.
+     */
+    edgeweight getDelta() const {
+        assureFinished();
+        return usedDelta;
+    }
+
+private:
+    edgeweight delta, usedDelta = 0;
+};
+
+} /* namespace NetworKit */
+#endif // NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
@@ -27,7 +27,11 @@ public:
      *
      * @param G The input graph.
      */
-    DynPrunedLandmarkLabeling(const Graph &G) : PrunedLandmarkLabeling(G) {}
+    DynPrunedLandmarkLabeling(const Graph &G)
+        : PrunedLandmarkLabeling(G), visited(G.upperNodeIdBound()) {
+        // updates insert into the per-node label lists, so they are kept after run()
+        compactLabels = false;
+    }
 
     ~DynPrunedLandmarkLabeling() override = default;
 
@@ -60,6 +64,8 @@ private:
     void sortUpdatedLabels(bool reverse);
 
     std::vector<node> updatedNodes;
+    std::vector<bool> visited;
+    std::vector<Label> labelsUCopy, labelsVCopy;
 };
 
 } // namespace NetworKit
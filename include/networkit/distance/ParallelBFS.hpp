@@ -0,0 +1,68 @@
+/*
+ * ParallelBFS.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_PARALLEL_BFS_HPP_
+#define NETWORKIT_DISTANCE_PARALLEL_BFS_HPP_
+
+#include <networkit/distance/SSSP.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Level-synchronous parallel breadth-first search with direction optimization
+ * (Beamer et al., "Direction-Optimizing Breadth-First Search", SC 2012).
+ *
+ * Small frontiers are expanded top-down: the threads scan the out-edges of the
+ * frontier and claim unvisited nodes with an atomic bitmap. Once the frontier
+ * touches a large share of the remaining edges, the search switches to
+ * bottom-up steps, in which every unvisited node scans its in-edges until it
+ * finds a parent in the frontier bitmap. The result is the same as the one
+ * of BFS, except for the order of nodes with equal distance and of their
+ * predecessors.
+ */
+class ParallelBFS final : public SSSP {
+
+public:
+    /**
+     * Constructs the ParallelBFS class for @a G and source node @a source.
+     *
+     * @param G The graph.
+     * @param source The source node of the breadth-first search.
+     * @param storePaths Paths are reconstructable and the number of paths is
+     * stored.
+     * @param storeNodesSortedByDistance Store a vector of nodes ordered in
+     * increasing distance from the source.
+     * @param target The target node. If set, the search stops after the level
+     * that contains @a target.
+     * @param alpha Switch to bottom-up once the frontier has more than 1/alpha
+     * of the unexplored edges.
+     * @param beta Switch back to top-down once the frontier has less than
+     * 1/beta of the nodes.
+     */
+    ParallelBFS(const Graph &G, node source, bool storePaths = true,
+                bool storeNodesSortedByDistance = false, node target = none, double alpha = 15.,
+                double beta = 18.);
+
+    /**
+     * Breadth-first search from @a source.
+     */
+    void run() override;
+
+    /**
+     * Returns the number of levels that were explored bottom-up in the last run.
+     */
+    count getNumberOfBottomUpSteps() const {
+        assureFinished();
+        return bottomUpSteps;
+    }
+
+private:
+    double alpha, beta;
+    count bottomUpSteps = 0;
+};
+} /* namespace NetworKit */
+#endif // NETWORKIT_DISTANCE_PARALLEL_BFS_HPP_
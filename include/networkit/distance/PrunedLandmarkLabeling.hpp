@@ -1,6 +1,8 @@
 #ifndef NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_HPP_
 #define NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_HPP_
 
+#include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -19,15 +21,29 @@ public:
      * vertex. Labels are used to quickly retrieve shortest-path distances between node pairs.
      * @note this algorithm only works for unweighted graphs.
      *
+     * The pruned searches are run in parallel in batches of roots; the searches of one batch only
+     * prune with the labels of earlier batches. This yields a few more labels than the sequential
+     * algorithm, but the same distances. For undirected graphs, the first
+     * @a bitParallelRoots searches can be replaced by bit-parallel searches (Section 5 of the
+     * paper), each of which covers a root together with up to 64 of its neighbors.
+     *
      * @param G The input graph.
+     * @param bitParallelRoots Number of bit-parallel searches. Ignored for directed graphs.
      */
-    PrunedLandmarkLabeling(const Graph &G);
+    PrunedLandmarkLabeling(const Graph &G, count bitParallelRoots = 0);
 
     /**
      * Computes distance labels. Run this function before calling 'query'.
      */
     void run() override;
 
+    /**
+     * Writes the labels to @a path in the format read by PrunedLandmarkLabelingIndex.
+     *
+     * @param path The output file.
+     */
+    void writeIndex(const std::string &path) const;
+
     /**
      * Returns the shortest-path distance between the two nodes.
      *
@@ -38,6 +54,17 @@ public:
      */
     count query(node u, node v) const;
 
+    /**
+     * Returns the shortest-path distances between the given pairs of nodes. The queries are
+     * answered in parallel; if the CPU supports AVX2, the label lists are intersected with
+     * vector instructions (as in query).
+     *
+     * @param pairs Pairs of source and target nodes.
+     *
+     * @return The shortest-path distance of each pair, in the order of @a pairs.
+     */
+    std::vector<count> queryBatch(const std::vector<std::pair<node, node>> &pairs) const;
+
 protected:
     count queryImpl(node u, node v, node upperBound = none) const;
 
@@ -50,25 +77,58 @@ protected:
         count distance_;
     };
 
+    // Distance to the root of a bit-parallel search, and which of the up to 64 selected
+    // neighbors of the root are one step closer (setMinusOne) or equally far (setZero).
+    struct BitParallelLabel {
+        count distance = infDist;
+        uint64_t setMinusOne = 0;
+        uint64_t setZero = 0;
+    };
+
     const Graph *G;
     std::vector<node> nodesSortedByDegreeDesc;
-    std::vector<bool> visited;
+
+    // Labels of every node, sorted by hub rank. run() builds them in per-node lists and then, if
+    // compactLabels is set, moves them into one contiguous array per direction, where the labels
+    // of node u are flatLabelsOut[flatOffsetsOut[u]] to flatLabelsOut[flatOffsetsOut[u + 1] - 1].
+    bool compactLabels = true;
     std::vector<std::vector<Label>> labelsOut, labelsIn;
-    std::vector<Label> labelsUCopy, labelsVCopy;
+    std::vector<index> flatOffsetsOut, flatOffsetsIn;
+    std::vector<Label> flatLabelsOut, flatLabelsIn;
+
+    count bitParallelRoots;
+    // bitParallelLabels[u * bitParallelRoots + i] belongs to node u and search i
+    std::vector<BitParallelLabel> bitParallelLabels;
+
+    // Per-thread state of the pruned searches.
+    struct SearchState {
+        std::vector<uint8_t> visited;
+        std::vector<count> rootLabelDistance; // distance from the root to the hub with this rank
+        std::vector<node> queue;
+        std::vector<Label> newLabels; // (node, distance) pairs found by the search
+    };
 
     template <bool Reverse = false>
-    void prunedBFS(node root, node rankOfRootNode);
-
-    auto getSourceLabelsIterators(node u, bool reverse = false) const {
-        if (reverse)
-            return std::make_pair(labelsIn[u].begin(), labelsIn[u].end());
-        else
-            return std::make_pair(labelsOut[u].begin(), labelsOut[u].end());
+    void prunedBFS(node root, SearchState &state) const;
+
+    // Runs the bit-parallel searches; returns which nodes are covered by them.
+    std::vector<uint8_t> bitParallelBFS();
+
+    count bitParallelQuery(node u, node v) const;
+
+    // Returns the labels of @a u in labelsIn if @a in is set and in labelsOut otherwise.
+    std::pair<const Label *, const Label *> labelRange(node u, bool in = false) const {
+        if (compactLabels) {
+            const auto &offsets = in ? flatOffsetsIn : flatOffsetsOut;
+            const Label *labels = (in ? flatLabelsIn : flatLabelsOut).data();
+            return {labels + offsets[u], labels + offsets[u + 1]};
+        }
+        const auto &labels = in ? labelsIn[u] : labelsOut[u];
+        return {labels.data(), labels.data() + labels.size()};
     }
 
-    auto getTargetLabelsIterators(node u) const {
-        return std::make_pair(labelsOut[u].begin(), labelsOut[u].end());
-    }
+    // Moves the per-node label lists into the contiguous arrays.
+    void compact();
 };
 
 } // namespace NetworKit
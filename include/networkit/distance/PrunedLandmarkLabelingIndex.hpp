@@ -0,0 +1,90 @@
+/*
+ * PrunedLandmarkLabelingIndex.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_INDEX_HPP_
+#define NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_INDEX_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <networkit/Globals.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Read-only distance labels written by PrunedLandmarkLabeling::writeIndex. The
+ * file is mapped into memory and queried in place, so loading the index does
+ * not depend on its size and several processes share the same pages.
+ *
+ * All fields of the file are 64-bit unsigned integers in native byte order:
+ * a header (magic "nkpll01\0", upper node id bound n, directed flag, number k of
+ * bit-parallel labels per node, number of out- and in-labels), then the n * k
+ * bit-parallel labels (distance, setMinusOne, setZero), the n + 1 offsets of the
+ * out-labels and the out-labels as (rank of hub, distance) pairs. Directed
+ * graphs additionally store offsets and in-labels in the same way.
+ */
+class PrunedLandmarkLabelingIndex final {
+
+public:
+    static constexpr count infDist = std::numeric_limits<count>::max();
+
+    struct Header {
+        char magic[8];
+        uint64_t nodes;
+        uint64_t directed;
+        uint64_t bitParallelRoots;
+        uint64_t numLabelsOut;
+        uint64_t numLabelsIn;
+    };
+
+    static constexpr char magic[8] = "nkpll01";
+
+    struct BitParallelLabel {
+        uint64_t distance;
+        uint64_t setMinusOne;
+        uint64_t setZero;
+    };
+
+    struct Label {
+        uint64_t hub;
+        uint64_t distance;
+    };
+
+    /**
+     * Maps the index stored in @a path into memory. Throws std::runtime_error if
+     * the file is not a valid index.
+     *
+     * @param path Path to a file written by PrunedLandmarkLabeling::writeIndex.
+     */
+    explicit PrunedLandmarkLabelingIndex(const std::string &path);
+
+    /**
+     * Returns the shortest-path distance from @a u to @a v, or infDist if @a v
+     * is not reachable from @a u.
+     */
+    count query(node u, node v) const;
+
+    /**
+     * Returns the upper node id bound of the indexed graph.
+     */
+    count upperNodeIdBound() const noexcept { return header->nodes; }
+
+private:
+    MemoryMappedFile file;
+    const Header *header;
+    const BitParallelLabel *bitParallelLabels;
+    const uint64_t *offsetsOut, *offsetsIn;
+    const Label *labelsOut, *labelsIn;
+
+    count bitParallelQuery(node u, node v) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_INDEX_HPP_
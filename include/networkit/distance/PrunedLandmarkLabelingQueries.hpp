@@ -0,0 +1,87 @@
+/*
+ * PrunedLandmarkLabelingQueries.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_QUERIES_HPP_
+#define NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_QUERIES_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <networkit/Globals.hpp>
+
+namespace NetworKit {
+
+/**
+ * Label intersections shared by PrunedLandmarkLabeling and PrunedLandmarkLabelingIndex, which
+ * store their labels in different structs with the same layout.
+ */
+namespace PrunedLandmarkLabelingQueries {
+
+/**
+ * Returns the shortest distance between two nodes via the roots of the bit-parallel searches,
+ * or the maximum count if no search reached both nodes.
+ *
+ * @param labelsU The bit-parallel labels (distance, setMinusOne, setZero) of the first node.
+ * @param labelsV The bit-parallel labels of the second node.
+ * @param roots The number of bit-parallel labels per node.
+ */
+template <typename BitParallelLabel>
+inline count bitParallelDistance(const BitParallelLabel *labelsU, const BitParallelLabel *labelsV,
+                                 count roots) {
+    constexpr count infDist = std::numeric_limits<count>::max();
+    count result = infDist;
+    for (index i = 0; i < roots; ++i) {
+        if (labelsU[i].distance == infDist || labelsV[i].distance == infDist)
+            continue;
+        count dist = labelsU[i].distance + labelsV[i].distance;
+        if (result != infDist && dist > result + 2)
+            continue;
+        if (labelsU[i].setMinusOne & labelsV[i].setMinusOne)
+            dist -= 2;
+        else if ((labelsU[i].setMinusOne & labelsV[i].setZero)
+                 | (labelsU[i].setZero & labelsV[i].setMinusOne))
+            dist -= 1;
+        result = std::min(result, dist);
+    }
+    return result;
+}
+
+/**
+ * Returns the minimum of distU + distV over the hubs common to two label lists, or the maximum
+ * count if there is none. Each label consists of two 64-bit integers, the rank of the hub and
+ * the distance, and both lists are sorted by hub rank. The lists are intersected with AVX2
+ * instructions if the CPU supports them, independently of the compiler flags.
+ *
+ * @param labelsU The first label list.
+ * @param sizeU The number of labels in the first list.
+ * @param labelsV The second label list.
+ * @param sizeV The number of labels in the second list.
+ */
+count mergeLabels(const uint64_t *labelsU, count sizeU, const uint64_t *labelsV, count sizeV);
+
+/**
+ * Computes the same as mergeLabels with a scalar merge.
+ */
+count mergeLabelsScalar(const uint64_t *labelsU, count sizeU, const uint64_t *labelsV,
+                        count sizeV);
+
+/**
+ * Computes the same as mergeLabels with AVX2 instructions. Must only be called if
+ * hasAVX2Merge() returns true.
+ */
+count mergeLabelsAVX2(const uint64_t *labelsU, count sizeU, const uint64_t *labelsV, count sizeV);
+
+/**
+ * Returns whether the AVX2 merge was compiled in and the CPU supports it.
+ */
+bool hasAVX2Merge();
+
+} // namespace PrunedLandmarkLabelingQueries
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_QUERIES_HPP_
@@ -14,10 +14,10 @@
 namespace NetworKit {
 
 /**
- * An implementation of the triangle counting algorithm by Chiba/Nishizeki.
+ * Counts the triangles of each edge. The edge-deletion algorithm by Chiba/Nishizeki has been
+ * replaced by TriangleEngine, so the results are the same as those of TriangleEdgeScore.
  *
- * @deprecated Use TriangleEdgeScore instead which is parallelized and has a similar performance
- * even in the sequential case.
+ * @deprecated Use TriangleEdgeScore instead.
  */
 class ChibaNishizekiTriangleEdgeScore final : public EdgeScore<count> {
 
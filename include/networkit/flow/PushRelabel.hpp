@@ -0,0 +1,138 @@
+/*
+ * PushRelabel.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_FLOW_PUSH_RELABEL_HPP_
+#define NETWORKIT_FLOW_PUSH_RELABEL_HPP_
+
+#include <atomic>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup flow
+ * Parallel push-relabel maximum flow algorithm (Goldberg and Tarjan) with multiple sources and
+ * sinks. Edge weights are capacities; undirected edges can be used in both directions.
+ *
+ * The algorithm works in synchronous rounds: first, all active nodes push their excess along
+ * admissible arcs in parallel, then all nodes that still have excess are relabeled in parallel
+ * using the labels of the previous round. Labels are periodically recomputed by a parallel
+ * breadth-first search from the sinks (global relabeling), and nodes above an unused label are
+ * lifted immediately (gap heuristic). A second phase returns the excess that cannot reach any
+ * sink back to the sources, so the result is a valid flow.
+ *
+ * Unlike EdmondsKarp, the graph does not need indexed edges; the flow per edge id is only
+ * available if the edges are indexed.
+ */
+class PushRelabel final : public Algorithm {
+public:
+    /**
+     * Creates the PushRelabel class for @a G with a single source and a single sink.
+     *
+     * @param G The graph.
+     * @param source The source node.
+     * @param sink The sink node.
+     */
+    PushRelabel(const Graph &G, node source, node sink);
+
+    /**
+     * Creates the PushRelabel class for @a G with several sources and sinks, i.e., the flow
+     * from a super source connected to all @a sources to a super sink connected to all
+     * @a sinks with edges of infinite capacity.
+     *
+     * @param G The graph.
+     * @param sources The source nodes.
+     * @param sinks The sink nodes, disjoint from the sources.
+     */
+    PushRelabel(const Graph &G, std::vector<node> sources, std::vector<node> sinks);
+
+    /**
+     * Computes the maximum flow.
+     */
+    void run() override;
+
+    /**
+     * Returns the value of the maximum flow from the sources to the sinks.
+     *
+     * @return The maximum flow value
+     */
+    edgeweight getMaxFlow() const;
+
+    /**
+     * Returns the set of the nodes on the source side of the flow/minimum cut.
+     *
+     * @return The set of nodes that form the (smallest) source side of the flow/minimum cut.
+     */
+    std::vector<node> getSourceSet() const;
+
+    /**
+     * Get the flow value between two nodes @a u and @a v, summed over parallel edges.
+     * @warning The running time of this function is linear in the degree of u.
+     *
+     * @param u The first node
+     * @param v The second node
+     * @return The flow from u to v.
+     */
+    edgeweight getFlow(node u, node v) const;
+
+    /**
+     * Get the flow value of an edge. Requires indexed edges. As in EdmondsKarp, a positive flow
+     * on an undirected edge goes from the endpoint with the larger id to the one with the
+     * smaller id.
+     *
+     * @param eid The id of the edge
+     * @return The flow on the edge identified by eid
+     */
+    edgeweight getFlow(edgeid eid) const {
+        assureFinished();
+        assureEdgeFlow();
+        return flow[eid];
+    }
+
+    /**
+     * Return the flow values of all edges indexed by edge id. Requires indexed edges.
+     *
+     * @return The flow values of all edges
+     */
+    const std::vector<edgeweight> &getFlowVector() const;
+
+private:
+    const Graph *G;
+    std::vector<node> sources, sinks;
+
+    edgeweight flowValue = 0;
+    std::vector<edgeweight> flow;
+
+    // Residual network: the arcs of u are [firstArc[u], firstArc[u + 1]), the arcs in
+    // [firstArc[u], firstReverseArc[u]) correspond to the edges of u in the order of
+    // forNeighborsOf (directed: out-edges; undirected: edges to smaller node ids).
+    std::vector<index> firstArc, firstReverseArc;
+    std::vector<node> head;
+    std::vector<index> reverse;
+    std::vector<edgeweight> residual;
+
+    std::vector<edgeweight> excess;
+    std::vector<std::atomic<edgeweight>> addedExcess;
+    std::vector<std::atomic<index>> stamp;
+    index epoch = 0;
+
+    void buildResidualNetwork();
+
+    /**
+     * Pushes the excess of the non-terminal nodes towards @a targets until no node that can
+     * reach a target has excess.
+     */
+    void pushRelabel(const std::vector<node> &targets, const std::vector<bool> &isTerminal);
+
+    void assureEdgeFlow() const;
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_FLOW_PUSH_RELABEL_HPP_
@@ -9,6 +9,7 @@
 #define NETWORKIT_GENERATORS_CHUNG_LU_GENERATOR_HPP_
 
 #include <networkit/generators/StaticDegreeSequenceGenerator.hpp>
+#include <networkit/generators/StreamingGraphGenerator.hpp>
 
 namespace NetworKit {
 
@@ -29,7 +30,8 @@ namespace NetworKit {
  *
  */
 
-class ChungLuGenerator final : public StaticDegreeSequenceGenerator {
+class ChungLuGenerator final : public StaticDegreeSequenceGenerator,
+                               public StreamingGraphGenerator {
     count sum_deg;
     count n;
 
@@ -40,6 +42,18 @@ public:
      * Generates graph with expected degree sequence seq.
      */
     Graph generate() override;
+
+    count numberOfNodes() const override { return n; }
+
+    /**
+     * Emits the edges of a graph with expected degree sequence seq in batches. As in
+     * generate(), node ids refer to the degree sequence sorted in descending order.
+     */
+    void generateEdges(const EdgeBatchHandle &handle) override;
+
+private:
+    template <typename Handle>
+    void forEdges(Handle handle);
 };
 
 } /* namespace NetworKit */
@@ -10,7 +10,7 @@
 
 #include <omp.h>
 
-#include <atomic>
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <random>
@@ -58,7 +58,7 @@ public:
      * @param directed  Selects an directed graph
      */
     ErdosRenyiEnumerator(node n, double prob, bool directed)
-        : n{n}, prob{prob}, directed{directed} {
+        : n{n}, prob{prob}, directed{directed}, seed{Aux::Random::integer()} {
         assert(n > 0);
     }
 
@@ -78,56 +78,23 @@ public:
      *
      * It can be expected that all threads emit a similar number of edges.
      *
+     * The rows of the adjacency matrix are split into a fixed number of chunks
+     * with one random stream each, seeded from Aux::Random when the enumerator
+     * is constructed. Hence, the set of edges does not depend on the number of
+     * threads and is the same as for @ref forEdges.
+     *
      * Returns number of edges produced.
      */
     template <typename Handle>
     count forEdgesParallel(Handle handle) {
-        std::atomic<count> numEdges{0};
-        if (directed) {
-#pragma omp parallel
-            {
-                const unsigned threads = omp_get_num_threads();
-                const unsigned tid = omp_get_thread_num();
-
-                const node chunk_size = (n + threads - 1) / threads;
-                const node first_node = std::min<node>(n, tid * chunk_size);
-                const node last_node = std::min<node>(n, (tid + 1) * chunk_size);
-
-                const auto localNumEdges =
-                    enumerate<true>(handle, tid, prob, first_node, last_node);
-                numEdges.fetch_add(localNumEdges, std::memory_order_relaxed);
-            }
-        } else {
-#pragma omp parallel
-            {
-                const unsigned threads = omp_get_num_threads();
-                const unsigned tid = omp_get_thread_num();
-
-                // cells in adj matrix per thread
-                const node chunk_size = (n * (n - 1) / 2 + threads - 1) / threads;
-
-                double first_node;
-                double last_node = 0.0;
-
-                for (unsigned i = 0; i <= tid; i++) {
-                    first_node = last_node;
-                    node upper_node = std::ceil(
-                        std::sqrt(0.25 + first_node * first_node + first_node + 2 * chunk_size));
-                    last_node = std::min<node>(n, upper_node);
-                }
+        const index chunks = numberOfChunks();
+        count numEdges = 0;
 
-                if (tid + 1 == threads)
-                    last_node = n;
+#pragma omp parallel for schedule(static, 1) reduction(+ : numEdges)
+        for (omp_index chunk = 0; chunk < static_cast<omp_index>(chunks); ++chunk)
+            numEdges += enumerateChunk(handle, omp_get_thread_num(), chunk, chunks);
 
-                if (first_node < last_node) {
-                    const auto localNumEdges =
-                        enumerate<false>(handle, tid, prob, first_node, last_node);
-                    numEdges.fetch_add(localNumEdges, std::memory_order_relaxed);
-                }
-            }
-        }
-
-        return numEdges.load();
+        return numEdges;
     }
 
     /**
@@ -136,11 +103,11 @@ public:
      */
     template <typename Handle>
     count forEdges(Handle handle) {
-        if (directed) {
-            return enumerate<true>(handle, 0, prob, 0, n);
-        } else {
-            return enumerate<false>(handle, 0, prob, 0, n);
-        }
+        const index chunks = numberOfChunks();
+        count numEdges = 0;
+        for (index chunk = 0; chunk < chunks; ++chunk)
+            numEdges += enumerateChunk(handle, 0, chunk, chunks);
+        return numEdges;
     }
 
     /**
@@ -152,12 +119,44 @@ private:
     const node n;        //< number of nodes
     const double prob;   //< probability p
     const bool directed; //< true if a directed graph should be generated
+    const uint64_t seed; //< seed of the random streams of the chunks
+
+    //! Upper bound of the number of chunks, independent of the number of threads.
+    static constexpr index maxChunks = 4096;
+
+    index numberOfChunks() const { return std::min<index>(n, maxChunks); }
+
+    // First row of the given chunk; the last chunk ends at row n.
+    node firstRowOfChunk(index chunk, index chunks) const {
+        if (chunk == chunks)
+            return n;
+        if (directed)
+            return static_cast<node>(static_cast<double>(n) * chunk / chunks);
+
+        // rows [0, r) contain r * (r - 1) / 2 cells of the lower triangle
+        const double cells = 0.5 * static_cast<double>(n) * static_cast<double>(n - 1);
+        const double target = cells * chunk / chunks;
+        return std::min<node>(n, static_cast<node>(std::ceil(0.5 + std::sqrt(0.25 + 2 * target))));
+    }
+
+    template <typename Handle>
+    count enumerateChunk(Handle handle, unsigned tid, index chunk, index chunks) const {
+        const node first = firstRowOfChunk(chunk, chunks);
+        const node last = firstRowOfChunk(chunk + 1, chunks);
+        if (first >= last)
+            return 0;
+
+        auto prng = Aux::Random::streamURNG(seed, chunk);
+        if (directed)
+            return enumerate<true>(handle, tid, prng, prob, first, last);
+        return enumerate<false>(handle, tid, prng, prob, first, last);
+    }
 
     // In the undirected case we only traverse the lower triangle (excluding the
     // diagonal) of the adjacency matrix
     template <bool Directed, typename Handle>
-    count enumerate(Handle handle, unsigned tid, double prob, const node node_begin,
-                    const node node_end) const {
+    count enumerate(Handle handle, unsigned tid, std::mt19937_64 &prng, double prob,
+                    const node node_begin, const node node_end) const {
         if (prob > 0.9) {
             // for p > 0.5 we invert the generator and draw the edges NOT in the graph.
             // While this does not change the asymptotical work, it decrease the
@@ -182,18 +181,18 @@ private:
                 }
             };
 
-            enumerate_<Directed>(complement_graph, tid, 1.0 - prob, node_begin, node_end);
+            enumerate_<Directed>(complement_graph, tid, prng, 1.0 - prob, node_begin, node_end);
             complement_graph(tid, node_end, 0);
 
             return num_edges;
         }
 
-        return enumerate_<Directed>(handle, tid, prob, node_begin, node_end);
+        return enumerate_<Directed>(handle, tid, prng, prob, node_begin, node_end);
     }
 
     template <bool Directed, typename Handle>
-    count enumerate_(Handle handle, unsigned tid, double prob, const node node_begin,
-                     const node node_end) const {
+    count enumerate_(Handle handle, unsigned tid, std::mt19937_64 &prng, double prob,
+                     const node node_begin, const node node_end) const {
         Aux::SignalHandler handler;
 
         if (prob < std::pow(n, -3.0)) {
@@ -203,8 +202,6 @@ private:
 
         const double inv_log2_cp = 1.0 / std::log2(1.0 - prob);
 
-        // random source
-        auto &prng = Aux::Random::getURNG(); // this is thread local
         auto distr = get_distribution<UseFixedPoint>();
 
         count curr = node_begin;
@@ -32,6 +32,10 @@ public:
      * implemented as a special case and requires p to be exactly zero or
      * one.
      *
+     * The edges are drawn from a fixed number of random streams seeded from
+     * Aux::Random, so for a given seed the graph does not depend on the number
+     * of threads.
+     *
      * @warning For compatibility reasons, the generator does not produce
      * self-loops by default.
      *
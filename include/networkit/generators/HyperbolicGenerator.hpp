@@ -13,6 +13,7 @@
 
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/generators/StaticGraphGenerator.hpp>
+#include <networkit/generators/StreamingGraphGenerator.hpp>
 #include <networkit/generators/quadtree/Quadtree.hpp>
 #include <networkit/geometric/HyperbolicSpace.hpp>
 
@@ -21,7 +22,7 @@ namespace NetworKit {
 /**
  * @ingroup generators
  */
-class HyperbolicGenerator final : public StaticGraphGenerator {
+class HyperbolicGenerator final : public StaticGraphGenerator, public StreamingGraphGenerator {
     friend class DynamicHyperbolicGenerator;
 
 public:
@@ -51,6 +52,14 @@ public:
      */
     Graph generate() override;
 
+    count numberOfNodes() const override { return nodeCount; }
+
+    /**
+     * Samples the node positions and emits the edges of the graph specified in the constructor
+     * in batches. Only the node positions are kept in memory.
+     */
+    void generateEdges(const EdgeBatchHandle &handle) override;
+
     /**
      * Set the capacity of a quadtree leaf.
      *
@@ -83,6 +92,23 @@ private:
 
     Graph generate(count n, double R, double alpha, double T = 0);
 
+    /**
+     * Samples @a n points in the hyperbolic disk of radius @a R, sorted by angle and radius.
+     */
+    void samplePoints(count n, double R, double alpha, vector<double> &angles,
+                      vector<double> &radii);
+
+    /**
+     * Calls handle(u, v) concurrently for all edges {u, v} between the given points.
+     */
+    template <typename Handle>
+    void forEdges(const vector<double> &angles, const vector<double> &radii, double R, double T,
+                  Handle handle);
+
+    template <typename Handle>
+    void forEdgesCold(const vector<double> &angles, const vector<double> &radii, double R,
+                      Handle handle);
+
     static vector<vector<double>>
     getBandAngles(const vector<vector<Point2DWithIndex<double>>> &bands) {
         vector<vector<double>> bandAngles(bands.size());
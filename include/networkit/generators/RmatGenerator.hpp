@@ -8,7 +8,12 @@
 #ifndef NETWORKIT_GENERATORS_RMAT_GENERATOR_HPP_
 #define NETWORKIT_GENERATORS_RMAT_GENERATOR_HPP_
 
+#include <omp.h>
+#include <random>
+
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/generators/StaticGraphGenerator.hpp>
+#include <networkit/generators/StreamingGraphGenerator.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -20,8 +25,12 @@ namespace NetworKit {
  * More details at http://www.graph500.org or in the original paper:
  * Deepayan Chakrabarti, Yiping Zhan, Christos Faloutsos:
  * R-MAT: A Recursive Model for Graph Mining. SDM 2004: 442-446.
+ *
+ * Edges are drawn in parallel in blocks of fixed size, each block with its own random stream
+ * seeded from Aux::Random. Hence, for a given seed the generated graph does not depend on the
+ * number of threads.
  */
-class RmatGenerator final : public StaticGraphGenerator {
+class RmatGenerator final : public StaticGraphGenerator, public StreamingGraphGenerator {
     count scale; ///< n = 2^scale
     count edgeFactor;
     double a, b, c; ///< probabilities
@@ -47,6 +56,69 @@ public:
      * @return Graph to be generated according to parameters specified in constructor.
      */
     Graph generate() override;
+
+    count numberOfNodes() const override { return (count{1} << scale) - reduceNodes; }
+
+    /**
+     * Emits the edges drawn by the R-MAT process in batches. The stream contains multi-edges and
+     * self-loops as drawn; it consists of the same draws as generate() for weighted graphs, so
+     * removing the multi-edges yields the edges of the weighted graph (for the same seed).
+     */
+    void generateEdges(const EdgeBatchHandle &handle) override;
+
+    /**
+     * Streams the 2^scale * edgeFactor edges drawn by the R-MAT process without building a
+     * graph, like the edge list of the Graph500 benchmark: duplicates and self-loops are
+     * emitted as drawn, nodes are not deleted (@a reduceNodes is ignored) and edges are
+     * directed from the row to the column of the adjacency matrix. For a given seed, the same
+     * edges are emitted for any number of threads, but in no particular order.
+     *
+     * @param handle Called as handle(tid, u, v) for each edge, concurrently by all threads;
+     * tid is the id of the calling thread as returned by omp_get_thread_num().
+     * @return The number of edges emitted.
+     */
+    template <typename Handle>
+    count forEdgesParallel(Handle handle) const {
+        const count numEdges = (count{1} << scale) * edgeFactor;
+        const count blocks = (numEdges + edgesPerBlock - 1) / edgesPerBlock;
+        const uint64_t seed = Aux::Random::integer();
+
+#pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index block = 0; block < static_cast<omp_index>(blocks); ++block) {
+            const unsigned tid = omp_get_thread_num();
+            drawBlock(seed, block, std::min(edgesPerBlock, numEdges - block * edgesPerBlock),
+                      [&](node u, node v) { handle(tid, u, v); });
+        }
+
+        return numEdges;
+    }
+
+private:
+    //! Number of edges drawn from the random stream of one block.
+    static constexpr count edgesPerBlock = count{1} << 16;
+
+    count numberOfDraws() const;
+
+    //! Maps the nodes to their ids after deleting reduceNodes random nodes (none if deleted).
+    std::vector<node> reducedNodeIds(uint64_t seed) const;
+
+    template <typename Handle>
+    void drawBlock(uint64_t seed, index block, count numEdges, Handle handle) const {
+        auto urng = Aux::Random::streamURNG(seed, block);
+        std::uniform_real_distribution<double> distr;
+        const double ab = a + b, abc = ab + c;
+
+        for (index e = 0; e < numEdges; ++e) {
+            node u = 0, v = 0;
+            for (index i = 0; i < scale; ++i) {
+                // quadrants: a = (0, 0), b = (0, 1), c = (1, 0), d = (1, 1)
+                const double r = distr(urng);
+                u = (u << 1) | static_cast<node>(r > ab);
+                v = (v << 1) | static_cast<node>((r > a && r <= ab) || r > abc);
+            }
+            handle(u, v);
+        }
+    }
 };
 
 } /* namespace NetworKit */
@@ -9,13 +9,14 @@
 #define NETWORKIT_GENERATORS_STOCHASTIC_BLOCKMODEL_HPP_
 
 #include <networkit/generators/StaticGraphGenerator.hpp>
+#include <networkit/generators/StreamingGraphGenerator.hpp>
 
 namespace NetworKit {
 
 /**
  * @ingroup generators
  */
-class StochasticBlockmodel final : public StaticGraphGenerator {
+class StochasticBlockmodel final : public StaticGraphGenerator, public StreamingGraphGenerator {
 
 public:
     /**
@@ -31,10 +32,21 @@ public:
 
     Graph generate() override;
 
+    count numberOfNodes() const override { return n; }
+
+    /**
+     * Emits the edges in batches. The running time is linear in the number of edges plus
+     * n * nBlocks.
+     */
+    void generateEdges(const EdgeBatchHandle &handle) override;
+
 private:
     count n;
     std::vector<index> membership;
     const std::vector<std::vector<double>> &affinity;
+
+    template <typename Handle>
+    void forEdges(Handle handle);
 };
 
 } /* namespace NetworKit */
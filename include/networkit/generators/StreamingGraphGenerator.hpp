@@ -0,0 +1,89 @@
+/*
+ * StreamingGraphGenerator.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GENERATORS_STREAMING_GRAPH_GENERATOR_HPP_
+#define NETWORKIT_GENERATORS_STREAMING_GRAPH_GENERATOR_HPP_
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup generators
+ * Interface of generators that can emit the edges of the generated graph in batches instead of
+ * building a Graph. Together with a writer that consumes the batches (see
+ * NetworkitBinaryWriter::write(StreamingGraphGenerator &, const std::string &) and
+ * EdgeListWriter), this allows to write graphs that do not fit into main memory: the memory
+ * used by the generator itself is linear in the number of nodes, but not in the number of edges.
+ */
+class StreamingGraphGenerator {
+
+public:
+    using EdgeBatch = std::vector<std::pair<node, node>>;
+    using EdgeBatchHandle = std::function<void(const EdgeBatch &)>;
+
+    //! Maximum number of edges per batch.
+    static constexpr count edgeBatchSize = count{1} << 16;
+
+    /** Default destructor */
+    virtual ~StreamingGraphGenerator() = default;
+
+    /**
+     * @return The number of nodes of the generated graph.
+     */
+    virtual count numberOfNodes() const = 0;
+
+    /**
+     * @return True if the generated graph is directed.
+     */
+    virtual bool isDirected() const { return false; }
+
+    /**
+     * Generates the edges and passes them to @a handle in batches of at most edgeBatchSize
+     * edges. The handle is called concurrently by several threads. Each edge is emitted once,
+     * for undirected graphs in an arbitrary orientation. Unless stated otherwise by the
+     * generator, the stream contains neither multi-edges nor self-loops.
+     *
+     * @param handle Called for each batch of edges; must not throw, as it is called from
+     * parallel regions.
+     */
+    virtual void generateEdges(const EdgeBatchHandle &handle) = 0;
+
+protected:
+    /**
+     * Collects the edges of one thread and passes them to the handle once edgeBatchSize edges
+     * are buffered. flush() must be called after the last edge.
+     */
+    class EdgeBatchBuffer {
+    public:
+        explicit EdgeBatchBuffer(const EdgeBatchHandle &handle) : handle(&handle) {
+            batch.reserve(edgeBatchSize);
+        }
+
+        void add(node u, node v) {
+            batch.emplace_back(u, v);
+            if (batch.size() == edgeBatchSize)
+                flush();
+        }
+
+        void flush() {
+            if (!batch.empty())
+                (*handle)(batch);
+            batch.clear();
+        }
+
+    private:
+        const EdgeBatchHandle *handle;
+        EdgeBatch batch;
+    };
+};
+
+} /* namespace NetworKit */
+#endif // NETWORKIT_GENERATORS_STREAMING_GRAPH_GENERATOR_HPP_
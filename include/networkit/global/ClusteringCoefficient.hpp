@@ -32,7 +32,7 @@ public:
     static double approxAvgLocal(Graph &G, count trials);
 
     /**
-     * This calculates the global clustering coefficient
+     * This calculates the global clustering coefficient of an undirected graph.
      */
     static double exactGlobal(Graph &G);
     static double approxGlobal(Graph &G, count trials);
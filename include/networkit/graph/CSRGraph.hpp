@@ -0,0 +1,710 @@
+/*
+ * CSRGraph.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+#define NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <omp.h>
+
+#include <networkit/Globals.hpp>
+#include <networkit/auxiliary/FunctionTraits.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * An immutable graph stored in compressed sparse row (CSR) format.
+ *
+ * All neighborhoods are stored in one contiguous array of targets (and, if present, one array of
+ * weights and one of edge ids) which is indexed by an offset array of size upperNodeIdBound() + 1.
+ * Compared to the adjacency vectors of Graph, this avoids one heap allocation per node and keeps
+ * neighborhoods of consecutive nodes next to each other in memory.
+ *
+ * The class offers the read-only part of the iteration API of Graph (forNodes, forNeighborsOf,
+ * forEdges, parallelForEdges, ...) with the same lambda signatures, so code templated on the graph
+ * type (e.g., the helpers in graph/BFS.hpp, graph/DFS.hpp and graph/Dijkstra.hpp) can be
+ * instantiated on it. Node ids, the order of neighbors, edge weights and edge ids are identical to
+ * the Graph the instance was created from.
+ *
+ * Copies of a CSRGraph share the (immutable) underlying arrays. A CSRGraph can also be a view on a
+ * memory-mapped file, see NetworkitBinaryReader::readCSR.
+ */
+class CSRGraph final {
+public:
+    /**
+     * Creates a CSR snapshot of @a G. The snapshot is computed in parallel and does not keep a
+     * reference to @a G.
+     *
+     * @param G The input graph.
+     */
+    explicit CSRGraph(const Graph &G);
+
+    /**
+     * Creates an empty graph.
+     */
+    CSRGraph() = default;
+
+    /**
+     * Return the number of nodes in the graph.
+     */
+    count numberOfNodes() const noexcept { return n; }
+
+    /**
+     * Return the number of edges in the graph.
+     */
+    count numberOfEdges() const noexcept { return m; }
+
+    /**
+     * Return the number of self-loops in the graph.
+     */
+    count numberOfSelfLoops() const noexcept { return storedNumberOfSelfLoops; }
+
+    /**
+     * Get an upper bound for the node ids in the graph.
+     */
+    index upperNodeIdBound() const noexcept { return z; }
+
+    /**
+     * Get an upper bound for the edge ids in the graph.
+     */
+    index upperEdgeIdBound() const noexcept { return omega; }
+
+    bool isWeighted() const noexcept { return weighted; }
+
+    bool isDirected() const noexcept { return directed; }
+
+    bool hasEdgeIds() const noexcept { return edgesIndexed; }
+
+    /**
+     * Check if node @a v exists in the graph.
+     */
+    bool hasNode(node v) const noexcept { return v < z && exists[v]; }
+
+    /**
+     * Returns the number of outgoing neighbors of @a v.
+     */
+    count degree(node v) const {
+        assert(v < z);
+        return outOffsets[v + 1] - outOffsets[v];
+    }
+
+    /**
+     * Returns the number of outgoing neighbors of @a v.
+     */
+    count degreeOut(node v) const { return degree(v); }
+
+    /**
+     * Returns the number of incoming neighbors of @a v. If the graph is not directed, the
+     * outgoing degree is returned.
+     */
+    count degreeIn(node v) const {
+        assert(v < z);
+        return directed ? inOffsets[v + 1] - inOffsets[v] : degree(v);
+    }
+
+    /**
+     * Check whether @a v is isolated, i.e. degree is 0.
+     */
+    bool isIsolated(node v) const { return degree(v) == 0 && (!directed || degreeIn(v) == 0); }
+
+    /**
+     * Returns the weighted (out-)degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegree(node u, bool countSelfLoopsTwice = false) const {
+        return computeWeightedDegree(u, false, countSelfLoopsTwice);
+    }
+
+    /**
+     * Returns the weighted in-degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegreeIn(node u, bool countSelfLoopsTwice = false) const {
+        return computeWeightedDegree(u, true, countSelfLoopsTwice);
+    }
+
+    /**
+     * Checks if the edge (@a u, @a v) exists. Runs in O(deg(u)).
+     */
+    bool hasEdge(node u, node v) const noexcept;
+
+    /**
+     * Returns the weight of edge (@a u, @a v), or nullWeight if the edge does not exist.
+     */
+    edgeweight weight(node u, node v) const;
+
+    /**
+     * Returns the sum of all edge weights.
+     */
+    edgeweight totalEdgeWeight() const noexcept;
+
+    /**
+     * Return the i-th (outgoing) neighbor of @a u, or @c none if no such neighbor exists.
+     */
+    node getIthNeighbor(node u, index i) const {
+        if (!hasNode(u) || i >= degree(u))
+            return none;
+        return outTargets[outOffsets[u] + i];
+    }
+
+    /**
+     * Return the i-th (incoming) neighbor of @a u, or @c none if no such neighbor exists.
+     */
+    node getIthInNeighbor(node u, index i) const {
+        if (!directed)
+            return getIthNeighbor(u, i);
+        if (!hasNode(u) || i >= degreeIn(u))
+            return none;
+        return inTargets[inOffsets[u] + i];
+    }
+
+    /**
+     * Return the weight to the i-th (outgoing) neighbor of @a u, or nullWeight if no such
+     * neighbor exists.
+     */
+    edgeweight getIthNeighborWeight(node u, index i) const {
+        if (!hasNode(u) || i >= degree(u))
+            return nullWeight;
+        return weighted ? outWeights[outOffsets[u] + i] : defaultEdgeWeight;
+    }
+
+    /**
+     * Returns the (outgoing) neighbors of @a u as a contiguous range [first, last).
+     */
+    std::pair<const node *, const node *> neighborRange(node u) const {
+        assert(u < z);
+        return {outTargets + outOffsets[u], outTargets + outOffsets[u + 1]};
+    }
+
+    /**
+     * Returns the incoming neighbors of @a u as a contiguous range [first, last).
+     */
+    std::pair<const node *, const node *> inNeighborRange(node u) const {
+        if (!directed)
+            return neighborRange(u);
+        assert(u < z);
+        return {inTargets + inOffsets[u], inTargets + inOffsets[u + 1]};
+    }
+
+    /* NODE ITERATORS */
+
+    /**
+     * Iterate over all nodes of the graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void forNodes(L handle) const;
+
+    /**
+     * Iterate in parallel over all nodes of the graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void parallelForNodes(L handle) const;
+
+    /**
+     * Iterate in parallel over all nodes of the graph using a guided schedule.
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void balancedParallelForNodes(L handle) const;
+
+    /**
+     * Iterate over all nodes of the graph and call @a handle as long as @a condition remains
+     * true.
+     */
+    template <typename C, typename L>
+    void forNodesWhile(C condition, L handle) const;
+
+    /**
+     * Sum up the values returned by @a handle for all nodes in parallel.
+     */
+    template <typename L>
+    double parallelSumForNodes(L handle) const;
+
+    /* EDGE ITERATORS */
+
+    /**
+     * Iterate over all edges of the const graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node,
+     * edgweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight,
+     * edgeid)</code>.
+     */
+    template <typename L>
+    void forEdges(L handle) const;
+
+    /**
+     * Iterate in parallel over all edges of the const graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node,
+     * edgweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight,
+     * edgeid)</code>.
+     */
+    template <typename L>
+    void parallelForEdges(L handle) const;
+
+    /**
+     * Sum up the values returned by @a handle for all edges in parallel.
+     */
+    template <typename L>
+    double parallelSumForEdges(L handle) const;
+
+    /* NEIGHBORHOOD ITERATORS */
+
+    /**
+     * Iterate over all neighbors of a node and call @a handle (lamdba closure).
+     *
+     * @param u Node.
+     * @param handle Takes parameter <code>(node)</code> or <code>(node, edgeweight)</code> which
+     * is a neighbor of @a u.
+     * @note For directed graphs only outgoing edges from @a u are considered.
+     */
+    template <typename L>
+    void forNeighborsOf(node u, L handle) const;
+
+    /**
+     * Iterate over all incident edges of a node and call @a handle (lamdba closure).
+     *
+     * @param u Node.
+     * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node,
+     * edgeweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight,
+     * edgeid)</code> where the first node is @a u and the second is a neighbor of @a u.
+     * @note For undirected graphs all edges incident to @a u are also outgoing edges.
+     */
+    template <typename L>
+    void forEdgesOf(node u, L handle) const;
+
+    /**
+     * Iterate over all neighbors of a node and call handler (lamdba closure). For directed graphs
+     * only incoming edges from u are considered.
+     */
+    template <typename L>
+    void forInNeighborsOf(node u, L handle) const;
+
+    /**
+     * Iterate over all incoming edges of a node and call handler (lamdba closure).
+     *
+     * @note For undirected graphs all edges incident to u are also incoming edges.
+     */
+    template <typename L>
+    void forInEdgesOf(node u, L handle) const;
+
+private:
+    friend class NetworkitBinaryReader;
+    friend class NetworkitBinaryWriter;
+
+    count n = 0;
+    count m = 0;
+    count storedNumberOfSelfLoops = 0;
+    node z = 0;
+    edgeid omega = 0;
+
+    bool weighted = false;
+    bool directed = false;
+    bool edgesIndexed = false;
+
+    //!< Keeps the memory the arrays below point to alive. This is either heap memory owned by
+    //!< the graph (shared between copies, as it is never modified) or a memory-mapped file.
+    std::shared_ptr<const void> storage;
+
+    //!< exists[v] is non-zero if node v has not been removed from the graph
+    const uint8_t *exists = nullptr;
+
+    //!< outOffsets[u] is the position of the first outgoing edge of u in outTargets, size z + 1
+    const index *outOffsets = &emptyOffset;
+    const node *outTargets = nullptr;
+    //!< same layout as outTargets, nullptr if the graph is unweighted
+    const edgeweight *outWeights = nullptr;
+    //!< same layout as outTargets, nullptr if the graph has no edge ids
+    const edgeid *outEdgeIds = nullptr;
+
+    //!< incoming edges, only used for directed graphs; same schema as the outgoing arrays
+    const index *inOffsets = nullptr;
+    const node *inTargets = nullptr;
+    const edgeweight *inWeights = nullptr;
+    const edgeid *inEdgeIds = nullptr;
+
+    static constexpr index emptyOffset = 0;
+
+    edgeweight computeWeightedDegree(node u, bool inDegree, bool countSelfLoopsTwice) const;
+
+    template <bool hasWeights>
+    static edgeweight getWeightAt(const edgeweight *weights, index i) {
+        return hasWeights ? weights[i] : defaultEdgeWeight;
+    }
+
+    template <bool graphHasEdgeIds>
+    static edgeid getEdgeIdAt(const edgeid *ids, index i) {
+        return graphHasEdgeIds ? ids[i] : none;
+    }
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    void forOutEdgesOfImpl(node u, L &handle) const;
+
+    template <bool hasWeights, bool graphHasEdgeIds, typename L>
+    void forInEdgesOfImpl(node u, L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    void forEdgeImpl(L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    void parallelForEdgesImpl(L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    double parallelSumForEdgesImpl(L &handle) const;
+
+    /*
+     * The edgeLambda overloads select the lambda signature in the same way as
+     * Graph::edgeLambda, see the comment there for details.
+     */
+    template <class F, void * = (void *)0>
+    typename Aux::FunctionTraits<F>::result_type edgeLambda(F &, ...) const {
+        static_assert(!std::is_same<F, F>::value,
+                      "Your lambda does not support the required parameters or the "
+                      "parameters have the wrong type.");
+        return std::declval<typename Aux::FunctionTraits<F>::result_type>();
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 3)
+                  && std::is_same<edgeweight,
+                                  typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+                  && std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::
+                      value>::type * = (void *)0>
+    auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) const
+        -> decltype(f(u, v, ew, id)) {
+        return f(u, v, ew, id);
+    }
+
+    template <
+        class F,
+        typename std::enable_if<
+            (Aux::FunctionTraits<F>::arity >= 2)
+            && std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+            && std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value>::
+            type * = (void *)0>
+    auto edgeLambda(F &f, node u, node v, edgeweight, edgeid id) const -> decltype(f(u, v, id)) {
+        return f(u, v, id);
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 2)
+                  && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
+                                                  2>::type>::value>::type * = (void *)0>
+    auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid /*id*/) const
+        -> decltype(f(u, v, ew)) {
+        return f(u, v, ew);
+    }
+
+    template <class F, typename std::enable_if<
+                           (Aux::FunctionTraits<F>::arity >= 1)
+                           && std::is_same<node, typename Aux::FunctionTraits<F>::template arg<
+                                                     1>::type>::value>::type * = (void *)0>
+    auto edgeLambda(F &f, node u, node v, edgeweight /*ew*/, edgeid /*id*/) const
+        -> decltype(f(u, v)) {
+        return f(u, v);
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 1)
+                  && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
+                                                  1>::type>::value>::type * = (void *)0>
+    auto edgeLambda(F &f, node, node v, edgeweight ew, edgeid /*id*/) const -> decltype(f(v, ew)) {
+        return f(v, ew);
+    }
+
+    template <class F, void * = (void *)0>
+    auto edgeLambda(F &f, node, node v, edgeweight, edgeid) const -> decltype(f(v)) {
+        return f(v);
+    }
+};
+
+/* NODE ITERATORS */
+
+template <typename L>
+void CSRGraph::forNodes(L handle) const {
+    for (node v = 0; v < z; ++v) {
+        if (exists[v]) {
+            handle(v);
+        }
+    }
+}
+
+template <typename L>
+void CSRGraph::parallelForNodes(L handle) const {
+#pragma omp parallel for
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (exists[v]) {
+            handle(v);
+        }
+    }
+}
+
+template <typename L>
+void CSRGraph::balancedParallelForNodes(L handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (exists[v]) {
+            handle(v);
+        }
+    }
+}
+
+template <typename C, typename L>
+void CSRGraph::forNodesWhile(C condition, L handle) const {
+    for (node v = 0; v < z; ++v) {
+        if (exists[v]) {
+            if (!condition()) {
+                break;
+            }
+            handle(v);
+        }
+    }
+}
+
+template <typename L>
+double CSRGraph::parallelSumForNodes(L handle) const {
+    double sum = 0.0;
+
+#pragma omp parallel for reduction(+ : sum)
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (exists[v]) {
+            sum += handle(v);
+        }
+    }
+
+    return sum;
+}
+
+/* EDGE ITERATORS */
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+void CSRGraph::forOutEdgesOfImpl(node u, L &handle) const {
+    for (index i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+        const node v = outTargets[i];
+        // undirected: visit each edge {u, v} only once
+        if (graphIsDirected || u >= v) {
+            edgeLambda<L>(handle, u, v, getWeightAt<hasWeights>(outWeights, i),
+                          getEdgeIdAt<graphHasEdgeIds>(outEdgeIds, i));
+        }
+    }
+}
+
+template <bool hasWeights, bool graphHasEdgeIds, typename L>
+void CSRGraph::forInEdgesOfImpl(node u, L &handle) const {
+    if (directed) {
+        for (index i = inOffsets[u]; i < inOffsets[u + 1]; ++i) {
+            edgeLambda<L>(handle, u, inTargets[i], getWeightAt<hasWeights>(inWeights, i),
+                          getEdgeIdAt<graphHasEdgeIds>(inEdgeIds, i));
+        }
+    } else {
+        forOutEdgesOfImpl<true, hasWeights, graphHasEdgeIds, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+void CSRGraph::forEdgeImpl(L &handle) const {
+    for (node u = 0; u < z; ++u) {
+        forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+void CSRGraph::parallelForEdgesImpl(L &handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+double CSRGraph::parallelSumForEdgesImpl(L &handle) const {
+    double sum = 0.0;
+
+#pragma omp parallel for reduction(+ : sum) schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        for (index i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+            const node v = outTargets[i];
+            if (graphIsDirected || static_cast<node>(u) >= v) {
+                sum += edgeLambda<L>(handle, u, v, getWeightAt<hasWeights>(outWeights, i),
+                                     getEdgeIdAt<graphHasEdgeIds>(outEdgeIds, i));
+            }
+        }
+    }
+
+    return sum;
+}
+
+template <typename L>
+void CSRGraph::forEdges(L handle) const {
+    switch (weighted + 2 * directed + 4 * edgesIndexed) {
+    case 0: // unweighted, undirected, no edgeIds
+        forEdgeImpl<false, false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected, no edgeIds
+        forEdgeImpl<false, true, false, L>(handle);
+        break;
+
+    case 2: // unweighted, directed, no edgeIds
+        forEdgeImpl<true, false, false, L>(handle);
+        break;
+
+    case 3: // weighted, directed, no edgeIds
+        forEdgeImpl<true, true, false, L>(handle);
+        break;
+
+    case 4: // unweighted, undirected, with edgeIds
+        forEdgeImpl<false, false, true, L>(handle);
+        break;
+
+    case 5: // weighted,   undirected, with edgeIds
+        forEdgeImpl<false, true, true, L>(handle);
+        break;
+
+    case 6: // unweighted, directed, with edgeIds
+        forEdgeImpl<true, false, true, L>(handle);
+        break;
+
+    case 7: // weighted,   directed, with edgeIds
+        forEdgeImpl<true, true, true, L>(handle);
+        break;
+    }
+}
+
+template <typename L>
+void CSRGraph::parallelForEdges(L handle) const {
+    switch (weighted + 2 * directed + 4 * edgesIndexed) {
+    case 0: // unweighted, undirected, no edgeIds
+        parallelForEdgesImpl<false, false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected, no edgeIds
+        parallelForEdgesImpl<false, true, false, L>(handle);
+        break;
+
+    case 2: // unweighted, directed, no edgeIds
+        parallelForEdgesImpl<true, false, false, L>(handle);
+        break;
+
+    case 3: // weighted, directed, no edgeIds
+        parallelForEdgesImpl<true, true, false, L>(handle);
+        break;
+
+    case 4: // unweighted, undirected, with edgeIds
+        parallelForEdgesImpl<false, false, true, L>(handle);
+        break;
+
+    case 5: // weighted,   undirected, with edgeIds
+        parallelForEdgesImpl<false, true, true, L>(handle);
+        break;
+
+    case 6: // unweighted, directed, with edgeIds
+        parallelForEdgesImpl<true, false, true, L>(handle);
+        break;
+
+    case 7: // weighted,   directed, with edgeIds
+        parallelForEdgesImpl<true, true, true, L>(handle);
+        break;
+    }
+}
+
+template <typename L>
+double CSRGraph::parallelSumForEdges(L handle) const {
+    switch (weighted + 2 * directed + 4 * edgesIndexed) {
+    case 0: // unweighted, undirected, no edge ids
+        return parallelSumForEdgesImpl<false, false, false, L>(handle);
+    case 1: // weighted,   undirected, no edge ids
+        return parallelSumForEdgesImpl<false, true, false, L>(handle);
+    case 2: // unweighted, directed, no edge ids
+        return parallelSumForEdgesImpl<true, false, false, L>(handle);
+    case 3: // weighted,   directed, no edge ids
+        return parallelSumForEdgesImpl<true, true, false, L>(handle);
+    case 4: // unweighted, undirected, with edge ids
+        return parallelSumForEdgesImpl<false, false, true, L>(handle);
+    case 5: // weighted,   undirected, with edge ids
+        return parallelSumForEdgesImpl<false, true, true, L>(handle);
+    case 6: // unweighted, directed, with edge ids
+        return parallelSumForEdgesImpl<true, false, true, L>(handle);
+    default: // weighted,   directed, with edge ids
+        return parallelSumForEdgesImpl<true, true, true, L>(handle);
+    }
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template <typename L>
+void CSRGraph::forNeighborsOf(node u, L handle) const {
+    forEdgesOf(u, handle);
+}
+
+template <typename L>
+void CSRGraph::forEdgesOf(node u, L handle) const {
+    switch (weighted + 2 * edgesIndexed) {
+    case 0: // not weighted, no edge ids
+        forOutEdgesOfImpl<true, false, false, L>(u, handle);
+        break;
+
+    case 1: // weighted, no edge ids
+        forOutEdgesOfImpl<true, true, false, L>(u, handle);
+        break;
+
+    case 2: // not weighted, with edge ids
+        forOutEdgesOfImpl<true, false, true, L>(u, handle);
+        break;
+
+    case 3: // weighted, with edge ids
+        forOutEdgesOfImpl<true, true, true, L>(u, handle);
+        break;
+    }
+}
+
+template <typename L>
+void CSRGraph::forInNeighborsOf(node u, L handle) const {
+    forInEdgesOf(u, handle);
+}
+
+template <typename L>
+void CSRGraph::forInEdgesOf(node u, L handle) const {
+    switch (weighted + 2 * edgesIndexed) {
+    case 0: // not weighted, no edge ids
+        forInEdgesOfImpl<false, false, L>(u, handle);
+        break;
+
+    case 1: // weighted, no edge ids
+        forInEdgesOfImpl<true, false, L>(u, handle);
+        break;
+
+    case 2: // not weighted, with edge ids
+        forInEdgesOfImpl<false, true, L>(u, handle);
+        break;
+
+    case 3: // weighted, with edge ids
+        forInEdgesOfImpl<true, true, L>(u, handle);
+        break;
+    }
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_CSR_GRAPH_HPP_
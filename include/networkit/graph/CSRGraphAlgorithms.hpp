@@ -0,0 +1,216 @@
+/*
+ * CSRGraphAlgorithms.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_CSR_GRAPH_ALGORITHMS_HPP_
+#define NETWORKIT_GRAPH_CSR_GRAPH_ALGORITHMS_HPP_
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <omp.h>
+
+#include <networkit/algebraic/PullSpMV.hpp>
+#include <networkit/centrality/Betweenness.hpp>
+#include <networkit/centrality/PageRank.hpp>
+#include <networkit/graph/BFS.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/Dijkstra.hpp>
+
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Entry points of basic graph algorithms for a CSRGraph; the Algorithm classes (BFS, Dijkstra,
+ * ConnectedComponents, PageRank and Betweenness) only accept a Graph. The functions are templates
+ * on the graph type and also run on a Graph. pageRank and betweenness on unweighted graphs call
+ * the kernels of PageRank and Betweenness; the other functions are reduced versions built on the
+ * traversal kernels of graph/BFS.hpp and graph/Dijkstra.hpp, see their documentation for the
+ * differences.
+ */
+namespace CSRGraphAlgorithms {
+
+/**
+ * Runs the BFS kernel Traversal::BFSfrom from @a source.
+ *
+ * @return The number of edges on a shortest path from @a source to every node, or
+ * std::numeric_limits<edgeweight>::max() if there is no path (as returned by BFS::getDistances).
+ */
+template <class GraphType>
+std::vector<edgeweight> bfsDistances(const GraphType &G, node source) {
+    std::vector<edgeweight> distances(G.upperNodeIdBound(),
+                                      std::numeric_limits<edgeweight>::max());
+    Traversal::BFSfrom(G, source,
+                       [&](node u, count dist) { distances[u] = static_cast<edgeweight>(dist); });
+    return distances;
+}
+
+/**
+ * Runs the Dijkstra kernel Traversal::DijkstraFrom from @a source.
+ *
+ * @return The length of a shortest path from @a source to every node, or
+ * std::numeric_limits<edgeweight>::max() if there is no path (as returned by
+ * Dijkstra::getDistances).
+ */
+template <class GraphType>
+std::vector<edgeweight> dijkstraDistances(const GraphType &G, node source) {
+    std::vector<edgeweight> distances(G.upperNodeIdBound(),
+                                      std::numeric_limits<edgeweight>::max());
+    Traversal::DijkstraFrom(G, source, [&](node u, edgeweight dist) { distances[u] = dist; });
+    return distances;
+}
+
+/**
+ * Computes the connected components of an undirected graph by one Traversal::BFSfrom per
+ * component. Unlike ConnectedComponents, it returns the plain component ids instead of a
+ * Partition.
+ *
+ * @param[out] numberOfComponents The number of components.
+ * @return The component id (in [0, numberOfComponents)) of every node, none for ids of
+ * non-existing nodes.
+ */
+template <class GraphType>
+std::vector<index> connectedComponents(const GraphType &G, count &numberOfComponents) {
+    if (G.isDirected())
+        throw std::runtime_error(
+            "Error, connected components of directed graphs cannot be "
+            "computed, use StronglyConnectedComponents or WeaklyConnectedComponents instead.");
+
+    std::vector<index> component(G.upperNodeIdBound(), none);
+    numberOfComponents = 0;
+    G.forNodes([&](node u) {
+        if (component[u] != none)
+            return;
+        Traversal::BFSfrom(G, u, [&](node v) { component[v] = numberOfComponents; });
+        ++numberOfComponents;
+    });
+    return component;
+}
+
+/**
+ * Computes PageRank with the kernel of PageRank, see PageRank::PageRank for the parameters and
+ * PageRank::maxIterations, PageRank::norm and PageRank::precision for the options.
+ *
+ * @return The PageRank score of every node, 0 for ids of non-existing nodes.
+ */
+template <class GraphType>
+std::vector<double>
+pageRank(const GraphType &G, double damp = 0.85, double tol = 1e-8, bool normalized = false,
+         PageRank::SinkHandling distributeSinks = PageRank::SinkHandling::NO_SINK_HANDLING,
+         PageRank::Norm norm = PageRank::Norm::L2_NORM,
+         count maxIterations = std::numeric_limits<count>::max(),
+         SpMVPrecision precision = SpMVPrecision::DOUBLE) {
+    std::vector<double> scores(G.upperNodeIdBound(),
+                               1.0 / static_cast<double>(G.numberOfNodes()));
+    if (precision == SpMVPrecision::SINGLE)
+        PageRank::computeScores<float>(G, damp, tol, normalized, distributeSinks, norm,
+                                       maxIterations, scores);
+    else
+        PageRank::computeScores<double>(G, damp, tol, normalized, distributeSinks, norm,
+                                        maxIterations, scores);
+
+    for (node u = 0; u < G.upperNodeIdBound(); ++u)
+        if (!G.hasNode(u))
+            scores[u] = 0.;
+    return scores;
+}
+
+/**
+ * Computes the exact betweenness of all nodes like Betweenness (shortest paths by number of
+ * edges for unweighted graphs and by length for weighted graphs). Unweighted graphs use the
+ * batched kernel of Betweenness with the batch size for its default memory budget.
+ *
+ * Weighted graphs run a reduced version of the Dijkstra-based computation of Betweenness: there
+ * is no memory budget and no edge betweenness, and path counts are stored as doubles, so they can
+ * overflow on graphs with exponentially many shortest paths. The sources are processed in
+ * parallel; each thread keeps three arrays of upperNodeIdBound() entries, which it reuses for all
+ * of its sources.
+ *
+ * @param normalized If true, the scores are divided by the number of pairs of other nodes.
+ * @return The betweenness of every node, 0 for ids of non-existing nodes.
+ */
+template <class GraphType>
+std::vector<double> betweenness(const GraphType &G, bool normalized = false) {
+    const count z = G.upperNodeIdBound();
+    std::vector<double> scores(z, 0.);
+
+    if (!G.isWeighted()) {
+        const count k = Betweenness::batchSizeFor(z, Betweenness::defaultMemoryBudget);
+        Betweenness::computeBatched(G, k, scores, nullptr);
+    } else {
+#pragma omp parallel
+        {
+            std::vector<edgeweight> dist(z, std::numeric_limits<edgeweight>::max());
+            std::vector<double> sigma(z, 0.), delta(z, 0.);
+            std::vector<node> order;
+            order.reserve(z);
+            const auto closer = [&dist](node u, node v) noexcept { return dist[u] < dist[v]; };
+            tlx::d_ary_addressable_int_heap<node, 2, decltype(closer)> heap{closer};
+
+#pragma omp for schedule(dynamic, 16)
+            for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+                const node s = static_cast<node>(i);
+                if (!G.hasNode(s))
+                    continue;
+
+                // order collects the reached nodes by non-decreasing distance
+                dist[s] = 0;
+                sigma[s] = 1.;
+                order.clear();
+                heap.push(s);
+                while (!heap.empty()) {
+                    const node u = heap.extract_top();
+                    order.push_back(u);
+                    G.forNeighborsOf(u, [&](node v, edgeweight w) {
+                        if (v == u)
+                            return;
+                        const edgeweight d = dist[u] + w;
+                        if (d < dist[v]) {
+                            dist[v] = d;
+                            sigma[v] = sigma[u];
+                            heap.update(v);
+                        } else if (d == dist[v]) {
+                            sigma[v] += sigma[u];
+                        }
+                    });
+                }
+
+                // accumulate the dependencies from the successors on shortest paths
+                for (index k = order.size(); k-- > 0;) {
+                    const node u = order[k];
+                    G.forNeighborsOf(u, [&](node v, edgeweight w) {
+                        if (v != u && dist[v] == dist[u] + w)
+                            delta[u] += sigma[u] / sigma[v] * (1. + delta[v]);
+                    });
+                    if (u != s) {
+#pragma omp atomic
+                        scores[u] += delta[u];
+                    }
+                }
+
+                for (const node u : order) {
+                    dist[u] = std::numeric_limits<edgeweight>::max();
+                    sigma[u] = 0.;
+                    delta[u] = 0.;
+                }
+            }
+        }
+    }
+
+    if (normalized) {
+        const double n = static_cast<double>(G.numberOfNodes());
+        const double pairs = (n - 2.) * (n - 1.);
+        G.parallelForNodes([&](node u) { scores[u] /= pairs; });
+    }
+    return scores;
+}
+
+} // namespace CSRGraphAlgorithms
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_CSR_GRAPH_ALGORITHMS_HPP_
@@ -14,12 +14,12 @@ namespace Traversal {
 /**
  * Iterate over nodes in depth-first search order starting from the given source node.
  *
- * @param G The input graph.
+ * @param G The input graph (a Graph or a CSRGraph).
  * @param source The source node.
  * @param handle Takes a node as input parameter.
  */
-template <typename L>
-void DFSfrom(const Graph &G, node source, L handle) {
+template <class GraphType, typename L>
+void DFSfrom(const GraphType &G, node source, L handle) {
     std::vector<bool> marked(G.upperNodeIdBound());
     std::stack<node> s;
     s.push(source); // enqueue root
@@ -41,12 +41,12 @@ void DFSfrom(const Graph &G, node source, L handle) {
 /**
  * Iterate over edges in depth-first search order starting from the given source node.
  *
- * @param G The input graph.
+ * @param G The input graph (a Graph or a CSRGraph).
  * @param source The source node.
  * @param handle Takes a node as input parameter.
  */
-template <typename L>
-void DFSEdgesFrom(const Graph &G, node source, L handle) {
+template <class GraphType, typename L>
+void DFSEdgesFrom(const GraphType &G, node source, L handle) {
     std::vector<bool> marked(G.upperNodeIdBound());
     std::stack<node> s;
     s.push(source); // enqueue root
@@ -32,13 +32,13 @@ auto callDijkstraHandle(F &f, node u, edgeweight) -> decltype(f(u)) {
 /**
  * Iterate over nodes with Dijkstra starting from the nodes within the given range.
  *
- * @param G The input graph.
+ * @param G The input graph (a Graph or a CSRGraph).
  * @param first The first element of the range.
  * @param last The end of the range.
  * @param lambda Takes a node and its distance from the nodes in the range as input parameters.
  */
-template <class InputIt, typename Handle>
-void DijkstraFrom(const Graph &G, InputIt first, InputIt last, Handle handle) {
+template <class GraphType, class InputIt, typename Handle>
+void DijkstraFrom(const GraphType &G, InputIt first, InputIt last, Handle handle) {
     std::vector<edgeweight> distance(G.upperNodeIdBound(), std::numeric_limits<edgeweight>::max());
     const auto compareDistance = [&distance](node u, node v) noexcept -> bool {
         return distance[u] < distance[v];
@@ -66,12 +66,12 @@ void DijkstraFrom(const Graph &G, InputIt first, InputIt last, Handle handle) {
 /**
  * Iterate over nodes with Dijkstra starting from the nodes within the given range.
  *
- * @param G The input graph.
+ * @param G The input graph (a Graph or a CSRGraph).
  * @param u The source node.
  * @param lambda Takes a node and its distance from `u` as input parameters.
  */
-template <typename Lambda>
-void DijkstraFrom(const Graph &G, node u, Lambda lambda) {
+template <class GraphType, typename Lambda>
+void DijkstraFrom(const GraphType &G, node u, Lambda lambda) {
     std::vector<node> vec({u});
     DijkstraFrom(G, vec.begin(), vec.end(), lambda);
 }
@@ -2,6 +2,7 @@
 #ifndef NETWORKIT_GRAPH_GRAPH_TOOLS_HPP_
 #define NETWORKIT_GRAPH_GRAPH_TOOLS_HPP_
 
+#include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -482,7 +483,9 @@ void randomizeWeights(Graph &G, Distribution distr = std::uniform_real_distribut
 
 /**
  * Rename nodes in a graph using a callback which translates each old id to a new one.
- * For each node u in input graph, oldIdToNew(u) < numNodes.
+ * For each node u in input graph, oldIdToNew(u) < numNodes, and no two nodes that are not
+ * skipped are mapped to the same id; otherwise, a std::runtime_error is thrown. The adjacency
+ * lists of the new graph are built in parallel.
  *
  * @param graph Input graph.
  * @param numNodes    Number of nodes in the output graph.
@@ -492,36 +495,63 @@ void randomizeWeights(Graph &G, Distribution distr = std::uniform_real_distribut
  * @param preallocate Preallocates memory before adding neighbors
  *                    (Preallocation does not account for deleted nodes
  *                    and hence may need more memory)
- *
- * @node preallocate is currently not implemented
  */
 template <typename UnaryIdMapper, typename SkipEdgePredicate>
 Graph getRemappedGraph(const Graph &graph, count numNodes, UnaryIdMapper &&oldIdToNew,
                        SkipEdgePredicate &&skipNode, bool preallocate = true) {
-    tlx::unused(preallocate); // TODO: Add perallocate as soon as Graph supports it
-
-#ifndef NDEBUG
-    graph.forNodes([&](node u) { assert(skipNode(u) || oldIdToNew(u) < numNodes); });
-#endif // NDEBUG
+    // The adjacency lists are filled in parallel below, which is only safe if no two nodes are
+    // mapped to the same id.
+    std::vector<bool> isMapped(numNodes);
+    graph.forNodes([&](node u) {
+        if (skipNode(u))
+            return;
+        const node mapped = oldIdToNew(u);
+        if (mapped >= numNodes || isMapped[mapped])
+            throw std::runtime_error("oldIdToNew must map the nodes to distinct ids in "
+                                     "[0, numNodes).");
+        isMapped[mapped] = true;
+    });
 
     const auto directed = graph.isDirected();
     Graph Gnew(numNodes, graph.isWeighted(), directed);
 
-    graph.forNodes([&](const node u) { // TODO: Make parallel when graph support addHalfEdge
-        if (skipNode(u))
-            return;
+    // Each node of Gnew has a single preimage, so its adjacency lists are written by one thread.
+    count halfEdges = 0, selfLoops = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : halfEdges, selfLoops)
+    for (omp_index u = 0; u < static_cast<omp_index>(graph.upperNodeIdBound()); ++u) {
+        if (!graph.hasNode(u) || skipNode(u))
+            continue;
 
         const node mapped_u = oldIdToNew(u);
+        if (preallocate) {
+            if (directed)
+                Gnew.preallocateDirected(mapped_u, graph.degreeOut(u), graph.degreeIn(u));
+            else
+                Gnew.preallocateUndirected(mapped_u, graph.degree(u));
+        }
+
         graph.forNeighborsOf(u, [&](node, node v, edgeweight ew) {
-            if (!directed && v < u)
-                return;
             if (skipNode(v))
                 return;
-
             const node mapped_v = oldIdToNew(v);
-            Gnew.addEdge(mapped_u, mapped_v, ew);
+            if (directed)
+                Gnew.addPartialOutEdge(unsafe, mapped_u, mapped_v, ew);
+            else
+                Gnew.addPartialEdge(unsafe, mapped_u, mapped_v, ew);
+            ++halfEdges;
+            selfLoops += (u == v);
         });
-    });
+
+        if (directed)
+            graph.forInNeighborsOf(u, [&](node, node v, edgeweight ew) {
+                if (!skipNode(v))
+                    Gnew.addPartialInEdge(unsafe, mapped_u, oldIdToNew(v), ew);
+            });
+    }
+
+    // In undirected graphs, every edge except for self-loops was added from both endpoints.
+    Gnew.setEdgeCount(unsafe, directed ? halfEdges : (halfEdges + selfLoops) / 2);
+    Gnew.setNumberOfSelfLoops(unsafe, selfLoops);
 
     return Gnew;
 }
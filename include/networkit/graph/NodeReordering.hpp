@@ -0,0 +1,92 @@
+/*
+ * NodeReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_NODE_REORDERING_HPP_
+#define NETWORKIT_GRAPH_NODE_REORDERING_HPP_
+
+#include <type_traits>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Node orderings that improve the memory locality of graph algorithms. Each ordering is returned
+ * as a permutation oldToNew with G.upperNodeIdBound() entries: oldToNew[u] is the new id of node
+ * u, new ids are continuous (0 to G.numberOfNodes() - 1), and oldToNew[u] == none if u does not
+ * exist. Use apply() to relabel the graph and mapToOriginal() to translate per-node results of an
+ * algorithm on the relabeled graph back to the original ids.
+ *
+ * Directed graphs are treated as undirected, i.e., both out- and in-neighbors are considered.
+ */
+namespace NodeReordering {
+
+/**
+ * Orders the nodes by decreasing degree; ties are broken by node id.
+ */
+std::vector<node> degreeDescending(const Graph &G);
+
+/**
+ * Orders the nodes in breadth-first search order. Each connected component is explored from its
+ * node with the highest degree.
+ */
+std::vector<node> breadthFirst(const Graph &G);
+
+/**
+ * Reverse Cuthill-McKee ordering, which reduces the bandwidth of the adjacency matrix. Each
+ * connected component is explored from a node of minimum degree, and the unvisited neighbors of a
+ * node are visited in order of increasing degree. The final order is reversed.
+ */
+std::vector<node> reverseCuthillMcKee(const Graph &G);
+
+/**
+ * Places the nodes of each community next to each other, similar to Rabbit Order. The communities
+ * are ordered by their first node in breadth-first order, and the nodes of a community keep their
+ * breadth-first order. Nodes that are not assigned to a community are placed at the end.
+ *
+ * @param G The graph.
+ * @param communities A partition of the nodes, e.g., computed by PLM.
+ */
+std::vector<node> communityOrder(const Graph &G, const Partition &communities);
+
+/**
+ * Returns the inverse permutation newToOld with numberOfNodes() entries.
+ */
+std::vector<node> invert(const std::vector<node> &oldToNew);
+
+/**
+ * Returns a copy of @a G in which each node u is renamed to oldToNew[u]. The graph is built in
+ * parallel.
+ */
+Graph apply(const Graph &G, const std::vector<node> &oldToNew);
+
+/**
+ * Maps per-node values computed on a relabeled graph back to the original node ids. Non-existing
+ * nodes get a default-constructed value.
+ *
+ * @param values Values indexed by new node ids.
+ * @param oldToNew The permutation that was passed to apply().
+ * @return Values indexed by original node ids.
+ */
+template <typename T>
+std::vector<T> mapToOriginal(const std::vector<T> &values, const std::vector<node> &oldToNew) {
+    static_assert(!std::is_same<T, bool>::value, "std::vector<bool> cannot be written in parallel");
+    std::vector<T> result(oldToNew.size());
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(oldToNew.size()); ++u)
+        if (oldToNew[u] != none)
+            result[u] = values[oldToNew[u]];
+    return result;
+}
+
+} // namespace NodeReordering
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_NODE_REORDERING_HPP_
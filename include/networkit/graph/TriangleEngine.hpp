@@ -0,0 +1,242 @@
+/*
+ * TriangleEngine.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_TRIANGLE_ENGINE_HPP_
+#define NETWORKIT_GRAPH_TRIANGLE_ENGINE_HPP_
+
+#include <algorithm>
+#include <vector>
+#include <omp.h>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Counts and lists the triangles of an undirected graph. Each edge is oriented from the endpoint
+ * with the smaller degree to the one with the larger degree (ties are broken by node id), so
+ * every node has at most O(sqrt(m)) out-neighbors. The out-neighbors are stored in a CSR
+ * structure sorted by this order; a triangle u < v < w is then found exactly once as an element of
+ * the intersection of the out-neighbors of u and v, see [0].
+ *
+ * Short lists are intersected by a branch-free merge, lists of very different length by
+ * galloping (exponential search) in the longer list. The out-neighbors of nodes with many
+ * out-neighbors (hubs) are marked in a per-thread array instead, so that only the out-neighbors
+ * of v have to be scanned.
+ *
+ * Self-loops are ignored; the graph must not contain multi-edges. The structure is built in the
+ * constructor and stays valid as long as the graph is not modified.
+ *
+ * [0] Triangle Listing Algorithms: Back from the Diversion
+ * Mark Ortmann and Ulrik Brandes * 2014 Proceedings of the Sixteenth Workshop on Algorithm
+ * Engineering and Experiments (ALENEX). 2014, 1-8
+ */
+class TriangleEngine final {
+
+public:
+    /**
+     * Builds the degree orientation of @a G.
+     *
+     * @param G The graph, must be undirected.
+     * @param withEdgeIds If true, the edge ids of @a G are stored as well, which is required by
+     * trianglesPerEdge() and the edge id variants of the triangle iterators. The edges of @a G
+     * must have been indexed.
+     */
+    explicit TriangleEngine(const Graph &G, bool withEdgeIds = false);
+
+    /**
+     * Calls handle(u, v, w) once for every triangle {u, v, w}.
+     */
+    template <typename L>
+    void forTriangles(L handle) const {
+        forTrianglesImpl<false, false>(handle);
+    }
+
+    /**
+     * Calls handle(u, v, w) once for every triangle {u, v, w} in parallel.
+     */
+    template <typename L>
+    void parallelForTriangles(L handle) const {
+        forTrianglesImpl<true, false>(handle);
+    }
+
+    /**
+     * Calls handle(u, v, w, uv, uw, vw) once for every triangle {u, v, w}, where uv, uw and vw
+     * are the ids of its edges. Requires withEdgeIds.
+     */
+    template <typename L>
+    void forTrianglesWithEdgeIds(L handle) const {
+        forTrianglesImpl<false, true>(handle);
+    }
+
+    /**
+     * Parallel version of forTrianglesWithEdgeIds().
+     */
+    template <typename L>
+    void parallelForTrianglesWithEdgeIds(L handle) const {
+        forTrianglesImpl<true, true>(handle);
+    }
+
+    /**
+     * @return The number of triangles of the graph.
+     */
+    count numberOfTriangles() const;
+
+    /**
+     * @return The number of triangles each node is part of, indexed by node id.
+     */
+    std::vector<count> trianglesPerNode() const;
+
+    /**
+     * @return The number of triangles each edge is part of, indexed by edge id. Requires
+     * withEdgeIds.
+     */
+    std::vector<count> trianglesPerEdge() const;
+
+    /**
+     * @return The maximum number of out-neighbors of a node in the degree orientation.
+     */
+    count maxOutDegree() const noexcept { return maxOut; }
+
+    //! Nodes with at least this many out-neighbors are handled by marking instead of merging.
+    static constexpr count hubThreshold = 64;
+    //! Lists are intersected by galloping if one is this many times longer than the other.
+    static constexpr count gallopingRatio = 16;
+
+private:
+    const Graph *G;
+    const bool withEdgeIds;
+    count maxOut = 0;
+
+    // Nodes are identified by their rank in the degree order; the out-neighbors of rank r are
+    // outNeighbors[outBegin[r]..outBegin[r + 1]), sorted by rank.
+    std::vector<node> nodeOfRank;
+    std::vector<index> outBegin;
+    std::vector<node> outNeighbors;
+    std::vector<edgeid> outEdgeIds;
+
+    void requireEdgeIds() const;
+
+    // Advances pos to the first position in [pos, end) whose rank is at least x.
+    index gallop(index pos, index end, node x) const {
+        index step = 1;
+        while (pos + step < end && outNeighbors[pos + step] < x) {
+            pos += step;
+            step <<= 1;
+        }
+        const auto first = outNeighbors.begin();
+        return static_cast<index>(
+            std::lower_bound(first + pos, first + std::min(pos + step, end), x) - first);
+    }
+
+    // Calls emit(i, j) for all positions i in [a, aEnd) and j in [b, bEnd) with the same rank.
+    template <typename Emit>
+    void intersect(index a, index aEnd, index b, index bEnd, Emit &emit) const {
+        const count na = aEnd - a, nb = bEnd - b;
+        if (na == 0 || nb == 0)
+            return;
+
+        if (na > gallopingRatio * nb) {
+            for (; b < bEnd && a < aEnd; ++b) {
+                a = gallop(a, aEnd, outNeighbors[b]);
+                if (a < aEnd && outNeighbors[a] == outNeighbors[b])
+                    emit(a, b);
+            }
+        } else if (nb > gallopingRatio * na) {
+            for (; a < aEnd && b < bEnd; ++a) {
+                b = gallop(b, bEnd, outNeighbors[a]);
+                if (b < bEnd && outNeighbors[a] == outNeighbors[b])
+                    emit(a, b);
+            }
+        } else {
+            while (a < aEnd && b < bEnd) {
+                const node x = outNeighbors[a], y = outNeighbors[b];
+                if (x == y)
+                    emit(a, b);
+                a += static_cast<index>(x <= y);
+                b += static_cast<index>(y <= x);
+            }
+        }
+    }
+
+    /*
+     * Finds the triangles whose smallest node has rank ru and calls handle(i, j, k) for each of
+     * them, where i, j and k are the positions of the edges (u, v), (u, w) and (v, w) in
+     * outNeighbors. marker must have one zero entry per node if ru is a hub.
+     */
+    template <typename L>
+    void trianglesOfRank(node ru, std::vector<index> &marker, L &handle) const {
+        const index begin = outBegin[ru], end = outBegin[ru + 1];
+        if (end - begin < 2)
+            return;
+
+        if (end - begin >= hubThreshold) {
+            // positions are stored shifted by one, zero means not an out-neighbor of u
+            for (index i = begin; i < end; ++i)
+                marker[outNeighbors[i]] = i + 1;
+            for (index i = begin; i + 1 < end; ++i) {
+                const node rv = outNeighbors[i];
+                // out-neighbors of v come after v, so they can only match positions after i
+                for (index k = outBegin[rv]; k < outBegin[rv + 1]; ++k) {
+                    const index j = marker[outNeighbors[k]];
+                    if (j)
+                        handle(i, j - 1, k);
+                }
+            }
+            for (index i = begin; i < end; ++i)
+                marker[outNeighbors[i]] = 0;
+            return;
+        }
+
+        for (index i = begin; i + 1 < end; ++i) {
+            const node rv = outNeighbors[i];
+            auto emit = [&](index j, index k) { handle(i, j, k); };
+            intersect(i + 1, end, outBegin[rv], outBegin[rv + 1], emit);
+        }
+    }
+
+    // Calls perRank(ru, marker) for all ranks, with a marker array for trianglesOfRank.
+    template <bool parallel, typename F>
+    void forRanks(F perRank) const {
+        const count n = nodeOfRank.size();
+        const count markerSize = maxOut >= hubThreshold ? n : 0;
+        if (parallel) {
+#pragma omp parallel
+            {
+                std::vector<index> marker(markerSize, 0);
+#pragma omp for schedule(dynamic, 64)
+                for (omp_index ru = 0; ru < static_cast<omp_index>(n); ++ru)
+                    perRank(static_cast<node>(ru), marker);
+            }
+        } else {
+            std::vector<index> marker(markerSize, 0);
+            for (node ru = 0; ru < n; ++ru)
+                perRank(ru, marker);
+        }
+    }
+
+    template <bool parallel, bool edgeIds, typename L>
+    void forTrianglesImpl(L &handle) const {
+        if (edgeIds)
+            requireEdgeIds();
+        forRanks<parallel>([&](node ru, std::vector<index> &marker) {
+            const node u = nodeOfRank[ru];
+            auto perTriangle = [&](index i, index j, index k) {
+                const node v = nodeOfRank[outNeighbors[i]], w = nodeOfRank[outNeighbors[j]];
+                if constexpr (edgeIds)
+                    handle(u, v, w, outEdgeIds[i], outEdgeIds[j], outEdgeIds[k]);
+                else
+                    handle(u, v, w);
+            };
+            trianglesOfRank(ru, marker, perTriangle);
+        });
+    }
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_GRAPH_TRIANGLE_ENGINE_HPP_
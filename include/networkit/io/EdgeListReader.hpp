@@ -20,6 +20,8 @@ namespace NetworKit {
  * A reader for various edge list formats, in which each line contains an edge as
  * two node ids.
  *
+ * The file is split into line-aligned chunks that are parsed in parallel. If an
+ * edge occurs more than once, only its first occurrence is added to the graph.
  */
 class EdgeListReader final : public GraphReader {
 
@@ -49,6 +51,9 @@ public:
     const std::map<std::string, node> &getNodeMap() const;
 
 private:
+    //!< files smaller than this are parsed by a single thread
+    static constexpr count minChunkSize = 1 << 16;
+
     char separator; //!< character separating nodes in an edge line
     std::string commentPrefix;
     node firstNode;
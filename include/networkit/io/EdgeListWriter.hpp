@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_IO_EDGE_LIST_WRITER_HPP_
 #define NETWORKIT_IO_EDGE_LIST_WRITER_HPP_
 
+#include <networkit/generators/StreamingGraphGenerator.hpp>
 #include <networkit/io/GraphWriter.hpp>
 
 namespace NetworKit {
@@ -38,6 +39,16 @@ public:
      */
     void write(const Graph &G, const std::string &path) override;
 
+    /**
+     * Write the edges produced by @a generator to a file without building the graph. The
+     * batches of the generator are written in the order in which they are emitted, which
+     * depends on the scheduling of the threads. The memory usage does not depend on the
+     * number of edges.
+     * @param[in]  generator  the generator whose edges are written
+     * @param[in]  path  the output file path
+     */
+    void write(StreamingGraphGenerator &generator, const std::string &path);
+
 private:
     char separator; //!< character separating nodes in an edge line
     node firstNode;
@@ -32,6 +32,33 @@ struct Header {
     uint64_t offsetAdjIdTranspose;
 };
 
+/**
+ * Header of the uncompressed variant of the format (magic "nkbgcsr"). All arrays are stored with
+ * fixed width at 8-byte aligned offsets, so a mapped file can be used directly as a CSRGraph. The
+ * header and the arrays are in the native byte order of the writing host.
+ */
+struct CSRHeader {
+    char magic[8];
+    uint64_t checksum;
+    uint64_t features;
+    uint64_t nodes;
+    uint64_t edges;
+    uint64_t selfLoops;
+    uint64_t upperEdgeIdBound;
+    uint64_t offsetNodeFlags;
+    uint64_t offsetOutOffsets;
+    uint64_t offsetOutTargets;
+    uint64_t offsetOutWeights;
+    uint64_t offsetOutEdgeIds;
+    uint64_t offsetInOffsets;
+    uint64_t offsetInTargets;
+    uint64_t offsetInWeights;
+    uint64_t offsetInEdgeIds;
+};
+
+static constexpr char CSR_MAGIC[8] = "nkbgcsr";
+static constexpr uint64_t CSR_ALIGNMENT = 8;
+
 enum class WeightFormat : int { NONE = 0, VARINT = 1, SIGNED_VARINT = 2, DOUBLE = 3, FLOAT = 4 };
 
 using WEIGHT_FORMAT = WeightFormat; // enum alias for backwards compatibility
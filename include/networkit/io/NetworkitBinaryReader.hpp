@@ -9,6 +9,7 @@
 
 #include <cstring>
 #include <string>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/io/GraphReader.hpp>
 #include <networkit/io/MemoryMappedFile.hpp>
@@ -29,6 +30,17 @@ public:
     Graph read(const std::string &path) override;
     Graph readFromBuffer(const std::vector<uint8_t> &data);
 
+    /**
+     * Reads the graph at @a path as an immutable CSRGraph. Files written by
+     * NetworkitBinaryWriter::writeCSR are mapped into memory and used without copying or decoding;
+     * the mapping stays alive as long as the returned graph (or a copy of it) exists. Files in the
+     * compressed format are decoded and converted.
+     *
+     * @param path Path of the input file.
+     * @return The graph as CSRGraph.
+     */
+    CSRGraph readCSR(const std::string &path);
+
 private:
     count nodes;
     count chunks;
@@ -39,6 +51,10 @@ private:
 
     template <class T>
     Graph readData(const T &source);
+
+    // Sets the arrays of G to point into data, which holds a file in the CSR variant.
+    static void viewCSRData(const char *data, uint64_t size, CSRGraph &G);
+    static Graph materializeCSR(const CSRGraph &C);
 };
 } // namespace NetworKit
 
@@ -7,6 +7,8 @@
 #ifndef NETWORKIT_IO_NETWORKIT_BINARY_WRITER_HPP_
 #define NETWORKIT_IO_NETWORKIT_BINARY_WRITER_HPP_
 
+#include <networkit/generators/StreamingGraphGenerator.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/io/GraphWriter.hpp>
 
@@ -51,6 +53,33 @@ public:
     void write(const Graph &G, const std::string &path) override;
     std::vector<uint8_t> writeToBuffer(const Graph &G);
 
+    /**
+     * Writes the unweighted graph produced by @a generator without building it in memory. The
+     * edges are first distributed to one temporary file per chunk (next to @a path), then the
+     * chunks are sorted and encoded one after another. Hence, the memory usage is dominated by
+     * the edges of the largest chunk (16 bytes per edge); use more chunks for larger graphs.
+     * The weightsType and edgeIndex parameters of the writer are ignored.
+     *
+     * @param generator The generator whose edges are written.
+     * @param path Path of the output file.
+     * @param removeMultiEdges If true, only one copy of each edge is written.
+     */
+    void write(StreamingGraphGenerator &generator, const std::string &path,
+               bool removeMultiEdges = true);
+
+    /**
+     * Writes the graph in the uncompressed CSR variant of the format. Files in this variant are
+     * larger than the compressed ones but can be mapped into memory and used without decoding,
+     * see NetworkitBinaryReader::readCSR. Weights are always stored as doubles; the chunks and
+     * weightsType parameters of the writer are ignored. All values are written in the native
+     * byte order, so the files can only be read on hosts with the same byte order.
+     *
+     * @param G The graph to write.
+     * @param path Path of the output file.
+     */
+    void writeCSR(const CSRGraph &G, const std::string &path);
+    void writeCSR(const Graph &G, const std::string &path) { writeCSR(CSRGraph(G), path); }
+
 private:
     count chunks;
     NetworkitBinaryWeights weightsType;
@@ -59,6 +88,9 @@ private:
 
     template <class T>
     void writeData(T &outStream, const Graph &G);
+
+    template <class T>
+    void writeCSRData(T &outStream, const CSRGraph &G);
 };
 
 } // namespace NetworKit
@@ -0,0 +1,365 @@
+/*
+ * BlockConjugateGradient.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_NUMERICS_BLOCK_CONJUGATE_GRADIENT_HPP_
+#define NETWORKIT_NUMERICS_BLOCK_CONJUGATE_GRADIENT_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <omp.h>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/algebraic/Vector.hpp>
+#include <networkit/auxiliary/Timer.hpp>
+#include <networkit/numerics/LinearSolver.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Conjugate Gradient for many right-hand sides. Up to blockSize systems are solved at the same
+ * time: each system runs its own CG recurrence, but all of them share one sparse matrix times
+ * block product per iteration, so the matrix is read once for the whole block. A system stops
+ * being updated as soon as it has converged. The time limit maxConvergenceTime (in milliseconds)
+ * applies to each block: no iteration is started after it has passed.
+ *
+ * The vectors of a block are stored row by row (entry i of vector c is at position
+ * i * blockSize + c), so that the products, dot products and vector updates run over contiguous
+ * memory and vectorize. All work buffers are kept between solves; the solver must therefore not
+ * be used by several threads at the same time, the solves themselves are parallel.
+ *
+ * The Preconditioner has to provide rhs(const std::vector<double> &b, std::vector<double> &out,
+ * count blockSize) for blocks in this layout, e.g. DiagonalPreconditioner (Jacobi) or
+ * IncompleteCholeskyPreconditioner.
+ */
+template <class Matrix, class Preconditioner>
+class BlockConjugateGradient : public LinearSolver<Matrix> {
+public:
+    //! Default maximum number of systems that are solved at the same time.
+    static constexpr count defaultBlockSize = 8;
+
+    /**
+     * @param tolerance The relative residual ||Ax-b||/||b|| each system has to achieve.
+     * @param blockSize Maximum number of systems that are solved at the same time.
+     */
+    BlockConjugateGradient(double tolerance = 1e-5, count blockSize = defaultBlockSize)
+        : LinearSolver<Matrix>(tolerance), blockSize(blockSize) {
+        if (blockSize == 0)
+            throw std::runtime_error("The block size must be positive.");
+    }
+
+    void setup(const Matrix &matrix) override {
+        this->matrix = matrix;
+        precond = Preconditioner(matrix);
+    }
+
+    void setupConnected(const Matrix &matrix) override {
+        this->matrix = matrix;
+        precond = Preconditioner(matrix);
+    }
+
+    /**
+     * Solves the linear system \f$Ax = b\f$ for a single right-hand side; @a result is the
+     * initial value.
+     */
+    SolverStatus solve(const Vector &rhs, Vector &result, count maxConvergenceTime = 5 * 60 * 1000,
+                       count maxIterations = std::numeric_limits<count>::max()) override;
+
+    /**
+     * Solves the linear systems for all right-hand sides @a rhs as one block, regardless of
+     * blockSize. The vectors in @a results are the initial values; missing vectors or vectors of
+     * the wrong dimension are replaced by zero vectors.
+     * @return The status of each system.
+     */
+    std::vector<SolverStatus> solveBlock(const std::vector<Vector> &rhs,
+                                         std::vector<Vector> &results,
+                                         count maxConvergenceTime = 5 * 60 * 1000,
+                                         count maxIterations = std::numeric_limits<count>::max());
+
+    /**
+     * Solves the linear systems in blocks of at most blockSize right-hand sides.
+     * @param rhs
+     * @param results
+     * @param maxConvergenceTime
+     * @param maxIterations
+     */
+    void parallelSolve(const std::vector<Vector> &rhs, std::vector<Vector> &results,
+                       count maxConvergenceTime = 5 * 60 * 1000,
+                       count maxIterations = std::numeric_limits<count>::max()) override;
+
+    /**
+     * Solves the systems with the right-hand sides provided by @a rhsLoader in blocks of at most
+     * blockSize and passes each result to @a resultProcessor (sequentially, in the order of the
+     * right-hand sides). The initial value of each system is the zero vector.
+     * @param rhsLoader (index i, Vector &buffer) -> const Vector &, the i-th right-hand side
+     * @param resultProcessor (index i, const Vector &result)
+     * @param rhsSize The number of right-hand sides and their dimension.
+     * @param maxConvergenceTime
+     * @param maxIterations
+     */
+    template <typename RHSLoader, typename ResultProcessor>
+    void parallelSolve(const RHSLoader &rhsLoader, const ResultProcessor &resultProcessor,
+                       std::pair<count, count> rhsSize, count maxConvergenceTime = 5 * 60 * 1000,
+                       count maxIterations = std::numeric_limits<count>::max()) {
+        const count n = rhsSize.first;
+        const count m = rhsSize.second;
+        std::vector<Vector> buffers(std::min(n, blockSize), Vector(m));
+        std::vector<const Vector *> rhs;
+        std::vector<Vector> results;
+        for (index first = 0; first < n; first += blockSize) {
+            const count k = std::min(blockSize, n - first);
+            rhs.resize(k);
+            for (index c = 0; c < k; ++c) {
+                rhs[c] = &rhsLoader(first + c, buffers[c]);
+            }
+            results.assign(k, Vector(m, 0.0));
+            solveBlockImpl(rhs, results.data(), maxConvergenceTime, maxIterations);
+            for (index c = 0; c < k; ++c) {
+                resultProcessor(first + c, results[c]);
+            }
+        }
+    }
+
+private:
+    Matrix matrix;
+    Preconditioner precond;
+    count blockSize;
+
+    // work buffers: right-hand sides, solutions, residuals, preconditioned residuals, search
+    // directions and matrix times search directions
+    std::vector<double> B, X, R, Z, P, Q;
+    // per-thread partial results of columnDots
+    std::vector<double> partialDots;
+
+    std::vector<SolverStatus> solveBlockImpl(const std::vector<const Vector *> &rhs,
+                                             Vector *results, count maxConvergenceTime,
+                                             count maxIterations);
+
+    // out = matrix * in for blocks of k vectors
+    void multiplyBlock(const std::vector<double> &in, std::vector<double> &out, count k) const {
+        const count n = matrix.numberOfRows();
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            double *outi = out.data() + i * k;
+            std::fill(outi, outi + k, 0.0);
+            matrix.forNonZeroElementsInRow(i, [&](index j, double value) {
+                const double *inj = in.data() + j * k;
+#pragma omp simd
+                for (index c = 0; c < k; ++c)
+                    outi[c] += value * inj[c];
+            });
+        }
+    }
+
+    /*
+     * Calls rowKernel(i, sums) for all rows i of the block in parallel, where rowKernel adds the
+     * contributions of row i to the k column sums. The sums of the threads are added up in a
+     * fixed order, so the result does not depend on the scheduling.
+     */
+    template <typename F>
+    void columnSums(count k, std::vector<double> &sums, F rowKernel) {
+        const count n = matrix.numberOfRows();
+        partialDots.assign(static_cast<count>(omp_get_max_threads()) * k, 0.0);
+#pragma omp parallel
+        {
+            double *local = partialDots.data() + omp_get_thread_num() * k;
+#pragma omp for schedule(static)
+            for (omp_index i = 0; i < static_cast<omp_index>(n); ++i)
+                rowKernel(static_cast<index>(i), local);
+        }
+
+        sums.assign(k, 0.0);
+        for (index t = 0; t < partialDots.size(); t += k) {
+            for (index c = 0; c < k; ++c)
+                sums[c] += partialDots[t + c];
+        }
+    }
+
+    // dots[c] = <a_c, b_c> for the columns of the blocks a and b
+    void columnDots(const std::vector<double> &a, const std::vector<double> &b, count k,
+                    std::vector<double> &dots) {
+        columnSums(k, dots, [&](index i, double *local) {
+            const double *ai = a.data() + i * k, *bi = b.data() + i * k;
+#pragma omp simd
+            for (index c = 0; c < k; ++c)
+                local[c] += ai[c] * bi[c];
+        });
+    }
+};
+
+template <class Matrix, class Preconditioner>
+SolverStatus BlockConjugateGradient<Matrix, Preconditioner>::solve(const Vector &rhs,
+                                                                   Vector &result,
+                                                                   count maxConvergenceTime,
+                                                                   count maxIterations) {
+    return solveBlockImpl({&rhs}, &result, maxConvergenceTime, maxIterations)[0];
+}
+
+template <class Matrix, class Preconditioner>
+std::vector<SolverStatus>
+BlockConjugateGradient<Matrix, Preconditioner>::solveBlock(const std::vector<Vector> &rhs,
+                                                           std::vector<Vector> &results,
+                                                           count maxConvergenceTime,
+                                                           count maxIterations) {
+    std::vector<const Vector *> rhsPointers(rhs.size());
+    for (index c = 0; c < rhs.size(); ++c)
+        rhsPointers[c] = &rhs[c];
+    results.resize(rhs.size());
+    return solveBlockImpl(rhsPointers, results.data(), maxConvergenceTime, maxIterations);
+}
+
+template <class Matrix, class Preconditioner>
+void BlockConjugateGradient<Matrix, Preconditioner>::parallelSolve(const std::vector<Vector> &rhs,
+                                                                   std::vector<Vector> &results,
+                                                                   count maxConvergenceTime,
+                                                                   count maxIterations) {
+    assert(rhs.size() == results.size());
+    std::vector<const Vector *> rhsPointers;
+    for (index first = 0; first < rhs.size(); first += blockSize) {
+        const count k = std::min(blockSize, rhs.size() - first);
+        rhsPointers.resize(k);
+        for (index c = 0; c < k; ++c)
+            rhsPointers[c] = &rhs[first + c];
+        solveBlockImpl(rhsPointers, results.data() + first, maxConvergenceTime, maxIterations);
+    }
+}
+
+template <class Matrix, class Preconditioner>
+std::vector<SolverStatus> BlockConjugateGradient<Matrix, Preconditioner>::solveBlockImpl(
+    const std::vector<const Vector *> &rhs, Vector *results, count maxConvergenceTime,
+    count maxIterations) {
+    Aux::Timer timer;
+    timer.start();
+    const count n = matrix.numberOfRows();
+    const count k = rhs.size();
+    std::vector<SolverStatus> status(k);
+    if (k == 0)
+        return status;
+
+    for (index c = 0; c < k; ++c) {
+        assert(rhs[c]->getDimension() == n);
+        if (results[c].getDimension() != n)
+            results[c] = Vector(n, 0.0);
+    }
+
+    B.resize(n * k);
+    X.resize(n * k);
+    R.resize(n * k);
+    P.resize(n * k);
+    Q.resize(n * k);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        for (index c = 0; c < k; ++c) {
+            B[i * k + c] = (*rhs[c])[i];
+            X[i * k + c] = results[c][i];
+        }
+    }
+
+    // R = B - A X, Z = M^{-1} R, P = Z
+    multiplyBlock(X, Q, k);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n * k); ++i)
+        R[i] = B[i] - Q[i];
+    precond.rhs(R, Z, k);
+    P = Z;
+
+    std::vector<double> sqrRhs, sqrResidual, sqrResidualPrecond, newSqrResidualPrecond, pq;
+    columnDots(B, B, k, sqrRhs);
+    columnDots(R, R, k, sqrResidual);
+    columnDots(R, Z, k, sqrResidualPrecond);
+
+    // Absolute residuals to achieve
+    std::vector<double> sqrDesiredResidual(k), alpha(k), beta(k);
+    std::vector<bool> active(k);
+    count numActive = 0;
+    for (index c = 0; c < k; ++c) {
+        sqrDesiredResidual[c] = this->tolerance * this->tolerance * sqrRhs[c];
+        active[c] = sqrResidual[c] > sqrDesiredResidual[c];
+        numActive += active[c];
+        status[c].numIters = 0;
+    }
+
+    // Main loop, one CG iteration for each active system
+    for (count niters = 1; numActive > 0 && niters <= maxIterations; ++niters) {
+        if (timer.elapsedMilliseconds() > maxConvergenceTime)
+            break;
+        multiplyBlock(P, Q, k);
+        columnDots(P, Q, k, pq);
+        for (index c = 0; c < k; ++c) {
+            alpha[c] = active[c] ? sqrResidualPrecond[c] / pq[c] : 0.0;
+            if (active[c])
+                status[c].numIters = niters;
+        }
+
+        // X += alpha P, R -= alpha Q and the new squared residuals in one pass
+        columnSums(k, sqrResidual, [&](index i, double *local) {
+            double *xi = X.data() + i * k, *ri = R.data() + i * k;
+            const double *pi = P.data() + i * k, *qi = Q.data() + i * k;
+#pragma omp simd
+            for (index c = 0; c < k; ++c) {
+                xi[c] += alpha[c] * pi[c];
+                ri[c] -= alpha[c] * qi[c];
+                local[c] += ri[c] * ri[c];
+            }
+        });
+
+        numActive = 0;
+        for (index c = 0; c < k; ++c) {
+            active[c] = active[c] && sqrResidual[c] > sqrDesiredResidual[c];
+            numActive += active[c];
+        }
+        if (numActive == 0)
+            break;
+
+        precond.rhs(R, Z, k);
+        columnDots(R, Z, k, newSqrResidualPrecond);
+        for (index c = 0; c < k; ++c) {
+            // converged systems keep their search direction, it is not used anymore
+            beta[c] = active[c] ? newSqrResidualPrecond[c] / sqrResidualPrecond[c] : 0.0;
+            sqrResidualPrecond[c] = newSqrResidualPrecond[c];
+        }
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            double *pi = P.data() + i * k;
+            const double *zi = Z.data() + i * k;
+#pragma omp simd
+            for (index c = 0; c < k; ++c)
+                pi[c] = zi[c] + beta[c] * pi[c];
+        }
+    }
+
+    // final residuals ||b - Ax||
+    multiplyBlock(X, Q, k);
+    columnSums(k, sqrResidual, [&](index i, double *local) {
+        const double *bi = B.data() + i * k, *qi = Q.data() + i * k;
+#pragma omp simd
+        for (index c = 0; c < k; ++c)
+            local[c] += (bi[c] - qi[c]) * (bi[c] - qi[c]);
+    });
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        for (index c = 0; c < k; ++c)
+            results[c][i] = X[i * k + c];
+    }
+
+    for (index c = 0; c < k; ++c) {
+        status[c].residual = std::sqrt(sqrResidual[c]);
+        status[c].converged = status[c].residual <= this->tolerance * std::sqrt(sqrRhs[c]);
+    }
+
+    return status;
+}
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_NUMERICS_BLOCK_CONJUGATE_GRADIENT_HPP_
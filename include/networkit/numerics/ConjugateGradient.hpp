@@ -9,6 +9,7 @@
 #define NETWORKIT_NUMERICS_CONJUGATE_GRADIENT_HPP_
 
 #include <cstdint>
+#include <tuple>
 #include <utility>
 
 #include <networkit/algebraic/CSRMatrix.hpp>
@@ -111,35 +112,41 @@ SolverStatus ConjugateGradient<Matrix, Preconditioner>::solve(const Vector &rhs,
 
     // Main loop. See:
     // http://en.wikipedia.org/wiki/Conjugate_gradient_method#The_resulting_algorithm
-    Vector residual_dir = rhs - matrix * result;
-    Vector conjugate_dir = precond.rhs(residual_dir);
-    double sqr_residual = Vector::innerProduct(residual_dir, residual_dir);
-    double sqr_residual_precond = Vector::innerProduct(residual_dir, conjugate_dir);
+    // All vectors are allocated once, the loop only uses in-place and fused kernels.
+    const count n = rhs.getDimension();
+    Vector residual_dir = rhs;
+    Vector::matrixVectorProduct(matrix, result, residual_dir, -1.0, 1.0);
+    Vector conjugate_dir(n), residual_precond(n), tmp(n);
+    precond.rhs(residual_dir, conjugate_dir);
+    auto [sqr_residual_precond, sqr_residual] =
+        Vector::innerProductAndSquaredLength(residual_dir, conjugate_dir);
 
     count niters = 0;
-    Vector tmp, residual_precond;
     while (sqr_residual > sqr_desired_residual) {
         niters++;
         if (niters > maxIterations) {
             break;
         }
 
-        tmp = matrix * conjugate_dir;
+        Vector::matrixVectorProduct(matrix, conjugate_dir, tmp);
         double step = sqr_residual_precond / Vector::innerProduct(conjugate_dir, tmp);
-        result += step * conjugate_dir;
-        residual_dir -= step * tmp;
-        sqr_residual = Vector::innerProduct(residual_dir, residual_dir);
-
-        residual_precond = precond.rhs(residual_dir);
-        double new_sqr_residual_precond = Vector::innerProduct(residual_dir, residual_precond);
-        conjugate_dir =
-            (new_sqr_residual_precond / sqr_residual_precond) * conjugate_dir + residual_precond;
+        result.axpy(step, conjugate_dir);
+        residual_dir.axpy(-step, tmp);
+
+        precond.rhs(residual_dir, residual_precond);
+        double new_sqr_residual_precond;
+        std::tie(new_sqr_residual_precond, sqr_residual) =
+            Vector::innerProductAndSquaredLength(residual_dir, residual_precond);
+        conjugate_dir.axpby(1.0, residual_precond,
+                            new_sqr_residual_precond / sqr_residual_precond);
         sqr_residual_precond = new_sqr_residual_precond;
     }
 
     SolverStatus status;
     status.numIters = niters;
-    status.residual = (rhs - matrix * result).length();
+    residual_dir = rhs;
+    Vector::matrixVectorProduct(matrix, result, residual_dir, -1.0, 1.0);
+    status.residual = residual_dir.length();
     status.converged = status.residual / rhs.length() <= this->tolerance;
 
     return status;
@@ -8,6 +8,8 @@
 #ifndef NETWORKIT_NUMERICS_GAUSS_SEIDEL_RELAXATION_HPP_
 #define NETWORKIT_NUMERICS_GAUSS_SEIDEL_RELAXATION_HPP_
 
+#include <cmath>
+
 #include <networkit/numerics/Smoother.hpp>
 
 namespace NetworKit {
@@ -52,39 +54,70 @@ public:
      */
     Vector relax(const Matrix &A, const Vector &b,
                  count maxIterations = std::numeric_limits<count>::max()) const override;
+
+    /**
+     * Utilizes Gauss-Seidel relaxations on @a x until the given number of @a maxIterations is
+     * reached or the relative residual is below the tolerance specified in the constructor. No
+     * vectors are allocated.
+     * @param A The matrix.
+     * @param b The right-hand-side.
+     * @param x The initial guess, overwritten by the (approximate) solution.
+     * @param maxIterations
+     */
+    void relaxInPlace(const Matrix &A, const Vector &b, Vector &x,
+                      count maxIterations = std::numeric_limits<count>::max()) const override;
 };
 
 template <class Matrix>
 Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix &A, const Vector &b,
                                             const Vector &initialGuess,
                                             const count maxIterations) const {
-    count iterations = 0;
-    Vector x_old = initialGuess;
-    Vector x_new = initialGuess;
+    Vector x = initialGuess;
+    relaxInPlace(A, b, x, maxIterations);
+    return x;
+}
+
+template <class Matrix>
+void GaussSeidelRelaxation<Matrix>::relaxInPlace(const Matrix &A, const Vector &b, Vector &x,
+                                                 const count maxIterations) const {
     if (maxIterations == 0)
-        return initialGuess;
+        return;
 
-    count dimension = A.numberOfColumns();
-    Vector diagonal = A.diagonal();
+    const count dimension = A.numberOfColumns();
+    const double bLength = b.length();
+    count iterations = 0;
+    double sqrResidual;
 
     do {
-        x_old = x_new;
-
         for (index i = 0; i < dimension; ++i) {
             double sigma = 0.0;
+            double diagonal = 0.0;
             A.forNonZeroElementsInRow(i, [&](index column, double value) {
                 if (column != i) {
-                    sigma += value * x_new[column];
+                    sigma += value * x[column];
+                } else {
+                    diagonal = value;
                 }
             });
 
-            x_new[i] = (b[i] - sigma) / diagonal[i];
+            x[i] = (b[i] - sigma) / diagonal;
         }
 
         iterations++;
-    } while (iterations < maxIterations && (A * x_new - b).length() / b.length() > tolerance);
-
-    return x_new;
+        if (iterations >= maxIterations)
+            break;
+
+        // squared length of A * x - b, without creating the residual vector
+        sqrResidual = 0.0;
+#pragma omp parallel for reduction(+ : sqrResidual)
+        for (omp_index i = 0; i < static_cast<omp_index>(A.numberOfRows()); ++i) {
+            double ri = -b[i];
+            A.forNonZeroElementsInRow(i, [&](index column, double value) {
+                ri += value * x[column];
+            });
+            sqrResidual += ri * ri;
+        }
+    } while (std::sqrt(sqrResidual) / bLength > tolerance);
 }
 
 template <class Matrix>
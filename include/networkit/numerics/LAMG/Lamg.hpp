@@ -76,6 +76,24 @@ public:
      */
     void setupConnected(const Matrix &laplacianMatrix) override;
 
+    /**
+     * Uses the given multigrid @a hierarchy instead of computing it, e.g. a hierarchy that has been
+     * restored by LevelHierarchy::load. The graph of the finest Laplacian matrix of @a hierarchy
+     * has to be connected.
+     * @param hierarchy
+     */
+    void setupConnected(const LevelHierarchy<Matrix> &hierarchy);
+
+    /**
+     * @return The multigrid hierarchy of the matrix currently setup, which can be saved and reused
+     * by setupConnected(const LevelHierarchy<Matrix>&). The graph has to be connected.
+     */
+    const LevelHierarchy<Matrix> &getHierarchy() const {
+        if (!validSetup || numComponents != 1)
+            throw std::runtime_error("No hierarchy of a connected graph is setup.");
+        return compHierarchies[0];
+    }
+
     /**
      * Computes the @a result for the matrix currently setup and the right-hand side @a rhs.
      * The maximum spent time can be specified by @a maxConvergenceTime and the maximum number of
@@ -171,6 +189,16 @@ void Lamg<Matrix>::setupConnected(const Matrix &laplacianMatrix) {
     numComponents = 1;
 }
 
+template <class Matrix>
+void Lamg<Matrix>::setupConnected(const LevelHierarchy<Matrix> &hierarchy) {
+    compHierarchies = std::vector<LevelHierarchy<Matrix>>(1, hierarchy);
+    laplacianMatrix = compHierarchies[0].at(0).getLaplacian();
+    compSolvers.clear();
+    compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+    numComponents = 1;
+    validSetup = true;
+}
+
 template <class Matrix>
 void Lamg<Matrix>::setup(const Matrix &laplacianMatrix) {
     this->laplacianMatrix = laplacianMatrix;
@@ -25,6 +25,9 @@ public:
     LevelAggregation(const Matrix &A, const Matrix &P, const Matrix &R)
         : Level<Matrix>(LevelType::AGGREGATION, A), P(P), R(R) {}
 
+    inline const Matrix &getP() const { return P; }
+    inline const Matrix &getR() const { return R; }
+
     void coarseType(const Vector &xf, Vector &xc) const override;
 
     void restrict(const Vector &bf, Vector &bc) const override;
@@ -29,6 +29,10 @@ public:
     LevelElimination(const Matrix &A,
                      const std::vector<EliminationStage<Matrix>> &coarseningStages);
 
+    inline const std::vector<EliminationStage<Matrix>> &getCoarseningStages() const {
+        return coarseningStages;
+    }
+
     void coarseType(const Vector &xf, Vector &xc) const override;
     void restrict(const Vector &bf, Vector &bc, std::vector<Vector> &bStages) const override;
     void interpolate(const Vector &xc, Vector &xf,
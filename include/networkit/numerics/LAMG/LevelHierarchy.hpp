@@ -8,6 +8,15 @@
 #ifndef NETWORKIT_NUMERICS_LAMG_LEVEL_HIERARCHY_HPP_
 #define NETWORKIT_NUMERICS_LAMG_LEVEL_HIERARCHY_HPP_
 
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/algebraic/DenseMatrix.hpp>
 #include <networkit/numerics/LAMG/LAMGSettings.hpp>
 #include <networkit/numerics/LAMG/Level/Level.hpp>
@@ -19,6 +28,8 @@ namespace NetworKit {
 
 /**
  * @ingroup numerics
+ * The levels of a LAMG multigrid hierarchy as computed by MultiLevelSetup. A hierarchy can be
+ * saved and loaded again, so that the setup does not have to be repeated for the same Laplacian.
  */
 template <class Matrix>
 class LevelHierarchy {
@@ -32,6 +43,51 @@ private:
 
     void createCoarseMatrix();
 
+    static constexpr char fileMagic[4] = {'N', 'K', 'L', 'H'};
+    static constexpr uint32_t fileVersion = 1;
+
+    static void check(bool condition) {
+        if (!condition)
+            throw std::runtime_error("Input is not a valid LAMG level hierarchy.");
+    }
+
+    template <typename T>
+    static void writeValue(std::ostream &out, T value) {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static T readValue(std::istream &in) {
+        T value;
+        check(static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T))));
+        return value;
+    }
+
+    template <typename T>
+    static void writeArray(std::ostream &out, const std::vector<T> &values) {
+        writeValue<uint64_t>(out, values.size());
+        out.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+    }
+
+    template <typename T>
+    static std::vector<T> readArray(std::istream &in) {
+        const count size = readValue<uint64_t>(in);
+        // grow in blocks, so that a corrupt size fails at the end of the input instead of
+        // allocating memory for it
+        std::vector<T> values;
+        while (values.size() < size) {
+            const count block = std::min<count>(size - values.size(), 1 << 16);
+            values.resize(values.size() + block);
+            check(static_cast<bool>(in.read(
+                reinterpret_cast<char *>(values.data() + values.size() - block),
+                block * sizeof(T))));
+        }
+        return values;
+    }
+
+    static void writeMatrix(std::ostream &out, const Matrix &A);
+    static Matrix readMatrix(std::istream &in);
+
 public:
     LevelHierarchy() = default;
 
@@ -48,7 +104,22 @@ public:
 
     LevelType getType(index levelIdx) const;
     Level<Matrix> &at(index levelIdx);
+    const Level<Matrix> &at(index levelIdx) const;
     double cycleIndex(index levelIdx);
+
+    /**
+     * Writes the hierarchy to @a out in a binary format. The LU decomposition of the coarsest
+     * level is not stored, it is recomputed by load().
+     * @param out The output stream, should be opened in binary mode.
+     */
+    void save(std::ostream &out) const;
+
+    /**
+     * Replaces this hierarchy by the one written to @a in by save(). Throws std::runtime_error if
+     * @a in does not contain a valid hierarchy.
+     * @param in The input stream, should be opened in binary mode.
+     */
+    void load(std::istream &in);
 };
 
 template <class Matrix>
@@ -117,6 +188,11 @@ Level<Matrix> &LevelHierarchy<Matrix>::at(index levelIdx) {
     }
 }
 
+template <class Matrix>
+const Level<Matrix> &LevelHierarchy<Matrix>::at(index levelIdx) const {
+    return const_cast<LevelHierarchy<Matrix> *>(this)->at(levelIdx);
+}
+
 template <class Matrix>
 double LevelHierarchy<Matrix>::cycleIndex(index levelIdx) {
     double gamma = 1.0;
@@ -136,6 +212,158 @@ double LevelHierarchy<Matrix>::cycleIndex(index levelIdx) {
     return gamma;
 }
 
+template <class Matrix>
+void LevelHierarchy<Matrix>::writeMatrix(std::ostream &out, const Matrix &A) {
+    std::vector<index> rowIdx(A.numberOfRows() + 1, 0);
+    std::vector<index> columnIdx;
+    std::vector<double> nonZeros;
+    A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+        ++rowIdx[i + 1];
+        columnIdx.push_back(j);
+        nonZeros.push_back(value);
+    });
+    for (index i = 0; i < A.numberOfRows(); ++i) {
+        rowIdx[i + 1] += rowIdx[i];
+    }
+
+    bool sorted = false;
+    if constexpr (std::is_same<Matrix, CSRMatrix>::value)
+        sorted = A.sorted();
+
+    writeValue<uint64_t>(out, A.numberOfRows());
+    writeValue<uint64_t>(out, A.numberOfColumns());
+    writeValue<uint8_t>(out, sorted);
+    writeArray(out, rowIdx);
+    writeArray(out, columnIdx);
+    writeArray(out, nonZeros);
+}
+
+template <class Matrix>
+Matrix LevelHierarchy<Matrix>::readMatrix(std::istream &in) {
+    const count nRows = readValue<uint64_t>(in);
+    const count nCols = readValue<uint64_t>(in);
+    const bool sorted = readValue<uint8_t>(in);
+    const std::vector<index> rowIdx = readArray<index>(in);
+    const std::vector<index> columnIdx = readArray<index>(in);
+    const std::vector<double> nonZeros = readArray<double>(in);
+
+    check(rowIdx.size() == nRows + 1 && rowIdx.front() == 0
+          && std::is_sorted(rowIdx.begin(), rowIdx.end()) && rowIdx.back() == columnIdx.size()
+          && nonZeros.size() == columnIdx.size());
+    check(std::all_of(columnIdx.begin(), columnIdx.end(), [&](index j) { return j < nCols; }));
+
+    if constexpr (std::is_same<Matrix, CSRMatrix>::value) {
+        return CSRMatrix(nRows, nCols, rowIdx, columnIdx, nonZeros, 0.0, sorted);
+    } else {
+        std::vector<Triplet> triplets(columnIdx.size());
+        for (index i = 0; i < nRows; ++i) {
+            for (index k = rowIdx[i]; k < rowIdx[i + 1]; ++k) {
+                triplets[k] = {i, columnIdx[k], nonZeros[k]};
+            }
+        }
+        return Matrix(nRows, nCols, triplets);
+    }
+}
+
+template <class Matrix>
+void LevelHierarchy<Matrix>::save(std::ostream &out) const {
+    out.write(fileMagic, sizeof(fileMagic));
+    writeValue<uint32_t>(out, fileVersion);
+    writeValue<uint64_t>(out, levelType.size());
+    writeMatrix(out, finestLevel.getLaplacian());
+
+    for (index levelIdx = 0; levelIdx < levelType.size(); ++levelIdx) {
+        writeValue<uint8_t>(out, levelType[levelIdx]);
+        if (levelType[levelIdx] == ELIMINATION) {
+            const LevelElimination<Matrix> &level = eliminationLevels[levelIndex[levelIdx]];
+            writeMatrix(out, level.getLaplacian());
+            writeValue<uint64_t>(out, level.getCoarseningStages().size());
+            for (const EliminationStage<Matrix> &stage : level.getCoarseningStages()) {
+                const Vector &q = stage.getQ();
+                std::vector<double> qValues(q.getDimension());
+                for (index i = 0; i < q.getDimension(); ++i) {
+                    qValues[i] = q[i];
+                }
+
+                writeMatrix(out, stage.getP());
+                writeArray(out, qValues);
+                writeArray(out, stage.getFSet());
+                writeArray(out, stage.getCSet());
+            }
+        } else {
+            const LevelAggregation<Matrix> &level = aggregationLevels[levelIndex[levelIdx]];
+            writeMatrix(out, level.getLaplacian());
+            writeMatrix(out, level.getP());
+            writeMatrix(out, level.getR());
+        }
+    }
+
+    writeValue<uint8_t>(out, coarseLUMatrix.numberOfRows() > 0);
+    if (!out)
+        throw std::runtime_error("Could not write the LAMG level hierarchy.");
+}
+
+template <class Matrix>
+void LevelHierarchy<Matrix>::load(std::istream &in) {
+    char magic[sizeof(fileMagic)];
+    check(in.read(magic, sizeof(magic)) && std::equal(magic, magic + sizeof(magic), fileMagic));
+    check(readValue<uint32_t>(in) == fileVersion);
+
+    LevelHierarchy<Matrix> loaded;
+    const count numLevels = readValue<uint64_t>(in);
+    loaded.addFinestLevel(readMatrix(in));
+    check(loaded.finestLevel.getLaplacian().numberOfRows()
+          == loaded.finestLevel.getLaplacian().numberOfColumns());
+
+    for (index levelIdx = 0; levelIdx < numLevels; ++levelIdx) {
+        const count nFine = loaded.at(levelIdx).getNumberOfNodes();
+        const uint8_t type = readValue<uint8_t>(in);
+        const Matrix A = readMatrix(in);
+        check(A.numberOfRows() == A.numberOfColumns());
+
+        if (type == ELIMINATION) {
+            const count numStages = readValue<uint64_t>(in);
+            std::vector<EliminationStage<Matrix>> stages;
+            count n = nFine;
+            for (index stageIdx = 0; stageIdx < numStages; ++stageIdx) {
+                const Matrix P = readMatrix(in);
+                const Vector q(readArray<double>(in));
+                const std::vector<index> fSet = readArray<index>(in);
+                const std::vector<index> cSet = readArray<index>(in);
+
+                // fSet and cSet partition the nodes of the previous stage
+                check(fSet.size() + cSet.size() == n && P.numberOfRows() == fSet.size()
+                      && P.numberOfColumns() == cSet.size() && q.getDimension() == fSet.size());
+                std::vector<bool> seen(n, false);
+                for (const auto *set : {&fSet, &cSet}) {
+                    for (index u : *set) {
+                        check(u < n && !seen[u]);
+                        seen[u] = true;
+                    }
+                }
+
+                stages.emplace_back(P, q, fSet, cSet);
+                n = cSet.size();
+            }
+            check(numStages > 0 && n == A.numberOfRows());
+            loaded.addEliminationLevel(A, stages);
+        } else if (type == AGGREGATION) {
+            const Matrix P = readMatrix(in);
+            const Matrix R = readMatrix(in);
+            check(P.numberOfRows() == nFine && P.numberOfColumns() == A.numberOfRows()
+                  && R.numberOfRows() == A.numberOfRows() && R.numberOfColumns() == nFine);
+            loaded.addAggregationLevel(A, P, R);
+        } else {
+            check(false);
+        }
+    }
+
+    if (readValue<uint8_t>(in))
+        loaded.setLastAsCoarsest();
+
+    *this = std::move(loaded);
+}
+
 } /* namespace NetworKit */
 
 #endif // NETWORKIT_NUMERICS_LAMG_LEVEL_HIERARCHY_HPP_
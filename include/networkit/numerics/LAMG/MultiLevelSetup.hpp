@@ -9,12 +9,18 @@
 #define NETWORKIT_NUMERICS_LAMG_MULTI_LEVEL_SETUP_HPP_
 
 #include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/algebraic/SparseAccumulator.hpp>
 #include <networkit/numerics/LAMG/LevelHierarchy.hpp>
 #include <networkit/numerics/Smoother.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
+#include <numeric>
+#include <type_traits>
 #include <vector>
+#include <omp.h>
 
 namespace NetworKit {
 
@@ -42,8 +48,10 @@ private:
 
     /**
      * Scans the Laplacian matrix for nodes with a low degree (i.e. nodes with less than 5
-     * neighbors). For each node having low degree and independent from already found low degree
-     * nodes, @code{true} is stored in @a fNode. The
+     * neighbors) and selects a maximal independent set of them, for which @code{true} is stored
+     * in @a fNode. The set is computed in parallel rounds: an undecided low degree node joins the
+     * set if it has the highest priority (see nodePriority) among its undecided low degree
+     * neighbors and leaves it once a neighbor has joined. The
      * @a stage parameter specifies if we are in the first or subsequent stages during elimination.
      * @param matrix Laplacian matrix.
      * @param fNode[out] For each node, @code{true} if the node is of low degree and @code{false}
@@ -65,6 +73,21 @@ private:
     void eliminationOperators(const Matrix &matrix, const std::vector<index> &fSet,
                               const std::vector<index> &coarseIndex, Matrix &P, Vector &q) const;
 
+    /**
+     * Computes the Schur complement Acc + Acf * P of an elimination stage row by row in parallel
+     * and stores it in @a B.
+     * @param matrix Laplacian matrix.
+     * @param fSet Set of nodes having low degree.
+     * @param cSet Set of nodes equal to V \setminus fSet
+     * @param coarseIndex Index of each node in @a fSet or @a cSet, respectively.
+     * @param P The projection matrix of the stage.
+     * @param B[out] The Laplacian matrix of the remaining nodes in @a cSet.
+     */
+    void eliminationSchurComplement(const Matrix &matrix, const std::vector<index> &fSet,
+                                    const std::vector<index> &cSet,
+                                    const std::vector<index> &coarseIndex, const Matrix &P,
+                                    Matrix &B) const;
+
     /**
      * Aggregation phase of LAMG for the specified Laplacian matrix @a matrix. The coarsened matrix
      * is stored in the LevelHierarchy @a hierarchy. The test vector @a tv is used for determining
@@ -122,18 +145,32 @@ private:
     void computeAffinityMatrix(const Matrix &matrix, const std::vector<Vector> &tVs,
                                Matrix &affinityMatrix) const;
 
+    /**
+     * Computes a distance-1 coloring of the graph of @a affinityMatrix in parallel rounds: an
+     * uncolored node whose priority (see nodePriority) is the highest among its uncolored
+     * neighbors gets the smallest color that none of its neighbors has.
+     * @param affinityMatrix Affinity matrix.
+     * @param color[out] The color of each node.
+     * @return The number of colors.
+     */
+    count colorAffinityGraph(const Matrix &affinityMatrix, std::vector<index> &color) const;
+
     /**
      * Models one stage in the aggregation phase. New aggregates are labeled accordingly in @a
-     * status.
+     * status. The undecided nodes of each bin are processed color by color; nodes of the same
+     * color are not adjacent and therefore find their seeds in parallel.
      * @param matrix Laplacian matrix.
      * @param nc Number of coarse nodes.
      * @param strongAdjMatrix Strong adjacency matrix.
      * @param affinityMatrix Affinity matrix.
+     * @param color Coloring of the graph of @a affinityMatrix.
+     * @param numColors Number of colors in @a color.
      * @param tVs[out] Test vectors.
      * @param status[out] Aggregation labels.
      */
     void aggregationStage(const Matrix &matrix, count &nc, const Matrix &strongAdjMatrix,
-                          const Matrix &affinityMatrix, std::vector<Vector> &tVs,
+                          const Matrix &affinityMatrix, const std::vector<index> &color,
+                          count numColors, std::vector<Vector> &tVs,
                           std::vector<index> &status) const;
 
     /**
@@ -191,6 +228,33 @@ private:
     void galerkinOperator(const Matrix &P, const Matrix &A, const std::vector<index> &PColIndex,
                           const std::vector<std::vector<index>> &PRowIndex, Matrix &B) const;
 
+    /**
+     * Priority of node @a i used to break the symmetry in the parallel independent set and
+     * coloring computations. It scrambles the node ids, so that long chains of nodes with
+     * increasing priority (and hence many rounds) are unlikely.
+     */
+    static uint64_t nodePriority(index i) {
+        uint64_t x = static_cast<uint64_t>(i) + 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    // True if node i has a higher priority than node j, ties are broken by id.
+    static bool hasHigherPriority(index i, index j) {
+        const uint64_t pi = nodePriority(i), pj = nodePriority(j);
+        return pi > pj || (pi == pj && i > j);
+    }
+
+    /**
+     * Computes the rows of an @a nRows x @a nCols matrix in parallel. For each row i,
+     * addRow(i, add) passes all contributions (j, value) of the row to add(j, value); the
+     * contributions to the same column are summed up.
+     * @return The matrix with sorted rows.
+     */
+    template <typename L>
+    static Matrix accumulateRows(count nRows, count nCols, L addRow);
+
     /**
      * Creates a @a hierarchy for the given Laplacian matrix @a matrix.
      * @param matrix Laplcian matrix.
@@ -225,7 +289,7 @@ public:
 
 template <class Matrix>
 void MultiLevelSetup<Matrix>::setup(const Matrix &matrix, LevelHierarchy<Matrix> &hierarchy) const {
-    CSRMatrix A = matrix;
+    Matrix A = matrix;
     setupForMatrix(A, hierarchy);
 }
 
@@ -315,10 +379,7 @@ bool MultiLevelSetup<Matrix>::coarseningElimination(Matrix &matrix,
         eliminationOperators(matrix, fSet, coarseIndex, P, q);
         coarseningStages.push_back(EliminationStage<Matrix>(P, q, fSet, cSet));
 
-        Matrix Acc = matrix.extract(cSet, cSet); // Schur complement
-        Matrix Acf = matrix.extract(cSet, fSet); // Schur complement
-
-        matrix = Acc + Acf * P;
+        eliminationSchurComplement(matrix, fSet, cSet, coarseIndex, P, matrix);
         stageNum++;
     }
 
@@ -333,23 +394,62 @@ bool MultiLevelSetup<Matrix>::coarseningElimination(Matrix &matrix,
 template <class Matrix>
 count MultiLevelSetup<Matrix>::lowDegreeSweep(const Matrix &matrix, std::vector<bool> &fNode,
                                               index stage) const {
-    fNode.resize(matrix.numberOfRows(), true); // first mark all nodes as f nodes
-    count numFNodes = 0;
+    enum NodeState : uint8_t { CANDIDATE, F_NODE, C_NODE };
+    const count n = matrix.numberOfRows();
     int degreeOffset = stage != 0;
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
-        if ((int)matrix.nnzInRow(i) - degreeOffset <= (int)SETUP_ELIMINATION_MAX_DEGREE
-            && fNode[i]) { // node i has degree <= 4 and can be eliminated
-            numFNodes++;
-            // To maintain independence, mark all neighbors  as not eliminated all neighbors of this
-            // f node are c nodes
+    std::vector<uint8_t> state(n);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        // node i can be eliminated if it has degree <= 4, otherwise it is a c node
+        state[i] = (int)matrix.nnzInRow(i) - degreeOffset <= (int)SETUP_ELIMINATION_MAX_DEGREE
+                       ? CANDIDATE
+                       : C_NODE;
+    }
+
+    std::vector<index> candidates;
+    for (index i = 0; i < n; ++i) {
+        if (state[i] == CANDIDATE)
+            candidates.push_back(i);
+    }
+
+    std::vector<uint8_t> decision;
+    while (!candidates.empty()) {
+        // all candidates decide on the states of the previous round
+        decision.resize(candidates.size());
+#pragma omp parallel for schedule(guided)
+        for (omp_index k = 0; k < static_cast<omp_index>(candidates.size()); ++k) {
+            const index i = candidates[k];
+            bool hasFNeighbor = false;
+            bool highestPriority = true;
             matrix.forNonZeroElementsInRow(i, [&](index j, edgeweight /*w*/) {
-                if (j != i) {
-                    fNode[j] = false;
-                }
+                if (j == i)
+                    return;
+                if (state[j] == F_NODE)
+                    hasFNeighbor = true;
+                else if (state[j] == CANDIDATE && hasHigherPriority(j, i))
+                    highestPriority = false;
             });
-        } else { // Node has high degree, thus it is a c node
-            fNode[i] = false;
+
+            // To maintain independence, all neighbors of an f node are c nodes
+            decision[k] = hasFNeighbor ? C_NODE : (highestPriority ? F_NODE : CANDIDATE);
+        }
+
+        index numCandidates = 0;
+        for (index k = 0; k < candidates.size(); ++k) {
+            state[candidates[k]] = decision[k];
+            if (decision[k] == CANDIDATE)
+                candidates[numCandidates++] = candidates[k];
+        }
+        candidates.resize(numCandidates);
+    }
+
+    fNode.assign(n, false);
+    count numFNodes = 0;
+    for (index i = 0; i < n; ++i) {
+        if (state[i] == F_NODE) {
+            fNode[i] = true;
+            numFNodes++;
         }
     }
 
@@ -361,23 +461,61 @@ void MultiLevelSetup<Matrix>::eliminationOperators(const Matrix &matrix,
                                                    const std::vector<index> &fSet,
                                                    const std::vector<index> &coarseIndex, Matrix &P,
                                                    Vector &q) const {
-    std::vector<Triplet> triples;
-    q = Vector(fSet.size());
-    for (index k = 0; k < fSet.size(); ++k) { // Afc
+    const count nf = fSet.size();
+    std::vector<index> rowIdx(nf + 1, 0);
+    q = Vector(nf);
+#pragma omp parallel for
+    for (omp_index k = 0; k < static_cast<omp_index>(nf); ++k) {
         matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
             if (fSet[k] == j) {
                 q[k] = 1.0 / w;
             } else {
-                triples.push_back({k, coarseIndex[j], w});
+                ++rowIdx[k + 1];
+            }
+        });
+    }
+
+    for (index k = 0; k < nf; ++k) {
+        rowIdx[k + 1] += rowIdx[k];
+    }
+
+    std::vector<Triplet> triples(rowIdx[nf]);
+#pragma omp parallel for
+    for (omp_index k = 0; k < static_cast<omp_index>(nf); ++k) { // Afc * -Aff^-1
+        index cIdx = rowIdx[k];
+        matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
+            if (fSet[k] != j) {
+                triples[cIdx++] = {static_cast<index>(k), coarseIndex[j], w * -q[k]};
             }
         });
     }
 
-    for (index i = 0; i < triples.size(); ++i) { // * -Aff^-1
-        triples[i].value *= -q[triples[i].row];
+    P = Matrix(nf, coarseIndex.size() - nf, triples);
+}
+
+template <class Matrix>
+void MultiLevelSetup<Matrix>::eliminationSchurComplement(const Matrix &matrix,
+                                                         const std::vector<index> &fSet,
+                                                         const std::vector<index> &cSet,
+                                                         const std::vector<index> &coarseIndex,
+                                                         const Matrix &P, Matrix &B) const {
+    std::vector<uint8_t> isFNode(matrix.numberOfRows(), false);
+#pragma omp parallel for
+    for (omp_index k = 0; k < static_cast<omp_index>(fSet.size()); ++k) {
+        isFNode[fSet[k]] = true;
     }
 
-    P = Matrix(fSet.size(), coarseIndex.size() - fSet.size(), triples);
+    // row i of Acc + Acf * P: the f neighbors of a c node contribute their rows of P
+    B = accumulateRows(cSet.size(), cSet.size(), [&](index i, auto &add) {
+        matrix.forNonZeroElementsInRow(cSet[i], [&](index j, double value) {
+            if (isFNode[j]) {
+                P.forNonZeroElementsInRow(coarseIndex[j],
+                                          [&](index l, double p) { add(l, value * p); });
+            } else {
+                add(coarseIndex[j], value);
+            }
+        });
+    });
 }
 
 template <class Matrix>
@@ -407,6 +545,10 @@ void MultiLevelSetup<Matrix>::coarseningAggregation(Matrix &matrix,
     Matrix affinityMatrix;
     computeAffinityMatrix(Wstrong, tVs, affinityMatrix);
 
+    // color the affinity graph to aggregate nodes of the same color in parallel
+    std::vector<index> color;
+    const count numColors = colorAffinityGraph(affinityMatrix, color);
+
     // mark all locally high-degree nodes as seeds
     addHighDegreeSeedNodes(matrix, status);
 
@@ -419,7 +561,7 @@ void MultiLevelSetup<Matrix>::coarseningAggregation(Matrix &matrix,
         nC = stage > 0 ? nc[stage - 1] : nc[0];
 
         // aggregation stage
-        aggregationStage(matrix, nC, Wstrong, affinityMatrix, tVs, status);
+        aggregationStage(matrix, nC, Wstrong, affinityMatrix, color, numColors, tVs, status);
 
         alpha = (double)nC / (double)matrix.numberOfRows();
         alpha <= maxCoarseningRatio ? B[stage] = 1.0 - alpha : B[stage] = 1.0 + alpha;
@@ -533,15 +675,21 @@ void MultiLevelSetup<Matrix>::addHighDegreeSeedNodes(const Matrix &matrix,
 template <class Matrix>
 void MultiLevelSetup<Matrix>::aggregateLooseNodes(const Matrix &strongAdjMatrix,
                                                   std::vector<index> &status, count &nc) const {
-    std::vector<index> looseNodes;
-    for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
+    std::vector<uint8_t> isLoose(strongAdjMatrix.numberOfRows(), false);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(strongAdjMatrix.numberOfRows()); ++i) {
         double max = std::numeric_limits<double>::min();
         strongAdjMatrix.forNonZeroElementsInRow(i, [&](index /*j*/, double value) {
             if (value > max)
                 max = value;
         });
 
-        if (std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min()) {
+        isLoose[i] = std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min();
+    }
+
+    std::vector<index> looseNodes;
+    for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
+        if (isLoose[i]) {
             looseNodes.push_back(i);
         }
     }
@@ -643,10 +791,74 @@ void MultiLevelSetup<Matrix>::computeAffinityMatrix(const Matrix &matrix,
     affinityMatrix = Matrix(matrix.numberOfRows(), matrix.numberOfColumns(), triplets);
 }
 
+template <class Matrix>
+count MultiLevelSetup<Matrix>::colorAffinityGraph(const Matrix &affinityMatrix,
+                                                  std::vector<index> &color) const {
+    const count n = affinityMatrix.numberOfRows();
+    color.assign(n, none);
+    std::vector<index> uncolored(n);
+    std::iota(uncolored.begin(), uncolored.end(), 0);
+    std::vector<uint8_t> highestPriority;
+
+    while (!uncolored.empty()) {
+        highestPriority.assign(uncolored.size(), true);
+#pragma omp parallel for schedule(guided)
+        for (omp_index k = 0; k < static_cast<omp_index>(uncolored.size()); ++k) {
+            const index u = uncolored[k];
+            affinityMatrix.forNonZeroElementsInRow(u, [&](index v, double /*value*/) {
+                if (v != u && color[v] == none && hasHigherPriority(v, u))
+                    highestPriority[k] = false;
+            });
+        }
+
+        // the selected nodes are not adjacent, so the colors of their neighbors do not change
+#pragma omp parallel
+        {
+            std::vector<index> neighborColors;
+#pragma omp for schedule(guided)
+            for (omp_index k = 0; k < static_cast<omp_index>(uncolored.size()); ++k) {
+                if (!highestPriority[k])
+                    continue;
+                const index u = uncolored[k];
+                neighborColors.clear();
+                affinityMatrix.forNonZeroElementsInRow(u, [&](index v, double /*value*/) {
+                    if (v != u && color[v] != none)
+                        neighborColors.push_back(color[v]);
+                });
+                std::sort(neighborColors.begin(), neighborColors.end());
+
+                index c = 0;
+                for (index neighborColor : neighborColors) {
+                    if (neighborColor == c)
+                        ++c;
+                    else if (neighborColor > c)
+                        break;
+                }
+                color[u] = c;
+            }
+        }
+
+        index numUncolored = 0;
+        for (index k = 0; k < uncolored.size(); ++k) {
+            if (!highestPriority[k])
+                uncolored[numUncolored++] = uncolored[k];
+        }
+        uncolored.resize(numUncolored);
+    }
+
+    count numColors = 0;
+    for (index i = 0; i < n; ++i) {
+        numColors = std::max(numColors, color[i] + 1);
+    }
+
+    return numColors;
+}
+
 template <class Matrix>
 void MultiLevelSetup<Matrix>::aggregationStage(const Matrix &matrix, count &nc,
                                                const Matrix &strongAdjMatrix,
                                                const Matrix &affinityMatrix,
+                                               const std::vector<index> &color, count numColors,
                                                std::vector<Vector> &tVs,
                                                std::vector<index> &status) const {
     std::vector<std::vector<index>> bins(10);
@@ -657,22 +869,54 @@ void MultiLevelSetup<Matrix>::aggregationStage(const Matrix &matrix, count &nc,
     for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
         diag[i] = matrix(i, i);
     }
+
+    std::vector<index> colorBegin(numColors + 1);
+    std::vector<index> nodesByColor;
+    std::vector<index> seeds;
+
     // Iterate over undecided nodes with strong neighbors in decreasing order of strongest neighbor
     for (index k = bins.size(); k-- > 0;) {
-        for (index i : bins[k]) {
-            if (status[i] == UNDECIDED) { // node is still undecided
-                index s = 0;
-                if (findBestSeedEnergyCorrected(strongAdjMatrix, affinityMatrix, diag, tVs, status,
-                                                i, s)) {
-                    status[s] = s; // s becomes seed
-                    status[i] = s; // i's seed is s
-                    nc--;
-
-                    for (index j = 0; j < tVs.size(); ++j) { // update test vectors
-                        tVs[j][i] = tVs[j][s];
+        const std::vector<index> &bin = bins[k];
+        std::fill(colorBegin.begin(), colorBegin.end(), 0);
+        for (index i : bin) {
+            ++colorBegin[color[i] + 1];
+        }
+        std::partial_sum(colorBegin.begin(), colorBegin.end(), colorBegin.begin());
+        nodesByColor.resize(bin.size());
+        for (index i : bin) { // bins are sorted, so are the nodes of each color
+            nodesByColor[colorBegin[color[i]]++] = i;
+        }
+        // colorBegin[c] now is the end of color c
+        seeds.assign(bin.size(), none);
+
+        for (index c = 0, begin = 0; c < numColors; begin = colorBegin[c++]) {
+            // Nodes of color c are not adjacent: they only read the status and test vectors of
+            // their neighbors and change their own. The chosen seeds are marked afterwards.
+            count numAggregated = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : numAggregated)
+            for (omp_index x = begin; x < static_cast<omp_index>(colorBegin[c]); ++x) {
+                const index i = nodesByColor[x];
+                if (status[i] == UNDECIDED) { // node is still undecided
+                    index s = 0;
+                    if (findBestSeedEnergyCorrected(strongAdjMatrix, affinityMatrix, diag, tVs,
+                                                    status, i, s)) {
+                        status[i] = s; // i's seed is s
+                        seeds[x] = s;
+                        numAggregated++;
+
+                        for (index j = 0; j < tVs.size(); ++j) { // update test vectors
+                            tVs[j][i] = tVs[j][s];
+                        }
                     }
                 }
             }
+
+            for (index x = begin; x < colorBegin[c]; ++x) {
+                if (seeds[x] != none) {
+                    status[seeds[x]] = seeds[x]; // s becomes seed
+                }
+            }
+            nc -= numAggregated;
         }
 
         if (nc <= matrix.numberOfRows() * SETUP_COARSENING_WORK_GUARD / SETUP_CYCLE_INDEX) {
@@ -813,23 +1057,48 @@ void MultiLevelSetup<Matrix>::galerkinOperator(const Matrix &P, const Matrix &A,
                                                const std::vector<index> &PColIndex,
                                                const std::vector<std::vector<index>> &PRowIndex,
                                                Matrix &B) const {
-    std::vector<Triplet> triplets;
-    SparseAccumulator spa(P.numberOfColumns());
-    for (index i = 0; i < P.numberOfColumns(); ++i) {
+    B = accumulateRows(P.numberOfColumns(), P.numberOfColumns(), [&](index i, auto &add) {
         for (index k : PRowIndex[i]) {
             double Pki = P(k, i);
             A.forNonZeroElementsInRow(k, [&](index l, double value) {
                 index j = PColIndex[l];
-                spa.scatter(Pki * value * P(l, j), j);
+                add(j, Pki * value * P(l, j));
             });
         }
+    });
+}
 
-        spa.gather([&](index i, index j, double value) { triplets.push_back({i, j, value}); });
-
-        spa.increaseRow();
+template <class Matrix>
+template <typename L>
+Matrix MultiLevelSetup<Matrix>::accumulateRows(count nRows, count nCols, L addRow) {
+    std::vector<std::vector<index>> columnIdx(nRows);
+    std::vector<std::vector<double>> values(nRows);
+#pragma omp parallel
+    {
+        SparseAccumulator spa(nCols);
+        auto add = [&](index j, double value) { spa.scatter(value, j); };
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+            addRow(static_cast<index>(i), add);
+            columnIdx[i].reserve(spa.size());
+            values[i].reserve(spa.size());
+            spa.gather([&](index /*row*/, index j, double value) {
+                columnIdx[i].push_back(j);
+                values[i].push_back(value);
+            });
+            spa.increaseRow();
+        }
     }
 
-    B = CSRMatrix(P.numberOfColumns(), P.numberOfColumns(), triplets);
+    if constexpr (std::is_same_v<Matrix, CSRMatrix>) {
+        return CSRMatrix(nRows, nCols, columnIdx, values, 0.0, true);
+    } else {
+        std::vector<Triplet> triplets;
+        for (index i = 0; i < nRows; ++i)
+            for (index k = 0; k < columnIdx[i].size(); ++k)
+                triplets.push_back({i, columnIdx[i][k], values[i][k]});
+        return Matrix(nRows, nCols, triplets);
+    }
 }
 
 template <>
@@ -933,51 +1202,44 @@ inline void MultiLevelSetup<CSRMatrix>::computeAffinityMatrix(const CSRMatrix &m
                                nonZeros, 0.0, matrix.sorted());
 }
 
-template <>
-inline void MultiLevelSetup<CSRMatrix>::galerkinOperator(
-    const CSRMatrix &P, const CSRMatrix &A, const std::vector<index> &PColIndex,
-    const std::vector<std::vector<index>> &PRowIndex, CSRMatrix &B) const {
-    std::vector<Triplet> triplets;
-    SparseAccumulator spa(P.numberOfColumns());
-    for (index i = 0; i < P.numberOfColumns(); ++i) {
-        for (index k : PRowIndex[i]) {
-            double Pki = P(k, i);
-            A.forNonZeroElementsInRow(k, [&](index l, double value) {
-                index j = PColIndex[l];
-                spa.scatter(Pki * value * P(l, j), j);
-            });
-        }
-
-        spa.gather([&](index i, index j, double value) { triplets.push_back({i, j, value}); });
-
-        spa.increaseRow();
-    }
-
-    B = CSRMatrix(P.numberOfColumns(), P.numberOfColumns(), triplets, 0.0, true);
-}
-
 template <>
 inline void MultiLevelSetup<CSRMatrix>::eliminationOperators(const CSRMatrix &matrix,
                                                              const std::vector<index> &fSet,
                                                              const std::vector<index> &coarseIndex,
                                                              CSRMatrix &P, Vector &q) const {
-    std::vector<Triplet> triples;
-    q = Vector(fSet.size());
-    for (index k = 0; k < fSet.size(); ++k) { // Afc
+    const count nf = fSet.size();
+    std::vector<index> rowIdx(nf + 1, 0);
+    q = Vector(nf);
+#pragma omp parallel for
+    for (omp_index k = 0; k < static_cast<omp_index>(nf); ++k) {
         matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
             if (fSet[k] == j) {
                 q[k] = 1.0 / w;
             } else {
-                triples.push_back({k, coarseIndex[j], w});
+                ++rowIdx[k + 1];
             }
         });
     }
 
-    for (index i = 0; i < triples.size(); ++i) { // * -Aff^-1
-        triples[i].value *= -q[triples[i].row];
+    for (index k = 0; k < nf; ++k) {
+        rowIdx[k + 1] += rowIdx[k];
+    }
+
+    std::vector<index> columnIdx(rowIdx[nf]);
+    std::vector<double> nonZeros(rowIdx[nf]);
+#pragma omp parallel for
+    for (omp_index k = 0; k < static_cast<omp_index>(nf); ++k) { // Afc * -Aff^-1
+        index cIdx = rowIdx[k];
+        matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
+            if (fSet[k] != j) {
+                columnIdx[cIdx] = coarseIndex[j];
+                nonZeros[cIdx] = w * -q[k];
+                ++cIdx;
+            }
+        });
     }
 
-    P = CSRMatrix(fSet.size(), coarseIndex.size() - fSet.size(), triples, 0.0, matrix.sorted());
+    P = CSRMatrix(nf, coarseIndex.size() - nf, rowIdx, columnIdx, nonZeros, 0.0, matrix.sorted());
 }
 
 template <>
@@ -1008,6 +1270,10 @@ inline void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix &matrix,
     CSRMatrix affinityMatrix;
     computeAffinityMatrix(Wstrong, tVs, affinityMatrix);
 
+    // color the affinity graph to aggregate nodes of the same color in parallel
+    std::vector<index> color;
+    const count numColors = colorAffinityGraph(affinityMatrix, color);
+
     // mark all locally high-degree nodes as seeds
     addHighDegreeSeedNodes(matrix, status);
 
@@ -1020,7 +1286,7 @@ inline void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix &matrix,
         nC = stage > 0 ? nc[stage - 1] : nc[0];
 
         // aggregation stage
-        aggregationStage(matrix, nC, Wstrong, affinityMatrix, tVs, status);
+        aggregationStage(matrix, nC, Wstrong, affinityMatrix, color, numColors, tVs, status);
 
         alpha = (double)nC / (double)matrix.numberOfRows();
         alpha <= maxCoarseningRatio ? B[stage] = 1.0 - alpha : B[stage] = 1.0 + alpha;
@@ -58,6 +58,17 @@ private:
     // bStages for Elimination Levels
     std::vector<std::vector<Vector>> bStages;
 
+    // residual of each level, reused by all cycles of a solve
+    std::vector<Vector> residuals;
+
+    // Computes b - A x for the Laplacian A of @a level into residuals[level] and returns it.
+    const Vector &residual(index level, const Vector &x, const Vector &b) {
+        Vector &r = residuals[level];
+        r = b;
+        Vector::matrixVectorProduct(hierarchy.at(level).getLaplacian(), x, r, -1.0, 1.0);
+        return r;
+    }
+
     void solveCycle(Vector &x, const Vector &b, int finest, LAMGSolverStatus &status);
     void cycle(Vector &x, const Vector &b, int finest, int coarsest, std::vector<count> &numVisits,
                std::vector<Vector> &X, std::vector<Vector> &B, const LAMGSolverStatus &status);
@@ -148,6 +159,7 @@ void SolverLamg<Matrix>::solveCycle(Vector &x, const Vector &b, int finest,
     std::vector<count> numVisits(coarsest);
     std::vector<Vector> X(hierarchy.size());
     std::vector<Vector> B(hierarchy.size());
+    residuals = std::vector<Vector>(hierarchy.size());
 
     for (index i = 0; i < hierarchy.size(); ++i) {
         history[i] =
@@ -156,23 +168,23 @@ void SolverLamg<Matrix>::solveCycle(Vector &x, const Vector &b, int finest,
             std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
     }
 
-    Vector r = b - hierarchy.at(finest).getLaplacian() * x;
-    double residual = r.length();
-    double finalResidual = residual * status.desiredResidualReduction;
+    const Vector &r = residual(finest, x, b);
+    double residualNorm = r.length();
+    double finalResidual = residualNorm * status.desiredResidualReduction;
     double bestResidual = std::numeric_limits<double>::max();
 
     count iterations = 0;
-    status.residualHistory.emplace_back(residual);
+    status.residualHistory.emplace_back(residualNorm);
     count noResReduction = 0;
-    while (residual > finalResidual && noResReduction < 5 && iterations < status.maxIters
+    while (residualNorm > finalResidual && noResReduction < 5 && iterations < status.maxIters
            && timer.elapsedMilliseconds() <= status.maxConvergenceTime) {
         cycle(x, b, finest, coarsest, numVisits, X, B, status);
-        r = b - hierarchy.at(finest).getLaplacian() * x;
-        residual = r.length();
-        status.residualHistory.emplace_back(residual);
-        if (residual < bestResidual) {
+        residual(finest, x, b);
+        residualNorm = r.length();
+        status.residualHistory.emplace_back(residualNorm);
+        if (residualNorm < bestResidual) {
             noResReduction = 0;
-            bestResidual = residual;
+            bestResidual = residualNorm;
         } else {
             ++noResReduction;
         }
@@ -182,8 +194,8 @@ void SolverLamg<Matrix>::solveCycle(Vector &x, const Vector &b, int finest,
     timer.stop();
 
     status.numIters = iterations;
-    status.residual = r.length();
-    status.converged = r.length() <= finalResidual;
+    status.residual = residualNorm;
+    status.converged = residualNorm <= finalResidual;
 }
 
 template <class Matrix>
@@ -198,14 +210,13 @@ void SolverLamg<Matrix>::cycle(Vector &x, const Vector &b, int finest, int coars
     int nextLvl = finest;
     double maxVisits = 0.0;
 
-    saveIterate(currLvl, X[currLvl],
-                B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl]);
+    saveIterate(currLvl, X[currLvl], residual(currLvl, X[currLvl], B[currLvl]));
     while (true) {
         if (currLvl == coarsest) {
             nextLvl = currLvl - 1;
             if (currLvl == finest) { // finest level
-                X[currLvl] = smoother.relax(hierarchy.at(currLvl).getLaplacian(), B[currLvl],
-                                            X[currLvl], status.numPreSmoothIters);
+                smoother.relaxInPlace(hierarchy.at(currLvl).getLaplacian(), B[currLvl], X[currLvl],
+                                      status.numPreSmoothIters);
             } else {
                 Vector bCoarse(B[currLvl].getDimension() + 1, 0.0);
                 for (index i = 0; i < B[currLvl].getDimension(); ++i) {
@@ -238,15 +249,15 @@ void SolverLamg<Matrix>::cycle(Vector &x, const Vector &b, int finest, int coars
             numVisits[currLvl]++;
 
             if (hierarchy.getType(nextLvl) != ELIMINATION) {
-                X[currLvl] = smoother.relax(hierarchy.at(currLvl).getLaplacian(), B[currLvl],
-                                            X[currLvl], status.numPreSmoothIters);
+                smoother.relaxInPlace(hierarchy.at(currLvl).getLaplacian(), B[currLvl], X[currLvl],
+                                      status.numPreSmoothIters);
             }
 
             if (hierarchy.getType(nextLvl) == ELIMINATION) {
                 hierarchy.at(nextLvl).restrict(B[currLvl], B[nextLvl], bStages[nextLvl]);
             } else {
-                hierarchy.at(nextLvl).restrict(
-                    B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl], B[nextLvl]);
+                hierarchy.at(nextLvl).restrict(residual(currLvl, X[currLvl], B[currLvl]),
+                                               B[nextLvl]);
             }
 
             hierarchy.at(nextLvl).coarseType(X[currLvl], X[nextLvl]);
@@ -254,13 +265,11 @@ void SolverLamg<Matrix>::cycle(Vector &x, const Vector &b, int finest, int coars
             clearHistory(nextLvl);
         } else { // postProcess
             if (currLvl == coarsest || hierarchy.getType(currLvl + 1) != ELIMINATION) {
-                minRes(currLvl, X[currLvl],
-                       B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl]);
+                minRes(currLvl, X[currLvl], residual(currLvl, X[currLvl], B[currLvl]));
             }
 
             if (nextLvl > finest) {
-                saveIterate(nextLvl, X[nextLvl],
-                            B[nextLvl] - hierarchy.at(nextLvl).getLaplacian() * X[nextLvl]);
+                saveIterate(nextLvl, X[nextLvl], residual(nextLvl, X[nextLvl], B[nextLvl]));
             }
 
             if (hierarchy.getType(currLvl) == ELIMINATION) {
@@ -272,8 +281,8 @@ void SolverLamg<Matrix>::cycle(Vector &x, const Vector &b, int finest, int coars
             }
 
             if (hierarchy.getType(currLvl) != ELIMINATION) {
-                X[nextLvl] = smoother.relax(hierarchy.at(nextLvl).getLaplacian(), B[nextLvl],
-                                            X[nextLvl], status.numPostSmoothIters);
+                smoother.relaxInPlace(hierarchy.at(nextLvl).getLaplacian(), B[nextLvl], X[nextLvl],
+                                      status.numPostSmoothIters);
             }
         }
 
@@ -283,7 +292,7 @@ void SolverLamg<Matrix>::cycle(Vector &x, const Vector &b, int finest, int coars
     // post-cycle finest
     if ((int64_t)hierarchy.size() > finest + 1 && hierarchy.getType(finest + 1) != ELIMINATION) {
         // Do an iterate recombination on calculated solutions
-        minRes(finest, X[finest], B[finest] - hierarchy.at(finest).getLaplacian() * X[finest]);
+        minRes(finest, X[finest], residual(finest, X[finest], B[finest]));
     }
 
     X[finest] -= X[finest].mean();
@@ -44,12 +44,40 @@ public:
      * Returns the preconditioned right-hand-side \f$P(b) = D(A)^{-1}b\f$.
      */
     Vector rhs(const Vector &b) const {
-        assert(b.getDimension() == inv_diag.getDimension());
         Vector out(b.getDimension());
-        for (index i = 0; i < b.getDimension(); ++i) {
+        rhs(b, out);
+        return out;
+    }
+
+    /**
+     * Writes the preconditioned right-hand-side \f$P(b) = D(A)^{-1}b\f$ to @a out, which must
+     * have the dimension of @a b.
+     */
+    void rhs(const Vector &b, Vector &out) const {
+        assert(b.getDimension() == inv_diag.getDimension());
+        assert(out.getDimension() == b.getDimension());
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(b.getDimension()); ++i) {
             out[i] = inv_diag[i] * b[i];
         }
-        return out;
+    }
+
+    /**
+     * Computes the preconditioned right-hand-sides of a block of @a blockSize vectors. The block
+     * is stored row by row, i.e. entry i of vector c is b[i * blockSize + c].
+     */
+    void rhs(const std::vector<double> &b, std::vector<double> &out, count blockSize) const {
+        assert(b.size() == inv_diag.getDimension() * blockSize);
+        out.resize(b.size());
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(inv_diag.getDimension()); ++i) {
+            const double d = inv_diag[i];
+            const double *bi = b.data() + i * blockSize;
+            double *outi = out.data() + i * blockSize;
+#pragma omp simd
+            for (index c = 0; c < blockSize; ++c)
+                outi[c] = d * bi[c];
+        }
     }
 
 private:
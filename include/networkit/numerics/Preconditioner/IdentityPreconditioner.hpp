@@ -8,6 +8,10 @@
 #ifndef NETWORKIT_NUMERICS_PRECONDITIONER_IDENTITY_PRECONDITIONER_HPP_
 #define NETWORKIT_NUMERICS_PRECONDITIONER_IDENTITY_PRECONDITIONER_HPP_
 
+#include <vector>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
+
 namespace NetworKit {
 
 /**
@@ -29,6 +33,18 @@ public:
      * Returns the preconditioned right-hand-side \f$P(b) = b\f$.
      */
     Vector rhs(const Vector &b) const { return b; }
+
+    /**
+     * Copies @a b to @a out.
+     */
+    void rhs(const Vector &b, Vector &out) const { out = b; }
+
+    /**
+     * Copies the block @a b of right-hand-sides to @a out.
+     */
+    void rhs(const std::vector<double> &b, std::vector<double> &out, count /*blockSize*/) const {
+        out = b;
+    }
 };
 
 } /* namespace NetworKit */
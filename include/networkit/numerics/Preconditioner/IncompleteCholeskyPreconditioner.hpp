@@ -0,0 +1,202 @@
+/*
+ * IncompleteCholeskyPreconditioner.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_NUMERICS_PRECONDITIONER_INCOMPLETE_CHOLESKY_PRECONDITIONER_HPP_
+#define NETWORKIT_NUMERICS_PRECONDITIONER_INCOMPLETE_CHOLESKY_PRECONDITIONER_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Incomplete Cholesky factorization without fill-in (IC(0)) of a symmetric positive
+ * (semi-)definite matrix A. The factor L has the sparsity pattern of the lower triangular part of
+ * A and the preconditioner applies (L L^T)^{-1} by a forward and a backward substitution.
+ *
+ * Laplacian matrices are singular and dropping the fill-in can make pivots vanish. Pivots that
+ * are smaller than pivotTolerance times the diagonal entry of A are replaced by that diagonal
+ * entry, i.e., the corresponding row falls back to the diagonal preconditioner.
+ */
+class IncompleteCholeskyPreconditioner {
+public:
+    //! Relative size below which a pivot is replaced by the diagonal entry of A.
+    static constexpr double pivotTolerance = 1e-3;
+
+    /** Default constructor */
+    IncompleteCholeskyPreconditioner() = default;
+
+    /**
+     * Computes the IC(0) factorization of the symmetric matrix @a A.
+     * @param A
+     */
+    IncompleteCholeskyPreconditioner(const CSRMatrix &A)
+        : rowBegin(A.numberOfRows() + 1, 0), diag(A.numberOfRows(), 0.0) {
+        assert(A.numberOfColumns() == A.numberOfRows());
+        const count n = A.numberOfRows();
+
+        std::vector<double> diagA(n, 0.0);
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            A.forNonZeroElementsInRow(i, [&](index j, double value) {
+                if (j < static_cast<index>(i))
+                    ++rowBegin[i + 1];
+                else if (j == static_cast<index>(i))
+                    diagA[i] += value;
+            });
+        }
+
+        for (index i = 0; i < n; ++i) {
+            rowBegin[i + 1] += rowBegin[i];
+        }
+
+        columns.resize(rowBegin[n]);
+        values.resize(rowBegin[n]);
+#pragma omp parallel
+        {
+            std::vector<std::pair<index, double>> row;
+#pragma omp for
+            for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+                row.clear();
+                A.forNonZeroElementsInRow(i, [&](index j, double value) {
+                    if (j < static_cast<index>(i))
+                        row.emplace_back(j, value);
+                });
+                std::sort(row.begin(), row.end());
+                for (index p = 0; p < row.size(); ++p) {
+                    columns[rowBegin[i] + p] = row[p].first;
+                    values[rowBegin[i] + p] = row[p].second;
+                }
+            }
+        }
+
+        // Row i of L depends on all previous rows, so the factorization is sequential.
+        for (index i = 0; i < n; ++i) {
+            for (index p = rowBegin[i]; p < rowBegin[i + 1]; ++p) {
+                // L_ik = (A_ik - sum_{j < k} L_ij L_kj) / L_kk, restricted to the pattern of A
+                const index k = columns[p];
+                double sum = values[p];
+                index a = rowBegin[i], b = rowBegin[k];
+                while (a < p && b < rowBegin[k + 1]) {
+                    if (columns[a] == columns[b]) {
+                        sum -= values[a++] * values[b++];
+                    } else if (columns[a] < columns[b]) {
+                        ++a;
+                    } else {
+                        ++b;
+                    }
+                }
+                values[p] = sum / diag[k];
+            }
+
+            double pivot = diagA[i];
+            for (index p = rowBegin[i]; p < rowBegin[i + 1]; ++p) {
+                pivot -= values[p] * values[p];
+            }
+
+            if (diagA[i] <= 0) { // empty row, leave it unchanged
+                diag[i] = 1.0;
+            } else {
+                diag[i] = std::sqrt(pivot > pivotTolerance * diagA[i] ? pivot : diagA[i]);
+            }
+        }
+    }
+
+    virtual ~IncompleteCholeskyPreconditioner() = default;
+
+    /**
+     * Returns the preconditioned right-hand-side \f$P(b) = (L L^T)^{-1}b\f$.
+     */
+    Vector rhs(const Vector &b) const {
+        Vector out(b.getDimension());
+        rhs(b, out);
+        return out;
+    }
+
+    /**
+     * Writes the preconditioned right-hand-side \f$P(b) = (L L^T)^{-1}b\f$ to @a out, which
+     * must have the dimension of @a b.
+     */
+    void rhs(const Vector &b, Vector &out) const {
+        const count n = diag.size();
+        assert(b.getDimension() == n && out.getDimension() == n);
+
+        for (index i = 0; i < n; ++i) {
+            double yi = b[i];
+            for (index p = rowBegin[i]; p < rowBegin[i + 1]; ++p)
+                yi -= values[p] * out[columns[p]];
+            out[i] = yi / diag[i];
+        }
+
+        for (index i = n; i-- > 0;) {
+            const double xi = out[i] / diag[i];
+            out[i] = xi;
+            for (index p = rowBegin[i]; p < rowBegin[i + 1]; ++p)
+                out[columns[p]] -= values[p] * xi;
+        }
+    }
+
+    /**
+     * Computes the preconditioned right-hand-sides of a block of @a blockSize vectors. The block
+     * is stored row by row, i.e. entry i of vector c is b[i * blockSize + c]. The substitutions
+     * are sequential, but process the whole block at once.
+     */
+    void rhs(const std::vector<double> &b, std::vector<double> &out, count blockSize) const {
+        const count n = diag.size();
+        assert(b.size() == n * blockSize);
+        out = b;
+
+        // forward substitution L y = b
+        for (index i = 0; i < n; ++i) {
+            double *yi = out.data() + i * blockSize;
+            for (index p = rowBegin[i]; p < rowBegin[i + 1]; ++p) {
+                const double lij = values[p];
+                const double *yj = out.data() + columns[p] * blockSize;
+#pragma omp simd
+                for (index c = 0; c < blockSize; ++c)
+                    yi[c] -= lij * yj[c];
+            }
+            const double invDiag = 1.0 / diag[i];
+#pragma omp simd
+            for (index c = 0; c < blockSize; ++c)
+                yi[c] *= invDiag;
+        }
+
+        // backward substitution L^T x = y, row i of L is column i of L^T
+        for (index i = n; i-- > 0;) {
+            double *xi = out.data() + i * blockSize;
+            const double invDiag = 1.0 / diag[i];
+#pragma omp simd
+            for (index c = 0; c < blockSize; ++c)
+                xi[c] *= invDiag;
+            for (index p = rowBegin[i]; p < rowBegin[i + 1]; ++p) {
+                const double lij = values[p];
+                double *xj = out.data() + columns[p] * blockSize;
+#pragma omp simd
+                for (index c = 0; c < blockSize; ++c)
+                    xj[c] -= lij * xi[c];
+            }
+        }
+    }
+
+private:
+    // strictly lower triangular part of L by row, with sorted columns
+    std::vector<index> rowBegin;
+    std::vector<index> columns;
+    std::vector<double> values;
+    // diagonal of L
+    std::vector<double> diag;
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_NUMERICS_PRECONDITIONER_INCOMPLETE_CHOLESKY_PRECONDITIONER_HPP_
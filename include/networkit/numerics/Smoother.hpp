@@ -30,6 +30,16 @@ public:
                          count maxIterations = std::numeric_limits<count>::max()) const = 0;
     virtual Vector relax(const Matrix &A, const Vector &b,
                          count maxIterations = std::numeric_limits<count>::max()) const = 0;
+
+    /**
+     * Relaxes the system \f$Ax = b\f$ in place, starting with @a x as initial guess. The
+     * default implementation calls relax(); smoothers that can work on @a x directly should
+     * override it to avoid the copies.
+     */
+    virtual void relaxInPlace(const Matrix &A, const Vector &b, Vector &x,
+                              count maxIterations = std::numeric_limits<count>::max()) const {
+        x = relax(A, b, x, maxIterations);
+    }
 };
 
 } /* namespace NetworKit */
@@ -0,0 +1,93 @@
+/*
+ * BatchApproximatePageRank.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_SCD_BATCH_APPROXIMATE_PAGE_RANK_HPP_
+#define NETWORKIT_SCD_BATCH_APPROXIMATE_PAGE_RANK_HPP_
+
+#include <utility>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup scd
+ * Computes approximate personalized PageRank vectors for many seeds at once. Each vector is the
+ * same as the one computed by ApproximatePageRank for a single seed: residual mass is pushed
+ * (lazy random walk with loop probability alpha) until no node u has a residual of at least
+ * epsilon * vol(u). As in ApproximatePageRank, the mass pushed along self-loops is dropped.
+ *
+ * The seeds are processed in parallel. Each thread keeps its score and residual arrays and its
+ * work queue for all of its seeds and only resets the entries touched by the previous seed, so
+ * a query does not allocate beyond its result. The precomputed volumes are shared by all threads.
+ *
+ * Optionally, the result can be truncated to the k nodes with the highest scores, and the
+ * residual that is left after the push phase can be distributed by random walks (forward push
+ * with Monte Carlo refinement, as in FORA by Wang et al., KDD 2017). The latter allows to use a
+ * much larger epsilon for the same accuracy on the nodes with high scores.
+ */
+class BatchApproximatePageRank final : public Algorithm {
+
+public:
+    /**
+     * @param G The graph, which should not be directed.
+     * @param seeds The seed node of each personalized PageRank vector.
+     * @param alpha Loop probability of random walk.
+     * @param epsilon Error tolerance of the push phase.
+     */
+    BatchApproximatePageRank(const Graph &G, std::vector<node> seeds, double alpha,
+                             double epsilon = 1e-12);
+
+    /**
+     * Keep only the @a k nodes with the highest scores in each vector; 0 (the default) keeps all
+     * nodes with a positive score.
+     */
+    void setTopK(count k) { topK = k; }
+
+    /**
+     * After the push phase, distribute the remaining residual of each vector by @a numWalks
+     * random walks in total (0, the default, disables this phase). Each node with residual
+     * starts a number of walks proportional to its residual, but at least one.
+     */
+    void setMonteCarloWalks(count numWalks) { monteCarloWalks = numWalks; }
+
+    /**
+     * Computes the vectors of all seeds.
+     */
+    void run() override;
+
+    /**
+     * @return The approximate PageRank vector of the @a i-th seed as (node, score) pairs. If
+     * setTopK() was used, the pairs are sorted by decreasing score.
+     */
+    const std::vector<std::pair<node, double>> &getScores(index i) const {
+        assureFinished();
+        return scores[i];
+    }
+
+    /**
+     * @return The approximate PageRank vectors of all seeds, in the order of the seeds.
+     */
+    const std::vector<std::vector<std::pair<node, double>>> &getScores() const {
+        assureFinished();
+        return scores;
+    }
+
+private:
+    const Graph *G;
+    std::vector<node> seeds;
+    double alpha;
+    double epsilon;
+    count topK = 0;
+    count monteCarloWalks = 0;
+
+    std::vector<std::vector<std::pair<node, double>>> scores;
+};
+
+} /* namespace NetworKit */
+#endif // NETWORKIT_SCD_BATCH_APPROXIMATE_PAGE_RANK_HPP_
@@ -19,6 +19,12 @@ from networkit.algebraic import adjacencyEigenvector, PageRankMatrix, symmetricE
 cdef extern from "limits.h":
 	cdef uint64_t ULONG_MAX
 
+cdef extern from "<networkit/Globals.hpp>" namespace "NetworKit":
+
+	index _none "NetworKit::none"
+
+none = _none
+
 cdef extern from "<networkit/centrality/Centrality.hpp>":
 
 	cdef cppclass _Centrality "NetworKit::Centrality"(_Algorithm):
@@ -132,6 +138,9 @@ cdef extern from "<networkit/centrality/Betweenness.hpp>":
 	cdef cppclass _Betweenness "NetworKit::Betweenness" (_Centrality):
 		_Betweenness(_Graph, bool_t, bool_t) except +
 		vector[double] edgeScores() except +
+		void setBatchSize(count) except +
+		count getBatchSize()
+		void setMemoryBudget(count)
 
 cdef class Betweenness(Centrality):
 	"""
@@ -170,6 +179,53 @@ cdef class Betweenness(Centrality):
 		"""
 		return (<_Betweenness*>(self._this)).edgeScores()
 
+	def setBatchSize(self, batchSize=None):
+		"""
+		setBatchSize(batchSize=None)
+
+		Sets the number of sources that are processed together by one bit-parallel BFS on
+		unweighted graphs (at most 64, default: the largest batch size that fits into the memory
+		budget). The memory is at most 24 + 40 * batchSize bytes per node, independent of the
+		number of threads. A batch size of 0 runs one BFS per thread instead. Weighted graphs
+		always use one Dijkstra per thread.
+
+		Parameters
+		----------
+		batchSize : int or None, optional
+			The number of sources per batch. None (or networkit.centrality.none) chooses it from
+			the memory budget again. Default: None
+		"""
+		(<_Betweenness*>(self._this)).setBatchSize(_none if batchSize is None else batchSize)
+
+	def getBatchSize(self):
+		"""
+		getBatchSize()
+
+		Returns the number of sources that are processed together on unweighted graphs.
+
+		Returns
+		-------
+		int
+			The batch size.
+		"""
+		return (<_Betweenness*>(self._this)).getBatchSize()
+
+	def setMemoryBudget(self, count budget):
+		"""
+		setMemoryBudget(budget)
+
+		Sets the number of bytes that the buffers of run() should not exceed (default: 1 GiB).
+		Unless a batch size is set, the largest batch that fits into the budget is used, but at
+		least one source. If one BFS or Dijkstra runs per thread, fewer threads are used if their
+		buffers would exceed the budget, but at least one.
+
+		Parameters
+		----------
+		budget : int
+			The memory budget in bytes.
+		"""
+		(<_Betweenness*>(self._this)).setMemoryBudget(budget)
+
 cdef extern from "<networkit/centrality/ApproxBetweenness.hpp>":
 
 	cdef cppclass _ApproxBetweenness "NetworKit::ApproxBetweenness" (_Centrality):
@@ -1878,11 +1934,22 @@ class EdgeDirection(object):
 	inEdges = IN_EDGES # this + following added for backwards compatibility
 	outEdges = OUT_EDGES
 
+cdef extern from "<networkit/algebraic/PullSpMV.hpp>" namespace "NetworKit::SpMVPrecision":
+
+	cpdef enum _SpMVPrecision "NetworKit::SpMVPrecision":
+		DOUBLE,
+		SINGLE
+
+class SpMVPrecision(object):
+	DOUBLE = _SpMVPrecision.DOUBLE
+	SINGLE = _SpMVPrecision.SINGLE
+
 cdef extern from "<networkit/centrality/KatzCentrality.hpp>":
 
 	cdef cppclass _KatzCentrality "NetworKit::KatzCentrality" (_Centrality):
 		_KatzCentrality(_Graph, double, double, double) except +
 		_EdgeDirection edgeDirection
+		_SpMVPrecision precision
 
 cdef class KatzCentrality(Centrality):
 	"""
@@ -1926,6 +1993,23 @@ cdef class KatzCentrality(Centrality):
 			""" Use a different edge direction. """
 			(<_KatzCentrality*>(self._this)).edgeDirection = edgeDirection
 
+	property precision:
+		"""
+		Property :code:`precision` sets the precision of the edge weights and scores in the
+		matrix-vector products. Can be one of the following:
+
+		- networkit.centrality.SpMVPrecision.DOUBLE
+		- networkit.centrality.SpMVPrecision.SINGLE
+
+		Default: networkit.centrality.SpMVPrecision.DOUBLE
+		"""
+		def __get__(self):
+			""" Get the used precision. """
+			return (<_KatzCentrality*>(self._this)).precision
+		def __set__(self, _SpMVPrecision precision):
+			""" Use a different precision. """
+			(<_KatzCentrality*>(self._this)).precision = precision
+
 cdef extern from "<networkit/centrality/DynKatzCentrality.hpp>":
 
 	cdef cppclass _DynKatzCentrality "NetworKit::DynKatzCentrality" (_Centrality, _DynAlgorithm):
@@ -2271,10 +2355,207 @@ cdef class CoreDecomposition(Centrality):
 		"""
 		return (<_CoreDecomposition*>(self._this)).getNodeOrder()
 
+cdef extern from "<networkit/centrality/ParallelCoreDecomposition.hpp>" namespace "NetworKit::ParallelCoreDecomposition::Mode":
+
+	cpdef enum _CoreDecompositionMode "NetworKit::ParallelCoreDecomposition::Mode":
+		PEELING,
+		H_INDEX
+
+class CoreDecompositionMode(object):
+	PEELING = _CoreDecompositionMode.PEELING
+	H_INDEX = _CoreDecompositionMode.H_INDEX
+
+cdef extern from "<networkit/centrality/ParallelCoreDecomposition.hpp>":
+
+	cdef cppclass _CoreHierarchy "NetworKit::ParallelCoreDecomposition::CoreHierarchy":
+		vector[double] level
+		vector[index] parent
+		_Partition shells
+
+	cdef cppclass _ParallelCoreDecomposition "NetworKit::ParallelCoreDecomposition" (_Centrality):
+		_ParallelCoreDecomposition(_Graph, bool_t) except +
+		void setMode(_CoreDecompositionMode) except +
+		count numberOfIterations() except +
+		bool_t hasConverged() except +
+		double maxCoreNumber() except +
+		_Partition getPartition() except +
+		_CoreHierarchy getCoreHierarchy() except +
+		count maxIterations
+
+cdef class ParallelCoreDecomposition(Centrality):
+	"""
+	ParallelCoreDecomposition(G, useEdgeWeights=False)
+
+	Parallel k-core decomposition. Self-loops are ignored and directed graphs are treated as
+	undirected. If edge weights are used, the s-cores (cores of the weighted degree) are computed.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The graph.
+	useEdgeWeights : bool, optional
+		Compute s-cores of a weighted graph. Edge weights must not be negative. Default: False
+	"""
+
+	def __cinit__(self, Graph G, bool_t useEdgeWeights=False):
+		self._G = G
+		self._this = new _ParallelCoreDecomposition(G._this, useEdgeWeights)
+
+	def setMode(self, mode):
+		"""
+		setMode(mode)
+
+		Sets the algorithm. Can be one of the following:
+
+		- networkit.centrality.CoreDecompositionMode.PEELING (exact, default)
+		- networkit.centrality.CoreDecompositionMode.H_INDEX (iterative, bounded by maxIterations)
+
+		Parameters
+		----------
+		mode : networkit.centrality.CoreDecompositionMode
+			The algorithm.
+		"""
+		(<_ParallelCoreDecomposition*>(self._this)).setMode(mode)
+
+	property maxIterations:
+		"""
+		Maximum number of iterations of the H_INDEX mode. Default: unbounded
+		"""
+		def __get__(self):
+			return (<_ParallelCoreDecomposition*>(self._this)).maxIterations
+		def __set__(self, count maxIterations):
+			(<_ParallelCoreDecomposition*>(self._this)).maxIterations = maxIterations
+
+	def numberOfIterations(self):
+		"""
+		numberOfIterations()
+
+		Returns
+		-------
+		int
+			The number of peeling rounds or h-index iterations of the last run.
+		"""
+		return (<_ParallelCoreDecomposition*>(self._this)).numberOfIterations()
+
+	def hasConverged(self):
+		"""
+		hasConverged()
+
+		Returns
+		-------
+		bool
+			True if the scores are the exact core numbers.
+		"""
+		return (<_ParallelCoreDecomposition*>(self._this)).hasConverged()
+
+	def maxCoreNumber(self):
+		"""
+		maxCoreNumber()
+
+		Returns
+		-------
+		float
+			The maximum core number.
+		"""
+		return (<_ParallelCoreDecomposition*>(self._this)).maxCoreNumber()
+
+	def getPartition(self):
+		"""
+		getPartition()
+
+		Get the shells as a partition object.
+
+		Returns
+		-------
+		networkit.Partition
+			The shells.
+		"""
+		return Partition().setThis((<_ParallelCoreDecomposition*>(self._this)).getPartition())
+
+	def getCoreHierarchy(self):
+		"""
+		getCoreHierarchy()
+
+		Get the hierarchy of the connected components of the cores.
+
+		Returns
+		-------
+		tuple(list(float), list(int), networkit.Partition)
+			The core level and the parent of each component, and the component of each node at
+			the level of its own core number.
+		"""
+		cdef _CoreHierarchy h = (<_ParallelCoreDecomposition*>(self._this)).getCoreHierarchy()
+		return h.level, h.parent, Partition().setThis(h.shells)
+
+cdef extern from "<networkit/centrality/DynCoreDecomposition.hpp>":
+
+	cdef cppclass _DynCoreDecomposition "NetworKit::DynCoreDecomposition" (_Centrality, _DynAlgorithm):
+		_DynCoreDecomposition(_Graph) except +
+		count coreNumber(node) except +
+		count maxCoreNumber() except +
+		count numberOfVisitedNodes() except +
+
+cdef class DynCoreDecomposition(Centrality, DynAlgorithm):
+	"""
+	DynCoreDecomposition(G)
+
+	Maintains the core numbers of an unweighted graph under edge insertions and removals. Only
+	the nodes whose core number may change are visited. Self-loops are ignored and directed graphs
+	are treated as undirected. Call update() or updateBatch() after modifying the graph.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The graph.
+	"""
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _DynCoreDecomposition(G._this)
+
+	def coreNumber(self, node u):
+		"""
+		coreNumber(u)
+
+		Parameters
+		----------
+		u : int
+			A node.
+
+		Returns
+		-------
+		int
+			The core number of `u`.
+		"""
+		return (<_DynCoreDecomposition*>(self._this)).coreNumber(u)
+
+	def maxCoreNumber(self):
+		"""
+		maxCoreNumber()
+
+		Returns
+		-------
+		int
+			The maximum core number.
+		"""
+		return (<_DynCoreDecomposition*>(self._this)).maxCoreNumber()
+
+	def numberOfVisitedNodes(self):
+		"""
+		numberOfVisitedNodes()
+
+		Returns
+		-------
+		int
+			The number of nodes visited by the last update.
+		"""
+		return (<_DynCoreDecomposition*>(self._this)).numberOfVisitedNodes()
+
 cdef extern from "<networkit/centrality/EigenvectorCentrality.hpp>":
 
 	cdef cppclass _EigenvectorCentrality "NetworKit::EigenvectorCentrality" (_Centrality):
 		_EigenvectorCentrality(_Graph, double tol) except +
+		_SpMVPrecision precision
 
 cdef class EigenvectorCentrality(Centrality):
 	"""	
@@ -2297,6 +2578,23 @@ cdef class EigenvectorCentrality(Centrality):
 		self._G = G
 		self._this = new _EigenvectorCentrality(G._this, tol)
 
+	property precision:
+		"""
+		Property :code:`precision` sets the precision of the edge weights and scores in the
+		matrix-vector products. Can be one of the following:
+
+		- networkit.centrality.SpMVPrecision.DOUBLE
+		- networkit.centrality.SpMVPrecision.SINGLE
+
+		Default: networkit.centrality.SpMVPrecision.DOUBLE
+		"""
+		def __get__(self):
+			""" Get the used precision. """
+			return (<_EigenvectorCentrality*>(self._this)).precision
+		def __set__(self, _SpMVPrecision precision):
+			""" Use a different precision. """
+			(<_EigenvectorCentrality*>(self._this)).precision = precision
+
 cdef extern from "<networkit/centrality/PageRank.hpp>" namespace "NetworKit::PageRank":
 
 	cdef enum _Norm "NetworKit::PageRank::Norm":
@@ -2326,6 +2624,7 @@ cdef extern from "<networkit/centrality/PageRank.hpp>":
 		count numberOfIterations() except +
 		_Norm norm
 		count maxIterations
+		_SpMVPrecision precision
 
 cdef class PageRank(Centrality):
 	""" 
@@ -2411,6 +2710,23 @@ cdef class PageRank(Centrality):
 				raise Exception("Max iterations cannot be a negative number.")
 			(<_PageRank*>(self._this)).maxIterations = maxIterations
 
+	property precision:
+		"""
+		Property :code:`precision` sets the precision of the edge weights and scores in the
+		matrix-vector products. Can be one of the following:
+
+		- networkit.centrality.SpMVPrecision.DOUBLE
+		- networkit.centrality.SpMVPrecision.SINGLE
+
+		Default: networkit.centrality.SpMVPrecision.DOUBLE
+		"""
+		def __get__(self):
+			""" Get the used precision. """
+			return (<_PageRank*>(self._this)).precision
+		def __set__(self, _SpMVPrecision precision):
+			""" Use a different precision. """
+			(<_PageRank*>(self._this)).precision = precision
+
 
 cdef extern from "<networkit/centrality/SpanningEdgeCentrality.hpp>":
 
@@ -0,0 +1,61 @@
+/*
+ * BenchmarkGraphs.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_BENCHMARK_GRAPHS_HPP_
+#define NETWORKIT_BENCHMARK_GRAPHS_HPP_
+
+#include <map>
+#include <utility>
+#include <benchmark/benchmark.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/generators/HyperbolicGenerator.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/graph/GraphTools.hpp>
+
+// Input graphs and size ranges shared by the google-benchmark suites of all modules.
+namespace NetworKit {
+namespace BenchmarkGraphs {
+
+// The default range of node counts: 4096 to 262144 in steps of 8x.
+inline void graphSizes(benchmark::internal::Benchmark *benchmark) {
+    benchmark->RangeMultiplier(8)->Range(1 << 12, 1 << 18);
+}
+
+// Erdos-Renyi graph with n nodes and average degree 16, with uniform random weights in [1, 2)
+// if weighted; generated once per size with a fixed seed.
+inline const Graph &erdosRenyi(count n, bool weighted = false) {
+    static std::map<std::pair<count, bool>, Graph> cache;
+    auto it = cache.find({n, weighted});
+    if (it == cache.end()) {
+        Aux::Random::setSeed(42, false);
+        Graph G = ErdosRenyiGenerator(n, 16. / n).generate();
+        if (weighted) {
+            G = GraphTools::toWeighted(G);
+            G.forEdges([&G](node u, node v) { G.setWeight(u, v, 1. + Aux::Random::real()); });
+        }
+        it = cache.emplace(std::make_pair(n, weighted), std::move(G)).first;
+    }
+    return it->second;
+}
+
+// Random hyperbolic graph with n nodes, average degree 16 and power-law exponent 3, which has a
+// pronounced community structure; generated once per size with a fixed seed.
+inline const Graph &hyperbolic(count n) {
+    static std::map<count, Graph> cache;
+    auto it = cache.find(n);
+    if (it == cache.end()) {
+        Aux::Random::setSeed(42, false);
+        it = cache.emplace(n, HyperbolicGenerator(n, 16., 3.).generate()).first;
+    }
+    return it->second;
+}
+
+} // namespace BenchmarkGraphs
+} // namespace NetworKit
+
+#endif // NETWORKIT_BENCHMARK_GRAPHS_HPP_
@@ -0,0 +1,41 @@
+/*
+ * Benchmarks-X.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <iostream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <tlx/cmdline_parser.hpp>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Parallelism.hpp>
+
+int main(int argc, char *argv[]) {
+    // google-benchmark removes the --benchmark_* flags it recognizes
+    benchmark::Initialize(&argc, argv);
+
+    std::string loglevel = "ERROR";
+    unsigned numThreads = 0;
+    tlx::CmdlineParser parser;
+    parser.add_unsigned("threads", numThreads,
+                        "set the maximum number of threads; 0 (=default) uses OMP default");
+    parser.add_string("loglevel", loglevel,
+                      "set the log level (TRACE|DEBUG|INFO|WARN|ERROR|FATAL)");
+    if (!parser.process(argc, argv, std::cerr))
+        return -1;
+
+    Aux::Log::setLogLevel(loglevel);
+    if (numThreads)
+        Aux::setNumberOfThreads(numThreads);
+
+    // Results are only comparable for the same number of threads.
+    benchmark::AddCustomContext("networkit_threads", std::to_string(Aux::getMaxNumberOfThreads()));
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
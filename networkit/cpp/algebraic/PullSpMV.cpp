@@ -0,0 +1,167 @@
+/*
+ * PullSpMV.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <omp.h>
+
+#include <networkit/algebraic/PullSpMV.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+
+namespace NetworKit {
+
+template <typename T>
+template <class GraphType>
+PullSpMV<T>::PullSpMV(const GraphType &G, bool outNeighbors, count segmentSize)
+    : n(G.upperNodeIdBound()), segmentShift(0) {
+    if (segmentSize == 0 || (segmentSize & (segmentSize - 1)) != 0
+        || segmentSize > (count{1} << 32))
+        throw std::runtime_error("The segment size must be a power of two of at most 2^32.");
+    while ((count{1} << segmentShift) < segmentSize)
+        ++segmentShift;
+
+    const count numSegments = std::max<count>(1, (n + segmentSize - 1) >> segmentShift);
+    const bool useOutEdges = outNeighbors || !G.isDirected();
+    const bool weighted = G.isWeighted();
+
+    auto forEntries = [&](node u, auto handle) {
+        if (!G.hasNode(u))
+            return;
+        if (useOutEdges)
+            G.forEdgesOf(u, [&](node, node v, edgeweight w) { handle(v, w); });
+        else
+            G.forInEdgesOf(u, [&](node, node v, edgeweight w) { handle(v, w); });
+    };
+
+    // The rows are split into chunks; the entries are laid out by segment first and by chunk
+    // second, so each chunk can fill its part of every segment independently.
+    const count numChunks =
+        std::max<count>(1, std::min<count>(n, 4 * static_cast<count>(omp_get_max_threads())));
+    auto chunkBegin = [&](index c) -> node { return static_cast<node>(c * n / numChunks); };
+
+    std::vector<index> rowPos(numChunks * numSegments, 0), edgePos(numChunks * numSegments, 0);
+
+#pragma omp parallel
+    {
+        std::vector<node> lastRow(numSegments, none);
+#pragma omp for schedule(dynamic, 1)
+        for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+            index *rowCount = &rowPos[c * numSegments];
+            index *edgeCount = &edgePos[c * numSegments];
+            for (node u = chunkBegin(c); u < chunkBegin(c + 1); ++u) {
+                forEntries(u, [&](node v, edgeweight) {
+                    const index s = v >> segmentShift;
+                    ++edgeCount[s];
+                    if (lastRow[s] != u) {
+                        lastRow[s] = u;
+                        ++rowCount[s];
+                    }
+                });
+            }
+        }
+    }
+
+    segmentBegin.resize(numSegments + 1);
+    index numRows = 0, numEdges = 0;
+    for (index s = 0; s < numSegments; ++s) {
+        segmentBegin[s] = numRows;
+        for (index c = 0; c < numChunks; ++c) {
+            const index rows = rowPos[c * numSegments + s];
+            const index edges = edgePos[c * numSegments + s];
+            rowPos[c * numSegments + s] = numRows;
+            edgePos[c * numSegments + s] = numEdges;
+            numRows += rows;
+            numEdges += edges;
+        }
+    }
+    segmentBegin[numSegments] = numRows;
+
+    rowIds.resize(numRows);
+    rowBegin.resize(numRows + 1);
+    rowBegin[numRows] = numEdges;
+    columns.resize(numEdges);
+    if (weighted)
+        weights.resize(numEdges);
+
+#pragma omp parallel
+    {
+        std::vector<std::pair<node, T>> entries;
+#pragma omp for schedule(dynamic, 1)
+        for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+            index *nextRow = &rowPos[c * numSegments];
+            index *nextEdge = &edgePos[c * numSegments];
+            for (node u = chunkBegin(c); u < chunkBegin(c + 1); ++u) {
+                entries.clear();
+                forEntries(u, [&](node v, edgeweight w) {
+                    entries.emplace_back(v, static_cast<T>(w));
+                });
+                std::sort(entries.begin(), entries.end());
+
+                index lastSegment = none;
+                for (const auto &[v, w] : entries) {
+                    const index s = v >> segmentShift;
+                    if (s != lastSegment) {
+                        lastSegment = s;
+                        const index k = nextRow[s]++;
+                        rowIds[k] = u;
+                        rowBegin[k] = nextEdge[s];
+                    }
+                    const index i = nextEdge[s]++;
+                    columns[i] = static_cast<uint32_t>(v - (s << segmentShift));
+                    if (weighted)
+                        weights[i] = w;
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void PullSpMV<T>::multiply(const std::vector<T> &x, std::vector<double> &y) const {
+    assert(x.size() == n);
+    y.resize(n);
+    const count numSegments = segmentBegin.size() - 1;
+
+#pragma omp parallel
+    {
+#pragma omp for
+        for (omp_index u = 0; u < static_cast<omp_index>(n); ++u)
+            y[u] = 0;
+
+        // Rows are unique within a segment, but not across segments: the implicit barrier at
+        // the end of each loop orders the updates of the segments.
+        for (index s = 0; s < numSegments; ++s) {
+            const T *xs = x.data() + (s << segmentShift);
+#pragma omp for schedule(guided)
+            for (omp_index k = static_cast<omp_index>(segmentBegin[s]);
+                 k < static_cast<omp_index>(segmentBegin[s + 1]); ++k) {
+                const index begin = rowBegin[k], end = rowBegin[k + 1];
+                double sum = 0;
+                if (weights.empty()) {
+#pragma omp simd reduction(+ : sum)
+                    for (index i = begin; i < end; ++i)
+                        sum += static_cast<double>(xs[columns[i]]);
+                } else {
+#pragma omp simd reduction(+ : sum)
+                    for (index i = begin; i < end; ++i)
+                        sum += static_cast<double>(weights[i])
+                               * static_cast<double>(xs[columns[i]]);
+                }
+                y[rowIds[k]] += sum;
+            }
+        }
+    }
+}
+
+template class PullSpMV<float>;
+template class PullSpMV<double>;
+template PullSpMV<float>::PullSpMV(const Graph &, bool, count);
+template PullSpMV<double>::PullSpMV(const Graph &, bool, count);
+template PullSpMV<float>::PullSpMV(const CSRGraph &, bool, count);
+template PullSpMV<double>::PullSpMV(const CSRGraph &, bool, count);
+
+} /* namespace NetworKit */
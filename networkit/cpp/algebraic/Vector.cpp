@@ -70,6 +70,33 @@ double Vector::innerProduct(const Vector &v1, const Vector &v2) {
     return inner_prod;
 }
 
+std::pair<double, double> Vector::innerProductAndSquaredLength(const Vector &v1,
+                                                                const Vector &v2) {
+    assert(v1.getDimension() == v2.getDimension());
+    double inner_prod = 0., sqr_length = 0.;
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(+ : inner_prod, sqr_length)
+#endif
+    for (omp_index i = 0; i < static_cast<omp_index>(v1.getDimension()); ++i) {
+        inner_prod += v1[i] * v2[i];
+        sqr_length += v1[i] * v1[i];
+    }
+    return {inner_prod, sqr_length};
+}
+
+double Vector::distance(const Vector &v1, const Vector &v2) {
+    assert(v1.getDimension() == v2.getDimension());
+    double sqr_dist = 0.;
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(+ : sqr_dist)
+#endif
+    for (omp_index i = 0; i < static_cast<omp_index>(v1.getDimension()); ++i) {
+        const double diff = v1[i] - v2[i];
+        sqr_dist += diff * diff;
+    }
+    return std::sqrt(sqr_dist);
+}
+
 double Vector::operator*(const Vector &other) const {
     assert(isTransposed()
            && !other.isTransposed()); // vectors must be transposed correctly for inner product
@@ -157,4 +184,26 @@ Vector &Vector::operator-=(const double value) {
     return *this;
 }
 
+Vector &Vector::axpy(const double alpha, const Vector &x) {
+    assert(getDimension() == x.getDimension()); // dimensions of vectors must match
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); ++i) {
+        values[i] += alpha * x[i];
+    }
+
+    return *this;
+}
+
+Vector &Vector::axpby(const double alpha, const Vector &x, const double beta) {
+    assert(getDimension() == x.getDimension()); // dimensions of vectors must match
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); ++i) {
+        values[i] = alpha * x[i] + beta * values[i];
+    }
+
+    return *this;
+}
+
 } /* namespace NetworKit */
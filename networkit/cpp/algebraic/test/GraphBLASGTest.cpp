@@ -6,10 +6,13 @@
  */
 
 #include <iostream>
+#include <random>
 #include <gtest/gtest.h>
 
 #include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/algebraic/DynamicMatrix.hpp>
 #include <networkit/algebraic/GraphBLAS.hpp>
+#include <networkit/algebraic/SparseVector.hpp>
 
 namespace NetworKit {
 
@@ -228,6 +231,146 @@ TEST_F(GraphBLASGTest, testMxV) {
     EXPECT_EQ(2, res[3]);
 }
 
+namespace {
+
+// Random rows x cols matrix in which every 17th row is dense, so both accumulators are used.
+std::vector<Triplet> randomTriplets(count rows, count cols, std::mt19937_64 &urng) {
+    std::vector<Triplet> triplets;
+    std::uniform_real_distribution<double> value(-2.0, 2.0);
+    for (index i = 0; i < rows; ++i) {
+        std::bernoulli_distribution isNonZero(i % 17 == 0 ? 0.6 : 0.02);
+        for (index j = 0; j < cols; ++j)
+            if (isNonZero(urng))
+                triplets.push_back({i, j, value(urng)});
+    }
+    return triplets;
+}
+
+template <class Matrix>
+std::vector<std::vector<double>> toDense(const Matrix &A) {
+    std::vector<std::vector<double>> dense(A.numberOfRows(),
+                                           std::vector<double>(A.numberOfColumns(), 0.0));
+    A.forNonZeroElementsInRowOrder([&](index i, index j, double value) { dense[i][j] = value; });
+    return dense;
+}
+
+} // namespace
+
+TEST_F(GraphBLASGTest, testMxMAccumulators) {
+    std::mt19937_64 urng(42);
+    const auto tripletsA = randomTriplets(300, 200, urng);
+    const auto tripletsB = randomTriplets(200, 400, urng);
+    const CSRMatrix A(300, 200, tripletsA), B(200, 400, tripletsB);
+    const auto denseA = toDense(A), denseB = toDense(B);
+
+    const CSRMatrix C = GraphBLAS::MxM(A, B);
+    ASSERT_EQ(C.numberOfRows(), 300);
+    ASSERT_EQ(C.numberOfColumns(), 400);
+    EXPECT_TRUE(C.sorted());
+
+    // matrices without a CSR constructor are built from triplets
+    const DynamicMatrix D =
+        GraphBLAS::MxM(DynamicMatrix(300, 200, tripletsA), DynamicMatrix(200, 400, tripletsB));
+    EXPECT_EQ(D.nnz(), C.nnz());
+
+    const auto denseC = toDense(C), denseD = toDense(D);
+    for (index i = 0; i < 300; ++i) {
+        for (index j = 0; j < 400; ++j) {
+            double expected = 0;
+            for (index k = 0; k < 200; ++k)
+                expected += denseA[i][k] * denseB[k][j];
+            EXPECT_NEAR(expected, denseC[i][j], 1e-9);
+            EXPECT_NEAR(expected, denseD[i][j], 1e-9);
+        }
+    }
+}
+
+TEST_F(GraphBLASGTest, testMaskedMxM) {
+    std::mt19937_64 urng(42);
+    const CSRMatrix A(120, 100, randomTriplets(120, 100, urng));
+    const CSRMatrix B(100, 150, randomTriplets(100, 150, urng));
+    const CSRMatrix M(120, 150, randomTriplets(120, 150, urng));
+
+    const CSRMatrix full = GraphBLAS::MxM(A, B);
+    const CSRMatrix masked = GraphBLAS::maskedMxM(A, B, M);
+    const auto denseFull = toDense(full), denseMasked = toDense(masked), denseM = toDense(M);
+
+    count expectedNnz = 0;
+    full.forNonZeroElementsInRowOrder([&](index i, index j, double) {
+        if (denseM[i][j] != 0)
+            ++expectedNnz;
+    });
+    EXPECT_EQ(masked.nnz(), expectedNnz);
+
+    for (index i = 0; i < 120; ++i)
+        for (index j = 0; j < 150; ++j)
+            EXPECT_EQ(denseMasked[i][j], denseM[i][j] != 0 ? denseFull[i][j] : 0.0);
+}
+
+TEST_F(GraphBLASGTest, testMxSpV) {
+    std::mt19937_64 urng(42);
+    const CSRMatrix A(500, 400, randomTriplets(500, 400, urng), MinPlusSemiring::zero());
+    const CSRMatrix At = A.transpose();
+
+    SparseVector x(400, MinPlusSemiring::zero());
+    Vector dense(400, MinPlusSemiring::zero());
+    for (index j = 3; j < 400; j += 37) {
+        x.insert(j, static_cast<double>(j));
+        dense[j] = static_cast<double>(j);
+    }
+    const Vector expected = GraphBLAS::MxV<MinPlusSemiring>(A, dense);
+
+    std::vector<bool> masked(500, false);
+    for (index i = 0; i < 500; i += 3)
+        masked[i] = true;
+
+    for (const auto direction : {GraphBLAS::SpMSpVDirection::AUTO,
+                                 GraphBLAS::SpMSpVDirection::PUSH,
+                                 GraphBLAS::SpMSpVDirection::PULL}) {
+        const SparseVector y = GraphBLAS::MxSpV<MinPlusSemiring>(A, At, x, {}, direction);
+        EXPECT_TRUE(y.sorted());
+        EXPECT_EQ(y.toVector(), expected);
+
+        const GraphBLAS::VectorMask unmasked{&masked, true};
+        const SparseVector z = GraphBLAS::MxSpV<MinPlusSemiring>(A, At, x, unmasked, direction);
+        z.forNonZeroElements([&](index i, double value) {
+            EXPECT_FALSE(masked[i]);
+            EXPECT_EQ(value, expected[i]);
+        });
+        count expectedNnz = 0;
+        for (index i = 0; i < 500; ++i)
+            expectedNnz += !masked[i] && expected[i] != MinPlusSemiring::zero();
+        EXPECT_EQ(z.nnz(), expectedNnz);
+    }
+}
+
+TEST_F(GraphBLASGTest, testMxSpVWorkspace) {
+    std::mt19937_64 urng(42);
+    const CSRMatrix A(1000, 1000, randomTriplets(1000, 1000, urng));
+    const CSRMatrix At = A.transpose();
+    GraphBLAS::SpMSpVWorkspace workspace(1000, 1000);
+
+    // the pushes are large enough to be split over the threads
+    for (index offset = 0; offset < 2; ++offset) {
+        SparseVector x(1000);
+        Vector dense(1000, 0.0);
+        for (index j = offset; j < 1000; j += 2) {
+            x.insert(j, 1.0 + static_cast<double>(j % 7));
+            dense[j] = 1.0 + static_cast<double>(j % 7);
+        }
+        const Vector expected = GraphBLAS::MxV(A, dense);
+
+        for (const auto direction :
+             {GraphBLAS::SpMSpVDirection::PUSH, GraphBLAS::SpMSpVDirection::PULL}) {
+            const SparseVector y = GraphBLAS::MxSpV(A, At, x, workspace, {}, direction);
+            EXPECT_TRUE(y.sorted());
+            const Vector result = y.toVector();
+            for (index i = 0; i < 1000; ++i)
+                EXPECT_NEAR(result[i], expected[i], 1e-9);
+        }
+    }
+}
+
 TEST_F(GraphBLASGTest, testEWiseAdd) {
     std::vector<Triplet> triplets1;
     std::vector<Triplet> triplets2;
@@ -0,0 +1,82 @@
+/*
+ * PullSpMVGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <networkit/algebraic/PullSpMV.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+class PullSpMVGTest : public testing::TestWithParam<std::pair<bool, bool>> {
+protected:
+    bool isWeighted() const noexcept { return GetParam().first; }
+    bool isDirected() const noexcept { return GetParam().second; }
+
+    Graph randomGraph(count n, count m) const {
+        Aux::Random::setSeed(42, false);
+        Graph G(n, isWeighted(), isDirected());
+        for (count i = 0; i < m; ++i)
+            G.addEdge(Aux::Random::index(n), Aux::Random::index(n), Aux::Random::real(0.5, 2));
+        // deleted nodes must not contribute
+        G.removeNode(3);
+        G.removeNode(n / 2);
+        return G;
+    }
+
+    template <typename T>
+    void checkProduct(const Graph &G, bool outNeighbors, count segmentSize, double tol) const {
+        const PullSpMV<T> A(G, outNeighbors, segmentSize);
+        EXPECT_EQ(A.numberOfRows(), G.upperNodeIdBound());
+        EXPECT_EQ(A.numberOfSegments(),
+                  (G.upperNodeIdBound() + segmentSize - 1) / segmentSize);
+
+        std::vector<T> x(G.upperNodeIdBound());
+        for (auto &xi : x)
+            xi = static_cast<T>(Aux::Random::real(-1, 1));
+
+        std::vector<double> y;
+        A.multiply(x, y);
+        ASSERT_EQ(y.size(), G.upperNodeIdBound());
+
+        for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+            double expected = 0;
+            if (G.hasNode(u)) {
+                auto add = [&](node, node v, edgeweight w) {
+                    expected += static_cast<double>(static_cast<T>(w)) * x[v];
+                };
+                if (outNeighbors)
+                    G.forEdgesOf(u, add);
+                else
+                    G.forInEdgesOf(u, add);
+            }
+            EXPECT_NEAR(y[u], expected, tol);
+        }
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, PullSpMVGTest,
+                         testing::Values(std::make_pair(false, false), std::make_pair(true, false),
+                                         std::make_pair(false, true), std::make_pair(true, true)));
+
+TEST_P(PullSpMVGTest, testMultiply) {
+    const Graph G = randomGraph(1000, 20000);
+    for (const bool outNeighbors : {false, true}) {
+        for (const count segmentSize : {count{1}, count{64}, count{512}, count{1} << 20}) {
+            checkProduct<double>(G, outNeighbors, segmentSize, 1e-9);
+            checkProduct<float>(G, outNeighbors, segmentSize, 1e-9);
+        }
+    }
+}
+
+TEST_P(PullSpMVGTest, testInvalidSegmentSize) {
+    const Graph G = randomGraph(100, 100);
+    EXPECT_THROW(PullSpMV<double>(G, false, 0), std::runtime_error);
+    EXPECT_THROW(PullSpMV<double>(G, false, 100), std::runtime_error);
+}
+
+} // namespace NetworKit
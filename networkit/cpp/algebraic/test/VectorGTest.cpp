@@ -8,6 +8,7 @@
 
 #include <cmath>
 #include <networkit/algebraic/AlgebraicGlobals.hpp>
+#include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/algebraic/DynamicMatrix.hpp>
 #include <networkit/algebraic/Vector.hpp>
 #include <networkit/auxiliary/Log.hpp>
@@ -264,4 +265,51 @@ TEST(VectorGTest, testMean) {
     EXPECT_EQ(mean, 3);
 }
 
+TEST(VectorGTest, testFusedKernels) {
+    Vector x = {1.0, -2.0, 3.0, 0.5};
+    Vector y = {2.0, 1.0, -1.0, 4.0};
+
+    const auto [xy, xx] = Vector::innerProductAndSquaredLength(x, y);
+    EXPECT_DOUBLE_EQ(xy, Vector::innerProduct(x, y));
+    EXPECT_DOUBLE_EQ(xx, Vector::innerProduct(x, x));
+    EXPECT_DOUBLE_EQ(Vector::distance(x, y), (x - y).length());
+
+    const Vector expectedAxpy = y + 0.5 * x;
+    const Vector expectedAxpby = 2.0 * x - 3.0 * expectedAxpy;
+    const double *data = &y[0];
+    y.axpy(0.5, x);
+    EXPECT_EQ(y, expectedAxpy);
+    y.axpby(2.0, x, -3.0);
+    EXPECT_EQ(y, expectedAxpby);
+    // the kernels work in place
+    EXPECT_EQ(&y[0], data);
+
+    y.swap(x);
+    EXPECT_EQ(x, expectedAxpby);
+    EXPECT_EQ(y[1], -2.0);
+}
+
+TEST(VectorGTest, testMatrixVectorProduct) {
+    const std::vector<Triplet> triplets = {
+        {0, 0, 2.0}, {0, 2, -1.0}, {1, 1, 3.0}, {2, 0, 1.0}, {2, 1, 4.0}};
+    const CSRMatrix A(3, triplets);
+    const Vector x = {1.0, 2.0, -1.0};
+    const Vector Ax = A * x;
+
+    Vector result;
+    Vector::matrixVectorProduct(A, x, result);
+    EXPECT_EQ(result, Ax);
+
+    const double *data = &result[0];
+    Vector::matrixVectorProduct(A, x, result, -1.0, 2.0);
+    EXPECT_EQ(&result[0], data);
+    for (index i = 0; i < 3; ++i)
+        EXPECT_DOUBLE_EQ(result[i], Ax[i]);
+
+    const DynamicMatrix D(3, triplets);
+    Vector::matrixVectorProduct(D, x, result, 2.0);
+    for (index i = 0; i < 3; ++i)
+        EXPECT_DOUBLE_EQ(result[i], 2.0 * Ax[i]);
+}
+
 } /* namespace NetworKit */
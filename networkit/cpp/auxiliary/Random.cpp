@@ -54,6 +54,14 @@ std::mt19937_64 &getURNG() {
     return generator;
 }
 
+std::mt19937_64 streamURNG(uint64_t seed, uint64_t stream) {
+    // SplitMix64 finalizer, decorrelates consecutive stream ids
+    uint64_t z = seed + (stream + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return std::mt19937_64{z ^ (z >> 31)};
+}
+
 uint64_t integer() {
     thread_local static std::uniform_int_distribution<uint64_t> dist{};
     return dist(getURNG());
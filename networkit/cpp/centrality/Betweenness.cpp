@@ -5,7 +5,10 @@
  *      Author: cls, ebergamini
  */
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
 #include <omp.h>
 
 #include <networkit/auxiliary/Log.hpp>
@@ -13,12 +16,36 @@
 #include <networkit/centrality/Betweenness.hpp>
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Dijkstra.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 
 namespace NetworKit {
 
 Betweenness::Betweenness(const Graph &G, bool normalized, bool computeEdgeCentrality)
     : Centrality(G, normalized, computeEdgeCentrality) {}
 
+void Betweenness::setBatchSize(count batchSize) {
+    if (batchSize > maxBatchSize && batchSize != none)
+        throw std::runtime_error("The batch size must not exceed maxBatchSize.");
+    this->batchSize = batchSize;
+}
+
+count Betweenness::getBatchSize() const noexcept {
+    if (batchSize != none)
+        return batchSize;
+    return batchSizeFor(G.upperNodeIdBound(), memoryBudget);
+}
+
+count Betweenness::batchSizeFor(count upperNodeIdBound, count memoryBudget) noexcept {
+    // The masks of a node take 24 bytes, its path counts and dependencies 16 bytes per source.
+    // A node is listed in one level per distance at which sources reach it, with 16 bytes per
+    // entry of levelNodes and levelMasks, so at most 16 bytes per source. There are at most as
+    // many levels as nodes, so levelScale adds at most another 8 bytes per node and source.
+    const count bytesPerNode = memoryBudget / std::max<count>(upperNodeIdBound, 1);
+    if (bytesPerNode < 24 + 40)
+        return 1;
+    return std::min(maxBatchSize, (bytesPerNode - 24) / 40);
+}
+
 void Betweenness::run() {
     Aux::SignalHandler handler;
     const count z = G.upperNodeIdBound();
@@ -30,10 +57,46 @@ void Betweenness::run() {
         edgeScoreData.resize(z2);
     }
 
-    std::vector<std::vector<double>> dependencies(omp_get_max_threads(), std::vector<double>(z));
+    handler.assureRunning();
+    if (G.isWeighted() || getBatchSize() == 0)
+        runPerThread();
+    else
+        computeBatched(G, getBatchSize(), scoreData,
+                       computeEdgeCentrality ? &edgeScoreData : nullptr);
+    handler.assureRunning();
+
+    if (normalized) {
+        // divide by the number of possible pairs
+        const double n = static_cast<double>(G.numberOfNodes());
+        const double pairs = (n - 2.) * (n - 1.);
+        const double edges = n * (n - 1.);
+        G.parallelForNodes([&](node u) { scoreData[u] /= pairs; });
+
+        if (computeEdgeCentrality) {
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(edgeScoreData.size()); ++i) {
+                edgeScoreData[i] = edgeScoreData[i] / edges;
+            }
+        }
+    }
+
+    hasRun = true;
+}
+
+void Betweenness::runPerThread() {
+    Aux::SignalHandler handler;
+    const count z = G.upperNodeIdBound();
+    // A BFS or Dijkstra keeps about 64 bytes per node and one entry per predecessor, the
+    // dependencies of a thread another 8 bytes per node. Threads beyond the budget stay idle.
+    const count bytesPerThread =
+        72 * z + sizeof(node) * (G.isDirected() ? 1 : 2) * G.numberOfEdges();
+    const int numThreads = static_cast<int>(std::clamp<count>(
+        memoryBudget / std::max<count>(bytesPerThread, 1), 1, omp_get_max_threads()));
+
+    std::vector<std::vector<double>> dependencies(numThreads, std::vector<double>(z));
     std::vector<std::unique_ptr<SSSP>> sssps;
-    sssps.resize(omp_get_max_threads());
-#pragma omp parallel
+    sssps.resize(numThreads);
+#pragma omp parallel num_threads(numThreads)
     {
         omp_index i = omp_get_thread_num();
         if (G.isWeighted())
@@ -79,28 +142,246 @@ void Betweenness::run() {
                 scoreData[t] += dependency[t];
         }
     };
-    handler.assureRunning();
-    G.balancedParallelForNodes(computeDependencies);
-    handler.assureRunning();
+#pragma omp parallel for schedule(guided) num_threads(numThreads)
+    for (omp_index s = 0; s < static_cast<omp_index>(z); ++s) {
+        if (G.hasNode(s))
+            computeDependencies(s);
+    }
+}
 
-    if (normalized) {
-        // divide by the number of possible pairs
-        const double n = static_cast<double>(G.numberOfNodes());
-        const double pairs = (n - 2.) * (n - 1.);
-        const double edges = n * (n - 1.);
-        G.parallelForNodes([&](node u) { scoreData[u] /= pairs; });
+/*
+ * Processes the sources in batches of up to 64. Bit c of a mask refers to the c-th source of the
+ * batch; the shortest path DAGs of all sources of a batch are computed by one level-synchronous
+ * BFS (see [0]), in which a node is visited once per level for all sources that reach it at this
+ * distance. Path counts and dependencies are stored per node and source, all threads work on the
+ * same batch.
+ *
+ * [0] The More the Merrier: Efficient Multi-Source Graph Traversal
+ * Manuel Then et al. * Proceedings of the VLDB Endowment 8.4 (2014), 449-460
+ */
+template <class GraphType>
+void Betweenness::computeBatched(const GraphType &G, count k, std::vector<double> &scores,
+                                 std::vector<double> *edgeScores) {
+    Aux::SignalHandler handler;
+    const count z = G.upperNodeIdBound();
+    // path counts are scaled down per level and source before they can overflow
+    constexpr double maxPaths = 1e200;
+    // levels with fewer nodes are processed sequentially, the threads would mostly synchronize
+    constexpr count minParallelLevel = 512;
 
-        if (computeEdgeCentrality) {
-#pragma omp parallel for
-            for (omp_index i = 0; i < static_cast<omp_index>(edgeScoreData.size()); ++i) {
-                edgeScoreData[i] = edgeScoreData[i] / edges;
+    // sources that reached a node so far, sources for which it is in the current frontier and
+    // sources for which it has been reached in the next level (or is in the next level during
+    // the accumulation of dependencies)
+    std::vector<uint64_t> seen(z, 0), frontier(z, 0), next(z, 0);
+    // number of shortest paths and dependency of node v for source c at v * k + c
+    std::vector<double> sigma(z * k, 0.), delta(z * k, 0.);
+    // the nodes of level d and their masks are at [levelBegin[d], levelBegin[d + 1])
+    std::vector<node> levelNodes;
+    std::vector<uint64_t> levelMasks;
+    std::vector<index> levelBegin;
+    // factor by which the path counts of source c have been scaled in level d, at d * k + c
+    std::vector<double> levelScale;
+    std::vector<std::vector<node>> reached(omp_get_max_threads());
+    std::vector<node> sources;
+
+    auto forBits = [](uint64_t mask, auto handle) {
+        for (; mask; mask &= mask - 1)
+            handle(static_cast<index>(__builtin_ctzll(mask)));
+    };
+
+    // builds the levels of the shortest path DAGs of the current batch
+    auto traverse = [&]() {
+        levelNodes.assign(sources.begin(), sources.end());
+        levelMasks.clear();
+        for (index c = 0; c < sources.size(); ++c) {
+            const uint64_t bit = uint64_t{1} << c;
+            levelMasks.push_back(bit);
+            seen[sources[c]] = frontier[sources[c]] = bit;
+            sigma[sources[c] * k + c] = 1.;
+        }
+        levelBegin.assign({0, levelNodes.size()});
+        levelScale.assign(k, 1.);
+
+        while (true) {
+            const index begin = levelBegin[levelBegin.size() - 2], end = levelBegin.back();
+            bool parallelLevel = end - begin >= minParallelLevel;
+
+            // find the nodes of the next level; the first thread that reaches a node lists it
+            for (auto &local : reached)
+                local.clear();
+#pragma omp parallel if (parallelLevel)
+            {
+                auto &local = reached[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+                for (omp_index i = begin; i < static_cast<omp_index>(end); ++i) {
+                    const uint64_t mask = levelMasks[i];
+                    G.forNeighborsOf(levelNodes[i], [&](node w) {
+                        const uint64_t newBits = mask & ~seen[w];
+                        if (!newBits)
+                            return;
+                        uint64_t old;
+#pragma omp atomic capture
+                        {
+                            old = next[w];
+                            next[w] |= newBits;
+                        }
+                        if (!old)
+                            local.push_back(w);
+                    });
+                }
+            }
+            for (const auto &local : reached)
+                levelNodes.insert(levelNodes.end(), local.begin(), local.end());
+            const index nextEnd = levelNodes.size();
+            if (nextEnd == end) {
+#pragma omp parallel for if (parallelLevel)
+                for (omp_index i = begin; i < static_cast<omp_index>(end); ++i)
+                    frontier[levelNodes[i]] = 0;
+                break;
+            }
+            levelMasks.resize(nextEnd);
+            parallelLevel = nextEnd - begin >= minParallelLevel;
+
+            // the path counts of a node are the sums over its predecessors in the frontier
+            double maxSigma = 0.;
+#pragma omp parallel for if (parallelLevel) schedule(guided) reduction(max : maxSigma)
+            for (omp_index i = end; i < static_cast<omp_index>(nextEnd); ++i) {
+                const node w = levelNodes[i];
+                const uint64_t mask = next[w];
+                levelMasks[i] = mask;
+                double *sigmaW = sigma.data() + w * k;
+                G.forInNeighborsOf(w, [&](node v) {
+                    const double *sigmaV = sigma.data() + v * k;
+                    forBits(frontier[v] & mask, [&](index c) { sigmaW[c] += sigmaV[c]; });
+                });
+                forBits(mask, [&](index c) { maxSigma = std::max(maxSigma, sigmaW[c]); });
+            }
+
+            levelScale.resize(levelScale.size() + k, 1.);
+            if (maxSigma > maxPaths) {
+                double *scale = levelScale.data() + levelScale.size() - k;
+                std::vector<double> maxOfSource(k, 0.);
+                for (index i = end; i < nextEnd; ++i) {
+                    const double *sigmaW = sigma.data() + levelNodes[i] * k;
+                    forBits(levelMasks[i], [&](index c) {
+                        maxOfSource[c] = std::max(maxOfSource[c], sigmaW[c]);
+                    });
+                }
+                for (index c = 0; c < k; ++c)
+                    if (maxOfSource[c] > maxPaths)
+                        scale[c] = maxOfSource[c];
+                for (index i = end; i < nextEnd; ++i) {
+                    double *sigmaW = sigma.data() + levelNodes[i] * k;
+                    forBits(levelMasks[i], [&](index c) { sigmaW[c] /= scale[c]; });
+                }
+            }
+
+#pragma omp parallel for if (parallelLevel)
+            for (omp_index i = begin; i < static_cast<omp_index>(end); ++i)
+                frontier[levelNodes[i]] = 0;
+#pragma omp parallel for if (parallelLevel)
+            for (omp_index i = end; i < static_cast<omp_index>(nextEnd); ++i) {
+                const node w = levelNodes[i];
+                seen[w] |= levelMasks[i];
+                frontier[w] = levelMasks[i];
+                next[w] = 0;
             }
+            levelBegin.push_back(nextEnd);
         }
-    }
+    };
 
-    hasRun = true;
+    // accumulates the dependencies level by level, starting with the second to last level
+    auto accumulate = [&]() {
+        const count numLevels = levelBegin.size() - 1;
+        for (index d = numLevels - 1; d-- > 0;) {
+            const index begin = levelBegin[d], end = levelBegin[d + 1];
+            const index nextEnd = levelBegin[d + 2];
+            const bool parallelLevel = nextEnd - begin >= minParallelLevel;
+#pragma omp parallel for if (parallelLevel)
+            for (omp_index i = end; i < static_cast<omp_index>(nextEnd); ++i)
+                next[levelNodes[i]] = levelMasks[i];
+
+            const double *scale = levelScale.data() + (d + 1) * k;
+            // each node appears at most once per level, so its entries are written by one thread
+#pragma omp parallel for if (parallelLevel) schedule(guided)
+            for (omp_index i = begin; i < static_cast<omp_index>(end); ++i) {
+                const node v = levelNodes[i];
+                const uint64_t mask = levelMasks[i];
+                const double *sigmaV = sigma.data() + v * k;
+                double *deltaV = delta.data() + v * k;
+
+                auto visit = [&](node w, edgeid eid) {
+                    const uint64_t bits = mask & next[w];
+                    if (!bits)
+                        return;
+                    const double *sigmaW = sigma.data() + w * k;
+                    const double *deltaW = delta.data() + w * k;
+                    double edgeDependency = 0.;
+                    forBits(bits, [&](index c) {
+                        const double contribution =
+                            sigmaV[c] / (sigmaW[c] * scale[c]) * (1. + deltaW[c]);
+                        deltaV[c] += contribution;
+                        edgeDependency += contribution;
+                    });
+                    if (edgeScores) {
+#pragma omp atomic
+                        (*edgeScores)[eid] += edgeDependency;
+                    }
+                };
+                if (edgeScores)
+                    G.forEdgesOf(v, [&](node, node w, edgeid eid) { visit(w, eid); });
+                else
+                    G.forNeighborsOf(v, [&](node w) { visit(w, none); });
+
+                double dependency = 0.;
+                forBits(mask, [&](index c) {
+                    if (sources[c] != v)
+                        dependency += deltaV[c];
+                });
+                scores[v] += dependency;
+            }
+
+#pragma omp parallel for if (parallelLevel)
+            for (omp_index i = end; i < static_cast<omp_index>(nextEnd); ++i)
+                next[levelNodes[i]] = 0;
+        }
+    };
+
+    // resets the entries the batch has touched; every pair of node and source is listed once
+    auto reset = [&]() {
+#pragma omp parallel for if (levelNodes.size() >= minParallelLevel)
+        for (omp_index i = 0; i < static_cast<omp_index>(levelNodes.size()); ++i) {
+            const node v = levelNodes[i];
+            forBits(levelMasks[i], [&](index c) {
+                sigma[v * k + c] = 0.;
+                delta[v * k + c] = 0.;
+            });
+        }
+        std::fill(seen.begin(), seen.end(), 0);
+    };
+
+    auto processBatch = [&]() {
+        handler.assureRunning();
+        traverse();
+        accumulate();
+        reset();
+        sources.clear();
+    };
+
+    G.forNodes([&](node s) {
+        sources.push_back(s);
+        if (sources.size() == k)
+            processBatch();
+    });
+    if (!sources.empty())
+        processBatch();
 }
 
+template void Betweenness::computeBatched(const Graph &, count, std::vector<double> &,
+                                          std::vector<double> *);
+template void Betweenness::computeBatched(const CSRGraph &, count, std::vector<double> &,
+                                          std::vector<double> *);
+
 double Betweenness::maximum() {
     if (normalized) {
         return 1;
@@ -0,0 +1,538 @@
+/*
+ * DynCoreDecomposition.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+#include <networkit/centrality/DynCoreDecomposition.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+constexpr uint64_t sentinelFlag = uint64_t{1} << 63;
+// all labels are below this bound, so none marks nodes that are not in the k-order
+constexpr uint64_t labelBound = uint64_t{1} << 62;
+// distance between consecutive labels when appending to the k-order
+constexpr uint64_t tailStep = uint64_t{1} << 32;
+
+// States of the nodes during an update.
+enum : uint8_t { UNSEEN = 0, QUEUED, CANDIDATE, REVOKED, DETERMINED };
+
+} // namespace
+
+DynCoreDecomposition::DynCoreDecomposition(const Graph &G) : Centrality(G) {}
+
+template <typename Handle>
+void DynCoreDecomposition::forIncidentNodes(node u, Handle handle) const {
+    const bool directed = G.isDirected();
+    auto isPending = [&](node from, node to) {
+        if (!directed && from > to)
+            std::swap(from, to);
+        return pending.find({from, to}) != pending.end();
+    };
+
+    G.forNeighborsOf(u, [&](node v) {
+        if (v != u && (pending.empty() || !isPending(u, v)))
+            handle(v);
+    });
+    if (directed) {
+        G.forInNeighborsOf(u, [&](node v) {
+            if (v != u && (pending.empty() || !isPending(v, u)))
+                handle(v);
+        });
+    }
+
+    for (const auto *removed : {&removedOut, &removedIn}) {
+        if (removed->empty())
+            continue;
+        const auto it = removed->find(u);
+        if (it != removed->end())
+            for (const node v : it->second)
+                handle(v);
+    }
+}
+
+void DynCoreDecomposition::run() {
+    pending.clear();
+    removedOut.clear();
+    removedIn.clear();
+
+    const count z = G.upperNodeIdBound();
+    core.assign(z, 0);
+
+    // bucket-based peeling (Batagelj and Zaversnik) yields the core numbers and a k-order
+    count maxDegree = 0;
+    G.forNodes([&](node u) {
+        forIncidentNodes(u, [&](node) { ++core[u]; });
+        maxDegree = std::max(maxDegree, core[u]);
+    });
+
+    std::vector<index> bucketBegin(maxDegree + 1, 0), position(z);
+    G.forNodes([&](node u) { ++bucketBegin[core[u]]; });
+    index start = 0;
+    for (count d = 0; d <= maxDegree; ++d)
+        start += std::exchange(bucketBegin[d], start);
+    std::vector<node> order(G.numberOfNodes());
+    G.forNodes([&](node u) {
+        position[u] = bucketBegin[core[u]]++;
+        order[position[u]] = u;
+    });
+    for (count d = maxDegree; d > 0; --d)
+        bucketBegin[d] = bucketBegin[d - 1];
+    bucketBegin[0] = 0;
+
+    for (const node u : order) {
+        forIncidentNodes(u, [&](node v) {
+            if (core[v] <= core[u])
+                return;
+            // move v to the front of its bucket and shrink the bucket by one
+            const count d = core[v];
+            const node w = order[bucketBegin[d]];
+            std::swap(order[position[v]], order[bucketBegin[d]]);
+            std::swap(position[v], position[w]);
+            ++bucketBegin[d];
+            --core[v];
+        });
+    }
+
+    const count maxCore = order.empty() ? 0 : core[order.back()];
+    coreSize.assign(maxCore + 1, 0);
+    scoreData.assign(z, 0);
+    G.forNodes([&](node u) {
+        ++coreSize[core[u]];
+        scoreData[u] = static_cast<double>(core[u]);
+    });
+
+    // link the sentinels and the nodes in peeling order
+    nodeLabel.assign(z, none);
+    nodeNext.assign(z, none);
+    nodePrev.assign(z, none);
+    sentinelLabel.clear();
+    sentinelNext.clear();
+    sentinelPrev.clear();
+    tail = none;
+    auto append = [&](uint64_t item) {
+        if (tail != none)
+            next(tail) = item;
+        prev(item) = tail;
+        next(item) = none;
+        label(item) = 0;
+        tail = item;
+    };
+    auto nextNode = order.begin();
+    for (count k = 0; k <= maxCore; ++k) {
+        sentinelLabel.push_back(0);
+        sentinelNext.push_back(none);
+        sentinelPrev.push_back(none);
+        append(k | sentinelFlag);
+        for (; nextNode != order.end() && core[*nextNode] == k; ++nextNode)
+            append(*nextNode);
+    }
+    relabelAll();
+
+    laterDegree.assign(z, 0);
+    G.parallelForNodes([&](node u) {
+        forIncidentNodes(u, [&](node v) { laterDegree[u] += precedes(u, v); });
+    });
+
+    scratch.assign(z, 0);
+    state.assign(z, UNSEEN);
+    visited = 0;
+    hasRun = true;
+}
+
+void DynCoreDecomposition::update(GraphEvent event) {
+    updateBatch({event});
+}
+
+void DynCoreDecomposition::updateBatch(const std::vector<GraphEvent> &batch) {
+    assureFinished();
+    addNodes();
+    visited = 0;
+
+    const bool directed = G.isDirected();
+    auto key = [&](node u, node v) {
+        return (directed || u < v) ? std::make_pair(u, v) : std::make_pair(v, u);
+    };
+
+    // net change of each edge, so that an edge that is inserted and removed again is ignored
+    std::unordered_map<std::pair<node, node>, int, Aux::PairHash> change;
+    std::vector<node> removedNodes;
+    for (const auto &event : batch) {
+        switch (event.type) {
+        case GraphEvent::EDGE_ADDITION:
+            if (event.u != event.v)
+                ++change[key(event.u, event.v)];
+            break;
+        case GraphEvent::EDGE_REMOVAL:
+            if (event.u != event.v)
+                --change[key(event.u, event.v)];
+            break;
+        case GraphEvent::NODE_RESTORATION:
+            if (nodeLabel[event.u] == none) {
+                insertAfter(sentinel(0), event.u);
+                laterDegree[event.u] = 0;
+            }
+            break;
+        case GraphEvent::NODE_REMOVAL:
+            removedNodes.push_back(event.u);
+            break;
+        default:
+            break;
+        }
+    }
+
+    std::vector<std::pair<node, node>> insertions, removals;
+    for (const auto &event : batch) {
+        if ((event.type != GraphEvent::EDGE_ADDITION && event.type != GraphEvent::EDGE_REMOVAL)
+            || event.u == event.v)
+            continue;
+        const auto edge = key(event.u, event.v);
+        if (event.type == GraphEvent::EDGE_ADDITION && change[edge] > 0) {
+            insertions.push_back(edge);
+            pending.insert(edge);
+            change[edge] = 0;
+        } else if (event.type == GraphEvent::EDGE_REMOVAL && change[edge] < 0) {
+            removals.push_back(edge);
+            removedOut[edge.first].push_back(edge.second);
+            (directed ? removedIn : removedOut)[edge.second].push_back(edge.first);
+            change[edge] = 0;
+        }
+    }
+
+    auto forget = [](std::unordered_map<node, std::vector<node>> &removed, node u, node v) {
+        const auto it = removed.find(u);
+        auto &neighbors = it->second;
+        *std::find(neighbors.begin(), neighbors.end(), v) = neighbors.back();
+        neighbors.pop_back();
+        if (neighbors.empty())
+            removed.erase(it);
+    };
+    for (const auto &[u, v] : removals) {
+        forget(removedOut, u, v);
+        forget(directed ? removedIn : removedOut, v, u);
+        removeEdge(u, v);
+    }
+
+    // A removed node with a positive core number had edges that were not reported.
+    for (const node u : removedNodes) {
+        if (core[u] > 0) {
+            run();
+            visited = G.numberOfNodes();
+            return;
+        }
+        if (nodeLabel[u] != none)
+            unlink(u);
+    }
+
+    for (const auto &edge : insertions) {
+        pending.erase(edge);
+        insertEdge(edge.first, edge.second);
+    }
+}
+
+count DynCoreDecomposition::maxCoreNumber() const {
+    assureFinished();
+    for (count k = coreSize.size() - 1; k > 0; --k)
+        if (coreSize[k] > 0)
+            return k;
+    return 0;
+}
+
+void DynCoreDecomposition::setCore(node u, count k) {
+    --coreSize[core[u]];
+    if (k >= coreSize.size())
+        coreSize.resize(k + 1, 0);
+    ++coreSize[k];
+    core[u] = k;
+    scoreData[u] = static_cast<double>(k);
+}
+
+void DynCoreDecomposition::addNodes() {
+    const count oldBound = core.size(), z = G.upperNodeIdBound();
+    if (oldBound >= z)
+        return;
+    coreSize[0] += z - oldBound;
+    core.resize(z, 0);
+    scoreData.resize(z, 0);
+    laterDegree.resize(z, 0);
+    nodeLabel.resize(z, none);
+    nodeNext.resize(z, none);
+    nodePrev.resize(z, none);
+    scratch.resize(z, 0);
+    state.resize(z, UNSEEN);
+    for (node u = oldBound; u < z; ++u)
+        if (G.hasNode(u))
+            insertAfter(sentinel(0), u);
+}
+
+void DynCoreDecomposition::resetScratch() {
+    for (const node x : touched) {
+        state[x] = UNSEEN;
+        scratch[x] = 0;
+    }
+    touched.clear();
+}
+
+void DynCoreDecomposition::insertEdge(node u, node v) {
+    if (precedes(v, u))
+        std::swap(u, v);
+    const count k = core[u];
+    if (++laterDegree[u] <= k)
+        return;
+
+    // Nodes of core number k are scanned in k-order, starting at u. For a scanned node x,
+    // scratch[x] counts its neighbors that are candidates and come before it. Candidates are
+    // moved to the end of the core, so x becomes a candidate if these together with its later
+    // neighbors are more than k. The later neighbors are counted optimistically: a candidate
+    // loses a later neighbor that is not a candidate, and is revoked if it has at most k left.
+    using Entry = std::pair<uint64_t, node>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    auto enqueue = [&](node x) {
+        state[x] = QUEUED;
+        touched.push_back(x);
+        queue.emplace(nodeLabel[x], x);
+    };
+
+    std::vector<node> candidates, revoked;
+    // Revoked candidates stay in core k and are inserted in the order of their revocation
+    // after the scanned node that caused it. The ones that are revoked later end up after
+    // them; all other neighbors that are not promoted end up before them.
+    std::vector<std::pair<node, node>> revokedAfter;
+    auto loseNeighbor = [&](node w, node x) {
+        --(precedes(w, x) ? laterDegree[w] : scratch[w]);
+        if (state[w] == CANDIDATE && laterDegree[w] + scratch[w] <= k) {
+            state[w] = REVOKED;
+            revoked.push_back(w);
+        }
+    };
+    auto revoke = [&](node anchor) {
+        for (index i = 0; i < revoked.size(); ++i) {
+            const node x = revoked[i];
+            revokedAfter.emplace_back(anchor, x);
+            anchor = x;
+            state[x] = DETERMINED;
+            laterDegree[x] += scratch[x];
+            scratch[x] = 0;
+            forIncidentNodes(x, [&](node y) {
+                if (state[y] == CANDIDATE || state[y] == REVOKED)
+                    loseNeighbor(y, x);
+                else if (state[y] == QUEUED && precedes(x, y))
+                    --scratch[y];
+            });
+        }
+        revoked.clear();
+    };
+
+    enqueue(u);
+    while (!queue.empty()) {
+        const node x = queue.top().second;
+        queue.pop();
+        ++visited;
+
+        if (laterDegree[x] + scratch[x] > k) {
+            state[x] = CANDIDATE;
+            candidates.push_back(x);
+            forIncidentNodes(x, [&](node y) {
+                if (core[y] == k && precedes(x, y)) {
+                    if (state[y] == UNSEEN)
+                        enqueue(y);
+                    ++scratch[y];
+                }
+            });
+            continue;
+        }
+
+        state[x] = DETERMINED;
+        if (scratch[x] == 0)
+            continue;
+        // x stays in place, so its candidate neighbors end up after it
+        laterDegree[x] += scratch[x];
+        scratch[x] = 0;
+        forIncidentNodes(x, [&](node w) {
+            if (state[w] == CANDIDATE || state[w] == REVOKED)
+                loseNeighbor(w, x);
+        });
+        revoke(x);
+    }
+
+    // the remaining candidates get core number k + 1 and keep their order at its front
+    for (const auto &entry : revokedAfter)
+        unlink(entry.second);
+    for (const auto &[anchor, x] : revokedAfter)
+        insertAfter(anchor, x);
+    uint64_t anchor = sentinel(k + 1);
+    for (const node x : candidates) {
+        if (state[x] != CANDIDATE)
+            continue;
+        unlink(x);
+        setCore(x, k + 1);
+        insertAfter(anchor, x);
+        anchor = x;
+    }
+    resetScratch();
+}
+
+void DynCoreDecomposition::removeEdge(node u, node v) {
+    if (precedes(v, u))
+        std::swap(u, v);
+    --laterDegree[u];
+    const count k = core[u];
+    if (k == 0)
+        return;
+
+    // scratch[x] counts the neighbors of x with core number at least k; nodes with less than k
+    // of them are demoted to core number k - 1. The core number of a demoted node is only
+    // lowered after its neighbors have been updated, so each neighbor loses it exactly once.
+    std::vector<node> demoted, stack;
+    auto demote = [&](node x) {
+        state[x] = DETERMINED;
+        demoted.push_back(x);
+        stack.push_back(x);
+    };
+    auto countNeighbors = [&](node x) {
+        state[x] = QUEUED;
+        touched.push_back(x);
+        ++visited;
+        forIncidentNodes(x, [&](node y) { scratch[x] += core[y] >= k; });
+        if (scratch[x] < k)
+            demote(x);
+    };
+
+    for (const node x : {u, v}) {
+        if (core[x] == k && state[x] == UNSEEN)
+            countNeighbors(x);
+    }
+    while (!stack.empty()) {
+        const node x = stack.back();
+        stack.pop_back();
+        forIncidentNodes(x, [&](node y) {
+            if (core[y] != k)
+                return;
+            // x moves before all nodes that remain in core k
+            if (precedes(y, x))
+                --laterDegree[y];
+            if (state[y] == UNSEEN)
+                countNeighbors(y);
+            if (state[y] == QUEUED && --scratch[y] < k)
+                demote(y);
+        });
+        setCore(x, k - 1);
+    }
+    if (demoted.empty()) {
+        resetScratch();
+        return;
+    }
+
+    // The demoted nodes are appended to core k - 1 in the order of their demotion, so their
+    // later neighbors are those in core k and above and the ones demoted after them.
+    for (index i = 0; i < demoted.size(); ++i)
+        scratch[demoted[i]] = i;
+    for (const node x : demoted) {
+        laterDegree[x] = 0;
+        forIncidentNodes(x, [&](node y) {
+            laterDegree[x] += core[y] >= k || (state[y] == DETERMINED && scratch[y] > scratch[x]);
+        });
+    }
+
+    const uint64_t end = sentinel(k);
+    for (const node x : demoted) {
+        unlink(x);
+        insertAfter(prev(end), x);
+    }
+    resetScratch();
+}
+
+uint64_t &DynCoreDecomposition::label(uint64_t item) {
+    return (item & sentinelFlag) ? sentinelLabel[item ^ sentinelFlag] : nodeLabel[item];
+}
+
+uint64_t &DynCoreDecomposition::next(uint64_t item) {
+    return (item & sentinelFlag) ? sentinelNext[item ^ sentinelFlag] : nodeNext[item];
+}
+
+uint64_t &DynCoreDecomposition::prev(uint64_t item) {
+    return (item & sentinelFlag) ? sentinelPrev[item ^ sentinelFlag] : nodePrev[item];
+}
+
+uint64_t DynCoreDecomposition::sentinel(count k) {
+    while (sentinelLabel.size() <= k) {
+        sentinelLabel.push_back(none);
+        sentinelNext.push_back(none);
+        sentinelPrev.push_back(none);
+        insertAfter(tail, (sentinelLabel.size() - 1) | sentinelFlag);
+    }
+    return k | sentinelFlag;
+}
+
+void DynCoreDecomposition::unlink(uint64_t item) {
+    // sentinel 0 is the first item and never unlinked
+    const uint64_t before = prev(item), after = next(item);
+    next(before) = after;
+    if (after != none)
+        prev(after) = before;
+    else
+        tail = before;
+    label(item) = none;
+}
+
+void DynCoreDecomposition::insertAfter(uint64_t anchor, uint64_t item) {
+    const uint64_t after = next(anchor);
+    if (after == none) {
+        // appending takes a fixed step, so the space after the tail is not halved each time
+        if (labelBound - label(anchor) < 2)
+            relabelAll();
+        label(item) = label(anchor) + std::min(tailStep, (labelBound - label(anchor)) / 2);
+        tail = item;
+    } else {
+        if (label(after) - label(anchor) < 2)
+            relabelAfter(anchor);
+        label(item) = label(anchor) + (label(after) - label(anchor)) / 2;
+        prev(after) = item;
+    }
+    next(item) = after;
+    prev(item) = anchor;
+    next(anchor) = item;
+}
+
+void DynCoreDecomposition::relabelAfter(uint64_t anchor) {
+    // Find the smallest j such that the j items after the anchor span more than j^2 labels and
+    // spread them evenly (Dietz and Sleator, STOC 1987); amortized, this takes O(log n) time.
+    const uint64_t lower = label(anchor);
+    uint64_t last = next(anchor);
+    uint64_t j = 1;
+    while (last != none && label(last) - lower <= j * j) {
+        last = next(last);
+        if (++j > (uint64_t{1} << 30)) {
+            relabelAll();
+            return;
+        }
+    }
+    const uint64_t upper = last == none ? labelBound : label(last);
+    if (upper - lower <= 2 * j) {
+        relabelAll();
+        return;
+    }
+    const uint64_t gap = (upper - lower) / j;
+    uint64_t i = 1;
+    for (uint64_t item = next(anchor); item != last; item = next(item))
+        label(item) = lower + gap * i++;
+}
+
+void DynCoreDecomposition::relabelAll() {
+    count numItems = 0;
+    for (uint64_t item = sentinelFlag; item != none; item = next(item))
+        ++numItems;
+    // the upper half of the labels is left for appended items
+    const uint64_t gap = labelBound / 2 / (numItems + 1);
+    uint64_t i = 0;
+    for (uint64_t item = sentinelFlag; item != none; item = next(item))
+        label(item) = gap * i++;
+}
+
+} /* namespace NetworKit */
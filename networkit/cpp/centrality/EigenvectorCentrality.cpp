@@ -5,7 +5,10 @@
  *      Author: Henning
  */
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/centrality/EigenvectorCentrality.hpp>
@@ -16,26 +19,38 @@ EigenvectorCentrality::EigenvectorCentrality(const Graph &G, double tol)
     : Centrality(G, true), tol(tol) {}
 
 void EigenvectorCentrality::run() {
+    if (precision == SpMVPrecision::SINGLE)
+        runWithPrecision<float>();
+    else
+        runWithPrecision<double>();
+}
+
+template <typename T>
+void EigenvectorCentrality::runWithPrecision() {
     std::vector<double> values(G.upperNodeIdBound(), 1.0);
     scoreData = values;
 
+    const PullSpMV<T> A(G);
+    std::vector<T> x(G.upperNodeIdBound(), 0);
+
     double length = 0.0;
     double oldLength = 0.0;
 
     auto converged([tol = tol](double val, double other) -> bool {
-        // compute residual
-        return (Aux::NumericTools::equal(val, other, tol));
+        // compute residual; in single precision, the length itself has a relative error of
+        // about the machine epsilon
+        const double error = std::is_same<T, float>::value
+                                 ? std::max(tol, 4.0 * std::numeric_limits<T>::epsilon() * val)
+                                 : tol;
+        return (Aux::NumericTools::equal(val, other, error));
     });
 
     do {
         oldLength = length;
 
         // iterate matrix-vector product
-        G.parallelForNodes([&](node u) {
-            values[u] = 0.0;
-            G.forInEdgesOf(u,
-                           [&](node u, node v, edgeweight ew) { values[u] += ew * scoreData[v]; });
-        });
+        G.parallelForNodes([&](node u) { x[u] = static_cast<T>(scoreData[u]); });
+        A.multiply(x, values);
 
         // normalize values
         length = G.parallelSumForNodes([&values](node u) { return (values[u] * values[u]); });
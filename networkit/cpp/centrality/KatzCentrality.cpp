@@ -5,6 +5,11 @@
  *      Author: Henning
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/centrality/KatzCentrality.hpp>
@@ -24,37 +29,42 @@ KatzCentrality::KatzCentrality(const Graph &G, double alpha, double beta, double
 }
 
 void KatzCentrality::run() {
+    if (edgeDirection != EdgeDirection::OUT_EDGES && edgeDirection != EdgeDirection::IN_EDGES)
+        throw std::runtime_error("Unsupported edge direction");
+
+    if (precision == SpMVPrecision::SINGLE)
+        runWithPrecision<float>();
+    else
+        runWithPrecision<double>();
+}
+
+template <typename T>
+void KatzCentrality::runWithPrecision() {
     std::fill(values.begin(), values.end(), 1.0);
     values.resize(G.upperNodeIdBound(), 1.0);
     scoreData = values;
     double length = 0.0;
     double oldLength = 0.0;
 
-    auto converged = [&](double val, double other) -> bool {
-        // compute residual
-        return Aux::NumericTools::equal(val, other, tol);
-    };
+    const PullSpMV<T> A(G, edgeDirection == EdgeDirection::OUT_EDGES);
+    std::vector<T> x(G.upperNodeIdBound(), 0);
 
-    auto updateScore = [&](node u, node v, edgeweight ew, edgeid) -> void {
-        values[u] += ew * alpha * (1 + scoreData[v]);
+    auto converged = [&](double val, double other) -> bool {
+        // compute residual; in single precision, the length itself has a relative error of
+        // about the machine epsilon
+        const double error = std::is_same<T, float>::value
+                                 ? std::max(tol, 4.0 * std::numeric_limits<T>::epsilon() * val)
+                                 : tol;
+        return Aux::NumericTools::equal(val, other, error);
     };
 
     do {
         oldLength = length;
 
-        // iterate matrix-vector product
-        G.parallelForNodes([&](node u) {
-            values[u] = 0.0;
-
-            if (edgeDirection == EdgeDirection::OUT_EDGES)
-                G.forNeighborsOf(u, updateScore);
-            else if (edgeDirection == EdgeDirection::IN_EDGES)
-                G.forInNeighborsOf(u, updateScore);
-            else
-                throw std::runtime_error("Unsupported edge direction");
-
-            values[u] += beta;
-        });
+        // iterate matrix-vector product: values = alpha * A (1 + scoreData) + beta
+        G.parallelForNodes([&](node u) { x[u] = static_cast<T>(1 + scoreData[u]); });
+        A.multiply(x, values);
+        G.parallelForNodes([&](node u) { values[u] = alpha * values[u] + beta; });
 
         // normalize values
         length = G.parallelSumForNodes([&](node u) { return values[u] * values[u]; });
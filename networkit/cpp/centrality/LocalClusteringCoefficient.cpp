@@ -1,5 +1,6 @@
 #include <omp.h>
 #include <networkit/centrality/LocalClusteringCoefficient.hpp>
+#include <networkit/graph/TriangleEngine.hpp>
 
 namespace NetworKit {
 
@@ -18,28 +19,15 @@ void LocalClusteringCoefficient::run() {
     scoreData.clear();
     scoreData.resize(z); // $c(u) := \frac{2 \cdot |E(N(u))| }{\deg(u) \cdot ( \deg(u) - 1)}$
 
-    std::vector<index> inBegin;
-    std::vector<node> inEdges;
-
     if (turbo) {
-        auto isOutEdge = [&](node u, node v) {
-            return G.degree(u) > G.degree(v) || (G.degree(u) == G.degree(v) && u < v);
-        };
-
-        inBegin.resize(G.upperNodeIdBound() + 1);
-        inEdges.resize(G.numberOfEdges());
-        index pos = 0;
-        for (index u = 0; u < G.upperNodeIdBound(); ++u) {
-            inBegin[u] = pos;
-            if (G.hasNode(u)) {
-                G.forEdgesOf(u, [&](node v) {
-                    if (isOutEdge(v, u)) {
-                        inEdges[pos++] = v;
-                    }
-                });
-            }
-        }
-        inBegin[G.upperNodeIdBound()] = pos;
+        const auto triangles = TriangleEngine(G).trianglesPerNode();
+        G.parallelForNodes([&](node u) {
+            const count d = G.degree(u);
+            scoreData[u] = d < 2 ? 0.0 : 2.0 * static_cast<double>(triangles[u])
+                                             / static_cast<double>(d * (d - 1));
+        });
+        hasRun = true;
+        return;
     }
 
     std::vector<std::vector<bool>> nodeMarker(omp_get_max_threads());
@@ -60,28 +48,17 @@ void LocalClusteringCoefficient::run() {
             G.forEdgesOf(u, [&](node v) { nodeMarker[tid][v] = true; });
 
             G.forEdgesOf(u, [&](node, node v) {
-                if (turbo) {
-                    for (index i = inBegin[v]; i < inBegin[v + 1]; ++i) {
-                        node w = inEdges[i];
-                        if (nodeMarker[tid][w]) {
-                            triangles += 1;
-                        }
+                G.forEdgesOf(v, [&](node, node w) {
+                    if (nodeMarker[tid][w]) {
+                        triangles += 1;
                     }
-                } else {
-                    G.forEdgesOf(v, [&](node, node w) {
-                        if (nodeMarker[tid][w]) {
-                            triangles += 1;
-                        }
-                    });
-                }
+                });
             });
 
             G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = false; });
 
             // No division by 2 since triangles are counted twice as well!
             scoreData[u] = (double)triangles / (double)(d * (d - 1));
-            if (turbo)
-                scoreData[u] *= 2; // in turbo mode, we count each triangle only once
         }
     });
     hasRun = true;
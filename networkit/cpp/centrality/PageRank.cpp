@@ -6,10 +6,16 @@
  *               Fabian Brandt-Tumescheit <brandtfa@hu-berlin.de>
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/PageRank.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 
 namespace NetworKit {
 
@@ -19,14 +25,38 @@ PageRank::PageRank(const Graph &G, double damp, double tol, bool normalized,
       distributeSinks(distributeSinks) {}
 
 void PageRank::run() {
+    if (precision == SpMVPrecision::SINGLE)
+        runWithPrecision<float>();
+    else
+        runWithPrecision<double>();
+}
+
+template <typename T>
+void PageRank::runWithPrecision() {
+    scoreData.resize(G.upperNodeIdBound(), 1.0 / static_cast<double>(G.numberOfNodes()));
+    iterations = computeScores<T>(G, damp, tol, normalized, distributeSinks, norm, maxIterations,
+                                  scoreData);
+
+    // calculate the maxium
+    max = scoreData[0];
+    G.balancedParallelForNodes([&](const node u) { Aux::Parallel::atomic_max(max, scoreData[u]); });
+    hasRun = true;
+}
+
+template <typename T, class GraphType>
+count PageRank::computeScores(const GraphType &G, double damp, double tol, bool normalized,
+                              SinkHandling distributeSinks, Norm norm, count maxIterations,
+                              std::vector<double> &scores) {
     Aux::SignalHandler handler;
     const auto n = G.numberOfNodes();
     const auto z = G.upperNodeIdBound();
 
     const auto teleportProb = (1.0 - damp) / static_cast<double>(n);
     const double factor = damp / static_cast<double>(n);
-    scoreData.resize(z, 1.0 / static_cast<double>(n));
-    std::vector<double> pr = scoreData;
+    std::vector<double> pr = scores;
+
+    const PullSpMV<T> A(G);
+    std::vector<T> x(z, 0);
 
     std::vector<double> deg(z, 0.0);
     G.parallelForNodes([&](const node u) { deg[u] = static_cast<double>(G.weightedDegree(u)); });
@@ -41,12 +71,12 @@ void PageRank::run() {
     }
     count nSinks = sinks.size();
 
-    iterations = 0;
+    count iterations = 0;
 
-    auto sumL1Norm = [&](const node u) { return std::abs(scoreData[u] - pr[u]); };
+    auto sumL1Norm = [&](const node u) { return std::abs(scores[u] - pr[u]); };
 
     auto sumL2Norm = [&](const node u) {
-        const auto d = scoreData[u] - pr[u];
+        const auto d = scores[u] - pr[u];
         return d * d;
     };
 
@@ -55,44 +85,50 @@ void PageRank::run() {
             return true;
         }
 
+        // In single precision, differences below a few ulps of the scores are rounding errors.
+        double tolerance = tol;
+        if (std::is_same<T, float>::value) {
+            const double scale =
+                norm == Norm::L2_NORM
+                    ? std::sqrt(G.parallelSumForNodes([&](const node u) { return pr[u] * pr[u]; }))
+                    : G.parallelSumForNodes([&](const node u) { return std::abs(pr[u]); });
+            tolerance = std::max(tol, 4.0 * std::numeric_limits<T>::epsilon() * scale);
+        }
+
         if (norm == Norm::L2_NORM) {
-            return std::sqrt(G.parallelSumForNodes(sumL2Norm)) <= tol;
+            return std::sqrt(G.parallelSumForNodes(sumL2Norm)) <= tolerance;
         }
 
-        return G.parallelSumForNodes(sumL1Norm) <= tol;
+        return G.parallelSumForNodes(sumL1Norm) <= tolerance;
     });
 
     bool isConverged = false;
     do {
         handler.assureRunning();
-        G.balancedParallelForNodes([&](const node u) {
-            pr[u] = 0.0;
-            G.forInEdgesOf(u, [&](const node u, const node v, const edgeweight w) {
-                // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed
-                // graphs we follow the verbal description, which requires to sum over the incoming
-                // edges
-                pr[u] += scoreData[v] * w / deg[v];
-            });
-            pr[u] *= damp;
-            pr[u] += teleportProb;
+        // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+        // we follow the verbal description, which requires to sum over the incoming edges
+        G.parallelForNodes([&](const node u) {
+            x[u] = deg[u] > 0 ? static_cast<T>(scores[u] / deg[u]) : T{0};
         });
+        A.multiply(x, pr);
 
         // For directed graphs sink-handling is needed to fulfill |pr| == 1 in each step. Otherwise
         // probability mass would be leaked, creating wrong results. For this, we add edges from
         // sinks to all other nodes. This is described amongst others in "PageRank revisited."
         // by M. Brinkmeyer et al. (2005).
+        double totalSinkContrib = 0.0;
         if (G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized)) {
-            double totalSinkContrib = 0.0;
 #pragma omp parallel for reduction(+ : totalSinkContrib)
             for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
-                totalSinkContrib += factor * scoreData[sinks[i]];
+                totalSinkContrib += factor * scores[sinks[i]];
             }
-            G.balancedParallelForNodes([&](const node u) { pr[u] += totalSinkContrib; });
         }
+        G.parallelForNodes(
+            [&](const node u) { pr[u] = damp * pr[u] + teleportProb + totalSinkContrib; });
 
         ++iterations;
         isConverged = converged();
-        std::swap(pr, scoreData);
+        std::swap(pr, scores);
     } while (!isConverged);
 
     handler.assureRunning();
@@ -105,28 +141,34 @@ void PageRank::run() {
             double sum = 0.0;
 #pragma omp parallel for reduction(+ : sum)
             for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
-                sum += scoreData[sinks[i]];
+                sum += scores[sinks[i]];
             }
             normFactor = (1.0 / static_cast<double>(n)) * ((1.0 - damp) + (damp * sum));
         } else {
             normFactor = teleportProb;
         }
-        G.parallelForNodes([&](const node u) { scoreData[u] /= normFactor; });
+        G.parallelForNodes([&](const node u) { scores[u] /= normFactor; });
 
         // Post-processing for non-normalized PageRank
     } else {
         if (G.isDirected() && distributeSinks == SinkHandling::NO_SINK_HANDLING) {
             // In case no sink handling was done, make sure that |pr| == 1
-            const auto sum = G.parallelSumForNodes([&](const node u) { return scoreData[u]; });
-            G.parallelForNodes([&](const node u) { scoreData[u] /= sum; });
+            const auto sum = G.parallelSumForNodes([&](const node u) { return scores[u]; });
+            G.parallelForNodes([&](const node u) { scores[u] /= sum; });
         }
     }
-    // calculate the maxium
-    max = scoreData[0];
-    G.balancedParallelForNodes([&](const node u) { Aux::Parallel::atomic_max(max, scoreData[u]); });
-    hasRun = true;
+    return iterations;
 }
 
+template count PageRank::computeScores<float>(const Graph &, double, double, bool, SinkHandling,
+                                             Norm, count, std::vector<double> &);
+template count PageRank::computeScores<double>(const Graph &, double, double, bool, SinkHandling,
+                                              Norm, count, std::vector<double> &);
+template count PageRank::computeScores<float>(const CSRGraph &, double, double, bool,
+                                             SinkHandling, Norm, count, std::vector<double> &);
+template count PageRank::computeScores<double>(const CSRGraph &, double, double, bool,
+                                              SinkHandling, Norm, count, std::vector<double> &);
+
 double PageRank::maximum() {
     return max.load(std::memory_order_relaxed);
 }
@@ -0,0 +1,425 @@
+/*
+ * ParallelCoreDecomposition.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/centrality/ParallelCoreDecomposition.hpp>
+#include <networkit/structures/UnionFind.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Calls handle(v, w) for all neighbors v != u, for directed graphs in both directions.
+template <typename Handle>
+void forIncidentEdges(const Graph &G, node u, Handle handle) {
+    G.forNeighborsOf(u, [&](node, node v, edgeweight w) {
+        if (v != u)
+            handle(v, w);
+    });
+    if (G.isDirected()) {
+        G.forInEdgesOf(u, [&](node, node v, edgeweight w) {
+            if (v != u)
+                handle(v, w);
+        });
+    }
+}
+
+// Buckets of the remaining nodes by integer degree. Nodes are inserted again whenever their
+// degree changes; stale entries are skipped when a bucket is extracted.
+class DegreeBuckets {
+public:
+    explicit DegreeBuckets(count maxKey) : buckets(maxKey + 1) {}
+
+    void insert(node u, count key) {
+        buckets[key].push_back(u);
+        minKey = std::min(minKey, key);
+    }
+
+    // Moves the nodes of the smallest non-empty bucket to frontier and returns its key.
+    count extract(const std::vector<count> &key, std::vector<uint8_t> &alive,
+                  std::vector<node> &frontier) {
+        for (; minKey < buckets.size(); ++minKey) {
+            auto &bucket = buckets[minKey];
+            for (const node u : bucket) {
+                if (alive[u] && key[u] == minKey) {
+                    alive[u] = 0;
+                    frontier.push_back(u);
+                }
+            }
+            std::vector<node>().swap(bucket);
+            if (!frontier.empty())
+                return minKey;
+        }
+        return none;
+    }
+
+private:
+    std::vector<std::vector<node>> buckets;
+    count minKey = 0;
+};
+
+// Lazy min-heap of the remaining nodes by weighted degree.
+class WeightedDegreeHeap {
+public:
+    explicit WeightedDegreeHeap(count) {}
+
+    void insert(node u, double key) { heap.emplace(key, u); }
+
+    // Moves all nodes with the smallest weighted degree to frontier and returns it.
+    double extract(const std::vector<double> &key, std::vector<uint8_t> &alive,
+                   std::vector<node> &frontier) {
+        while (!heap.empty()) {
+            const auto [k, u] = heap.top();
+            if (!frontier.empty() && k > key[frontier.front()])
+                break;
+            heap.pop();
+            if (alive[u] && key[u] == k) {
+                alive[u] = 0;
+                frontier.push_back(u);
+            }
+        }
+        return key[frontier.front()];
+    }
+
+private:
+    std::priority_queue<std::pair<double, node>, std::vector<std::pair<double, node>>,
+                        std::greater<std::pair<double, node>>>
+        heap;
+};
+
+} // namespace
+
+ParallelCoreDecomposition::ParallelCoreDecomposition(const Graph &G, bool useEdgeWeights)
+    : Centrality(G), weighted(useEdgeWeights && G.isWeighted()) {
+    if (weighted) {
+        G.forEdges([&](node, node, edgeweight w) {
+            if (w < 0)
+                throw std::runtime_error("Edge weights must not be negative.");
+        });
+    }
+}
+
+void ParallelCoreDecomposition::run() {
+    scoreData.assign(G.upperNodeIdBound(), 0);
+    iterations = 0;
+    maxCore = 0;
+
+    if (mode == Mode::PEELING) {
+        if (weighted)
+            runPeeling<double>();
+        else
+            runPeeling<count>();
+    } else {
+        if (weighted)
+            runHIndex<double>();
+        else
+            runHIndex<count>();
+    }
+
+    G.forNodes([&](node u) { maxCore = std::max(maxCore, scoreData[u]); });
+    hasRun = true;
+}
+
+template <typename Key>
+void ParallelCoreDecomposition::runPeeling() {
+    Aux::SignalHandler handler;
+    const count z = G.upperNodeIdBound();
+
+    std::vector<Key> key(z, 0);
+    std::vector<uint8_t> alive(z, 0);
+    G.parallelForNodes([&](node u) {
+        Key k = 0;
+        forIncidentEdges(G, u, [&](node, edgeweight w) {
+            k += std::is_same<Key, count>::value ? Key{1} : static_cast<Key>(w);
+        });
+        key[u] = k;
+        alive[u] = 1;
+    });
+
+    using Queue = typename std::conditional<std::is_same<Key, count>::value, DegreeBuckets,
+                                            WeightedDegreeHeap>::type;
+    count maxKey = 0;
+    if (std::is_same<Key, count>::value)
+        G.forNodes([&](node u) { maxKey = std::max(maxKey, static_cast<count>(key[u])); });
+    Queue queue(maxKey);
+    G.forNodes([&](node u) { queue.insert(u, key[u]); });
+
+    // stamp[v] is the last round in which the key of v was decreased
+    std::vector<index> stamp(z, none);
+    std::vector<std::vector<node>> changed(omp_get_max_threads());
+    std::vector<node> frontier, next;
+    count remaining = G.numberOfNodes();
+    index round = 0;
+
+    while (remaining > 0) {
+        handler.assureRunning();
+        frontier.clear();
+        const Key level = queue.extract(key, alive, frontier);
+
+        // Remove all nodes with key <= level; removing them can push further nodes below the
+        // level, which are removed in the next sub-round with the same core number.
+        while (!frontier.empty()) {
+            remaining -= frontier.size();
+
+#pragma omp parallel for schedule(guided)
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                const node u = frontier[i];
+                scoreData[u] = static_cast<double>(level);
+                auto &localChanged = changed[omp_get_thread_num()];
+                forIncidentEdges(G, u, [&](node v, edgeweight w) {
+                    if (!alive[v])
+                        return;
+                    if constexpr (std::is_same<Key, count>::value) {
+#pragma omp atomic
+                        --key[v];
+                    } else {
+#pragma omp atomic
+                        key[v] -= w;
+                    }
+                    index last;
+#pragma omp atomic capture
+                    {
+                        last = stamp[v];
+                        stamp[v] = round;
+                    }
+                    if (last != round)
+                        localChanged.push_back(v);
+                });
+            }
+
+            next.clear();
+            for (auto &localChanged : changed) {
+                for (const node v : localChanged) {
+                    if (key[v] <= level) {
+                        alive[v] = 0;
+                        next.push_back(v);
+                    } else {
+                        queue.insert(v, key[v]);
+                    }
+                }
+                localChanged.clear();
+            }
+            std::swap(frontier, next);
+            ++round;
+        }
+    }
+
+    iterations = round;
+    converged = true;
+}
+
+template <typename Key>
+void ParallelCoreDecomposition::runHIndex() {
+    Aux::SignalHandler handler;
+    const count z = G.upperNodeIdBound();
+
+    std::vector<Key> h(z, 0), updated(z, 0);
+    G.parallelForNodes([&](node u) {
+        Key k = 0;
+        forIncidentEdges(G, u, [&](node, edgeweight w) {
+            k += std::is_same<Key, count>::value ? Key{1} : static_cast<Key>(w);
+        });
+        h[u] = k;
+    });
+
+    // The h-index of u is the largest value x such that the (weighted) number of neighbors v
+    // with h[v] >= x is at least x.
+    struct ThreadData {
+        std::vector<std::pair<Key, edgeweight>> neighbors;
+        std::vector<count> counts;
+        std::vector<node> changed;
+    };
+    std::vector<ThreadData> threadData(omp_get_max_threads());
+
+    auto hIndex = [&](ThreadData &data, node u) -> Key {
+        if constexpr (std::is_same<Key, count>::value) {
+            // counting sort of the neighbor values, capped at the current value of u
+            const count cap = h[u];
+            data.counts.assign(cap + 1, 0);
+            forIncidentEdges(G, u,
+                             [&](node v, edgeweight) { ++data.counts[std::min(cap, h[v])]; });
+            count atLeast = 0;
+            for (count x = cap; x > 0; --x) {
+                atLeast += data.counts[x];
+                if (atLeast >= x)
+                    return x;
+            }
+            return 0;
+        } else {
+            data.neighbors.clear();
+            forIncidentEdges(G, u,
+                             [&](node v, edgeweight w) { data.neighbors.emplace_back(h[v], w); });
+            std::sort(data.neighbors.begin(), data.neighbors.end(),
+                      [](const auto &a, const auto &b) { return a.first > b.first; });
+            Key best = 0, weight = 0;
+            for (const auto &[value, w] : data.neighbors) {
+                if (value <= best)
+                    break;
+                weight += w;
+                best = std::max(best, std::min(value, weight));
+            }
+            return std::min(best, h[u]);
+        }
+    };
+
+    std::vector<node> frontier;
+    frontier.reserve(G.numberOfNodes());
+    G.forNodes([&](node u) { frontier.push_back(u); });
+    std::vector<index> stamp(z, none);
+
+    converged = false;
+    while (!frontier.empty() && iterations < maxIterations) {
+        handler.assureRunning();
+
+        // all nodes of an iteration are evaluated on the values of the previous iteration
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+            const node u = frontier[i];
+            auto &data = threadData[omp_get_thread_num()];
+            const Key value = hIndex(data, u);
+            if (value < h[u]) {
+                updated[u] = value;
+                data.changed.push_back(u);
+            }
+        }
+
+        frontier.clear();
+        for (auto &data : threadData) {
+            for (const node u : data.changed)
+                h[u] = updated[u];
+        }
+
+        // the nodes adjacent to a changed node have to be evaluated again
+        for (auto &data : threadData) {
+            for (const node u : data.changed) {
+                forIncidentEdges(G, u, [&](node v, edgeweight) {
+                    if (stamp[v] != iterations) {
+                        stamp[v] = iterations;
+                        frontier.push_back(v);
+                    }
+                });
+            }
+            data.changed.clear();
+        }
+        ++iterations;
+    }
+    converged = frontier.empty();
+
+    G.parallelForNodes([&](node u) { scoreData[u] = static_cast<double>(h[u]); });
+}
+
+Partition ParallelCoreDecomposition::getPartition() const {
+    assureFinished();
+    const count z = G.upperNodeIdBound();
+    Partition shells(z);
+
+    if (!weighted) {
+        shells.setUpperBound(static_cast<index>(maxCore) + 1);
+        G.parallelForNodes(
+            [&](node u) { shells.addToSubset(static_cast<index>(scoreData[u]), u); });
+        return shells;
+    }
+
+    std::vector<double> levels;
+    G.forNodes([&](node u) { levels.push_back(scoreData[u]); });
+    Aux::Parallel::sort(levels.begin(), levels.end());
+    levels.erase(std::unique(levels.begin(), levels.end()), levels.end());
+    shells.setUpperBound(levels.size());
+    G.parallelForNodes([&](node u) {
+        const auto it = std::lower_bound(levels.begin(), levels.end(), scoreData[u]);
+        shells.addToSubset(static_cast<index>(it - levels.begin()), u);
+    });
+    return shells;
+}
+
+ParallelCoreDecomposition::CoreHierarchy ParallelCoreDecomposition::getCoreHierarchy() const {
+    assureFinished();
+    const count z = G.upperNodeIdBound();
+
+    std::vector<node> order;
+    order.reserve(G.numberOfNodes());
+    G.forNodes([&](node u) { order.push_back(u); });
+    Aux::Parallel::sort(order.begin(), order.end(), [&](node u, node v) {
+        return scoreData[u] > scoreData[v] || (scoreData[u] == scoreData[v] && u < v);
+    });
+
+    CoreHierarchy hierarchy;
+    hierarchy.shells = Partition(z);
+    hierarchy.shells.setUpperBound(G.numberOfNodes());
+    std::vector<node> representative;
+
+    // Add the nodes by decreasing core number; after all nodes of level c are added, the sets of
+    // the union-find structure are the connected components of the c-core.
+    UnionFind uf(z);
+    std::vector<uint8_t> added(z, 0);
+    std::vector<index> top(z, none);      // component of a union-find root
+    std::vector<index> topLevel(z, none); // level group in which top[root] was set
+    std::vector<index> children;
+
+    index group = 0;
+    for (index begin = 0; begin < order.size(); ++group) {
+        const double level = scoreData[order[begin]];
+        index end = begin;
+        while (end < order.size() && scoreData[order[end]] == level)
+            added[order[end++]] = 1;
+
+        // components of higher cores that are merged into a component of this level
+        children.clear();
+        for (index i = begin; i < end; ++i) {
+            forIncidentEdges(G, order[i], [&](node v, edgeweight) {
+                if (added[v] && scoreData[v] > level)
+                    children.push_back(top[uf.find(v)]);
+            });
+        }
+        for (index i = begin; i < end; ++i) {
+            forIncidentEdges(G, order[i], [&](node v, edgeweight) {
+                if (added[v])
+                    uf.merge(order[i], v);
+            });
+        }
+
+        for (index i = begin; i < end; ++i) {
+            const node u = order[i];
+            const index root = uf.find(u);
+            if (topLevel[root] != group) {
+                topLevel[root] = group;
+                top[root] = hierarchy.level.size();
+                hierarchy.level.push_back(level);
+                hierarchy.parent.push_back(none);
+                representative.push_back(u);
+            }
+            hierarchy.shells.addToSubset(top[root], u);
+        }
+        for (const index child : children)
+            hierarchy.parent[child] = top[uf.find(representative[child])];
+
+        begin = end;
+    }
+
+    hierarchy.shells.setUpperBound(hierarchy.level.size());
+    return hierarchy;
+}
+
+double ParallelCoreDecomposition::maximum() {
+    double maxDegree = 0;
+    G.forNodes([&](node u) {
+        double degree = 0;
+        forIncidentEdges(G, u, [&](node, edgeweight w) { degree += weighted ? w : 1.0; });
+        maxDegree = std::max(maxDegree, degree);
+    });
+    return maxDegree;
+}
+
+} /* namespace NetworKit */
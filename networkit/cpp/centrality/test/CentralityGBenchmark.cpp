@@ -0,0 +1,53 @@
+/*
+ * CentralityGBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <networkit/centrality/Betweenness.hpp>
+#include <networkit/centrality/PageRank.hpp>
+
+#include "../../BenchmarkGraphs.hpp"
+
+namespace NetworKit {
+
+namespace {
+
+using BenchmarkGraphs::erdosRenyi;
+
+void BM_PageRank(benchmark::State &state) {
+    const Graph &G = erdosRenyi(state.range(0));
+    for (auto _ : state) {
+        PageRank pr(G, 0.85, 1e-8);
+        pr.run();
+        benchmark::DoNotOptimize(pr.scores().data());
+        state.counters["iterations"] = static_cast<double>(pr.numberOfIterations());
+    }
+    state.SetItemsProcessed(state.iterations() * G.numberOfEdges());
+}
+
+void BM_Betweenness(benchmark::State &state) {
+    const Graph &G = erdosRenyi(state.range(0));
+    for (auto _ : state) {
+        Betweenness bc(G);
+        bc.run();
+        benchmark::DoNotOptimize(bc.scores().data());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_PageRank)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 18)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_Betweenness)
+    ->RangeMultiplier(4)
+    ->Range(1 << 9, 1 << 13)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace NetworKit
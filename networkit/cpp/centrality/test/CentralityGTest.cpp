@@ -23,6 +23,7 @@
 #include <networkit/centrality/CoreDecomposition.hpp>
 #include <networkit/centrality/DegreeCentrality.hpp>
 #include <networkit/centrality/DynApproxBetweenness.hpp>
+#include <networkit/centrality/DynCoreDecomposition.hpp>
 #include <networkit/centrality/DynKatzCentrality.hpp>
 #include <networkit/centrality/DynTopHarmonicCloseness.hpp>
 #include <networkit/centrality/EigenvectorCentrality.hpp>
@@ -43,6 +44,7 @@
 #include <networkit/centrality/LocalClusteringCoefficient.hpp>
 #include <networkit/centrality/LocalSquareClusteringCoefficient.hpp>
 #include <networkit/centrality/PageRank.hpp>
+#include <networkit/centrality/ParallelCoreDecomposition.hpp>
 #include <networkit/centrality/PermanenceCentrality.hpp>
 #include <networkit/centrality/SpanningEdgeCentrality.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
@@ -560,6 +562,57 @@ TEST_P(CentralityGTest, testNormalizedPageRank) {
     doTest(PageRank::Norm::L2_NORM);
 }
 
+TEST_P(CentralityGTest, testPageRankSinglePrecision) {
+    SNAPGraphReader reader(isDirected());
+    auto G = reader.read("input/wiki-Vote.txt");
+
+    for (const auto sinkHandling :
+         {PageRank::SinkHandling::NO_SINK_HANDLING, PageRank::SinkHandling::DISTRIBUTE_SINKS}) {
+        PageRank pr(G, 0.85, 1e-8, false, sinkHandling);
+        pr.run();
+
+        PageRank prSingle(G, 0.85, 1e-8, false, sinkHandling);
+        prSingle.precision = SpMVPrecision::SINGLE;
+        prSingle.run();
+
+        G.forNodes([&](node u) { EXPECT_NEAR(pr.score(u), prSingle.score(u), 1e-6); });
+        EXPECT_EQ(pr.ranking()[0].first, prSingle.ranking()[0].first);
+    }
+}
+
+TEST_P(CentralityGTest, testKatzAndEigenvectorSinglePrecision) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(500, 0.02, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::real(0.5, 2)); });
+    }
+
+    for (const auto direction : {EdgeDirection::IN_EDGES, EdgeDirection::OUT_EDGES}) {
+        KatzCentrality kc(G);
+        kc.edgeDirection = direction;
+        kc.run();
+
+        KatzCentrality kcSingle(G);
+        kcSingle.edgeDirection = direction;
+        kcSingle.precision = SpMVPrecision::SINGLE;
+        kcSingle.run();
+
+        G.forNodes([&](node u) { EXPECT_NEAR(kc.score(u), kcSingle.score(u), 1e-5); });
+    }
+
+    if (!isDirected()) {
+        EigenvectorCentrality ec(G);
+        ec.run();
+
+        EigenvectorCentrality ecSingle(G);
+        ecSingle.precision = SpMVPrecision::SINGLE;
+        ecSingle.run();
+
+        G.forNodes([&](node u) { EXPECT_NEAR(ec.score(u), ecSingle.score(u), 1e-4); });
+    }
+}
+
 TEST_F(CentralityGTest, testEigenvectorCentrality) {
     /* Graph:
      0    3   6
@@ -805,6 +858,93 @@ TEST_F(CentralityGTest, testEdgeBetweennessCentrality) {
     EXPECT_NEAR(6.0, bc[5], tol);
 }
 
+TEST_F(CentralityGTest, testBetweennessBatches) {
+    // the bit-parallel batches have to agree with one BFS per source
+    auto compare = [](const Graph &G, count batchSize) {
+        Betweenness reference(G, true, true);
+        reference.setBatchSize(0);
+        reference.run();
+        Betweenness batched(G, true, true);
+        batched.setBatchSize(batchSize);
+        batched.run();
+
+        G.forNodes([&](node u) {
+            EXPECT_NEAR(batched.score(u), reference.score(u), 1e-9 * (1 + reference.score(u)));
+        });
+        const auto &edgeScores = batched.edgeScores(), &expected = reference.edgeScores();
+        ASSERT_EQ(edgeScores.size(), expected.size());
+        for (index e = 0; e < edgeScores.size(); ++e)
+            EXPECT_NEAR(edgeScores[e], expected[e], 1e-9 * (1 + expected[e]));
+    };
+
+    Aux::Random::setSeed(42, false);
+    for (const bool directed : {false, true}) {
+        Graph G = ErdosRenyiGenerator(200, 0.02, directed).generate();
+        G.removeNode(5);
+        G.addEdge(3, 3);
+        G.indexEdges();
+        for (const count batchSize : {count{1}, count{7}, Betweenness::maxBatchSize})
+            compare(G, batchSize);
+    }
+
+    // a chain of 1100 diamonds has 2^1100 shortest paths between its ends, which exceeds the
+    // range of double
+    Graph chain(1);
+    for (node u = 0; u < 1100; ++u) {
+        const node a = chain.addNode(), b = chain.addNode(), c = chain.addNode();
+        chain.addEdge(3 * u, a);
+        chain.addEdge(3 * u, b);
+        chain.addEdge(a, c);
+        chain.addEdge(b, c);
+    }
+    chain.indexEdges();
+    compare(chain, Betweenness::maxBatchSize);
+
+    Betweenness bc(chain);
+    EXPECT_THROW(bc.setBatchSize(Betweenness::maxBatchSize + 1), std::runtime_error);
+}
+
+TEST_F(CentralityGTest, testBetweennessMemoryBudget) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.02).generate();
+    G.indexEdges();
+    Betweenness reference(G, true, true);
+    reference.setBatchSize(Betweenness::maxBatchSize);
+    reference.run();
+
+    auto runAndCompare = [&](Betweenness &bc) {
+        bc.run();
+        G.forNodes([&](node u) {
+            EXPECT_NEAR(bc.score(u), reference.score(u), 1e-9 * (1 + reference.score(u)));
+        });
+        const auto &edgeScores = bc.edgeScores(), &expected = reference.edgeScores();
+        for (index e = 0; e < edgeScores.size(); ++e)
+            EXPECT_NEAR(edgeScores[e], expected[e], 1e-9 * (1 + expected[e]));
+    };
+
+    // the default batch size is limited by the budget; a budget below a single thread's buffers
+    // still runs one BFS per source
+    const std::vector<std::pair<count, count>> budgets{
+        {1, 1}, {300 * (24 + 40 * 5), 5}, {Betweenness::defaultMemoryBudget, 64}};
+    for (const auto &[budget, expectedBatchSize] : budgets) {
+        Betweenness batched(G, true, true);
+        batched.setMemoryBudget(budget);
+        EXPECT_EQ(batched.getBatchSize(), expectedBatchSize);
+        runAndCompare(batched);
+
+        // none returns to the batch size of the budget
+        batched.setBatchSize(3);
+        EXPECT_EQ(batched.getBatchSize(), 3);
+        batched.setBatchSize(none);
+        EXPECT_EQ(batched.getBatchSize(), expectedBatchSize);
+
+        Betweenness perThread(G, true, true);
+        perThread.setMemoryBudget(budget);
+        perThread.setBatchSize(0);
+        runAndCompare(perThread);
+    }
+}
+
 TEST_F(CentralityGTest, debugEdgeBetweennessCentrality) {
     auto path = "input/PGPgiantcompo.graph";
     METISGraphReader reader;
@@ -1107,6 +1247,230 @@ TEST_F(CentralityGTest, testCoreDecompositionDirected) {
     EXPECT_EQ(2u, coreness[15]) << "expected coreness";
 }
 
+TEST_P(CentralityGTest, testParallelCoreDecomposition) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(2000, 0.01, isDirected()).generate();
+    // add a dense part and some self-loops, which are ignored
+    for (node u = 0; u < 50; ++u)
+        for (node v = u + 1; v < 50; ++v)
+            if (!G.hasEdge(u, v))
+                G.addEdge(u, v);
+    Graph withSelfLoops = G;
+    for (node u = 0; u < 2000; u += 10)
+        withSelfLoops.addEdge(u, u);
+
+    CoreDecomposition reference(G, false, isDirected());
+    reference.run();
+
+    for (const auto mode : {ParallelCoreDecomposition::Mode::PEELING,
+                            ParallelCoreDecomposition::Mode::H_INDEX}) {
+        ParallelCoreDecomposition cores(withSelfLoops);
+        cores.setMode(mode);
+        cores.run();
+        EXPECT_TRUE(cores.hasConverged());
+        EXPECT_EQ(cores.maxCoreNumber(), static_cast<double>(reference.maxCoreNumber()));
+        G.forNodes([&](node u) { EXPECT_EQ(cores.score(u), reference.score(u)); });
+
+        const auto shells = cores.getPartition();
+        G.forNodes([&](node u) { EXPECT_EQ(shells[u], static_cast<index>(reference.score(u))); });
+    }
+
+    // bounded h-index iterations yield upper bounds
+    ParallelCoreDecomposition bounds(G);
+    bounds.setMode(ParallelCoreDecomposition::Mode::H_INDEX);
+    bounds.maxIterations = 1;
+    bounds.run();
+    EXPECT_EQ(bounds.numberOfIterations(), 1u);
+    G.forNodes([&](node u) { EXPECT_GE(bounds.score(u), reference.score(u)); });
+}
+
+TEST_P(CentralityGTest, testParallelCoreDecompositionWeighted) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(500, 0.03, isDirected()).generate();
+    G = GraphTools::toWeighted(G);
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 4) * 0.5); });
+
+    // reference: sequential removal of a node of minimum strength
+    std::vector<double> strength(G.upperNodeIdBound(), 0), expected(G.upperNodeIdBound(), 0);
+    std::vector<bool> removed(G.upperNodeIdBound(), false);
+    auto forIncident = [&](node u, auto handle) {
+        G.forNeighborsOf(u, [&](node, node v, edgeweight w) { handle(v, w); });
+        if (G.isDirected())
+            G.forInEdgesOf(u, [&](node, node v, edgeweight w) { handle(v, w); });
+    };
+    G.forNodes([&](node u) { forIncident(u, [&](node, edgeweight w) { strength[u] += w; }); });
+    double level = 0;
+    for (count i = 0; i < G.numberOfNodes(); ++i) {
+        node minNode = none;
+        G.forNodes([&](node u) {
+            if (!removed[u] && (minNode == none || strength[u] < strength[minNode]))
+                minNode = u;
+        });
+        level = std::max(level, strength[minNode]);
+        expected[minNode] = level;
+        removed[minNode] = true;
+        forIncident(minNode, [&](node v, edgeweight w) { strength[v] -= w; });
+    }
+
+    for (const auto mode : {ParallelCoreDecomposition::Mode::PEELING,
+                            ParallelCoreDecomposition::Mode::H_INDEX}) {
+        ParallelCoreDecomposition cores(G, true);
+        cores.setMode(mode);
+        cores.run();
+        G.forNodes([&](node u) { EXPECT_NEAR(cores.score(u), expected[u], 1e-9); });
+    }
+
+    // without weights, the unweighted cores are computed
+    ParallelCoreDecomposition unweighted(G, false);
+    unweighted.run();
+    CoreDecomposition reference(G, false, isDirected());
+    reference.run();
+    G.forNodes([&](node u) { EXPECT_EQ(unweighted.score(u), reference.score(u)); });
+}
+
+TEST_F(CentralityGTest, testParallelCoreDecompositionHierarchy) {
+    // two 4-cliques {0, ..., 3} and {5, ..., 8} connected by the path 3 - 4 - 5, and the
+    // separate edge 9 - 10
+    Graph G(11);
+    for (node offset : {0, 5})
+        for (node u = 0; u < 4; ++u)
+            for (node v = u + 1; v < 4; ++v)
+                G.addEdge(offset + u, offset + v);
+    G.addEdge(3, 4);
+    G.addEdge(4, 5);
+    G.addEdge(9, 10);
+
+    ParallelCoreDecomposition cores(G);
+    cores.run();
+    const auto hierarchy = cores.getCoreHierarchy();
+
+    // one component per clique at level 3, the path joins them at level 2
+    ASSERT_EQ(hierarchy.level.size(), 4u);
+    const index left = hierarchy.shells[0], right = hierarchy.shells[5];
+    const index bridge = hierarchy.shells[4], separate = hierarchy.shells[9];
+    EXPECT_NE(left, right);
+    EXPECT_EQ(hierarchy.level[left], 3);
+    EXPECT_EQ(hierarchy.level[right], 3);
+    EXPECT_EQ(hierarchy.level[bridge], 2);
+    EXPECT_EQ(hierarchy.level[separate], 1);
+    EXPECT_EQ(hierarchy.parent[left], bridge);
+    EXPECT_EQ(hierarchy.parent[right], bridge);
+    EXPECT_EQ(hierarchy.parent[bridge], none);
+    EXPECT_EQ(hierarchy.parent[separate], none);
+    for (node u = 0; u < 4; ++u) {
+        EXPECT_EQ(hierarchy.shells[u], left);
+        EXPECT_EQ(hierarchy.shells[u + 5], right);
+    }
+    EXPECT_EQ(hierarchy.shells[10], separate);
+}
+
+TEST_P(CentralityGTest, testDynCoreDecomposition) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.03, isDirected()).generate();
+    for (node u = 0; u < 20; ++u)
+        for (node v = u + 1; v < 20; ++v)
+            if (!G.hasEdge(u, v))
+                G.addEdge(u, v);
+
+    DynCoreDecomposition dyn(G);
+    dyn.run();
+
+    auto expectExact = [&] {
+        ParallelCoreDecomposition reference(G);
+        reference.run();
+        G.forNodes([&](node u) { ASSERT_EQ(dyn.score(u), reference.score(u)); });
+        EXPECT_EQ(static_cast<double>(dyn.maxCoreNumber()), reference.maxCoreNumber());
+    };
+    expectExact();
+
+    auto randomEdge = [&]() -> std::pair<node, node> {
+        return {GraphTools::randomNode(G), GraphTools::randomNode(G)};
+    };
+
+    // single updates
+    for (index i = 0; i < 200; ++i) {
+        if (Aux::Random::real() < 0.5) {
+            const auto [u, v] = randomEdge();
+            if (G.hasEdge(u, v))
+                continue;
+            G.addEdge(u, v);
+            dyn.update(GraphEvent(GraphEvent::EDGE_ADDITION, u, v));
+        } else {
+            const auto [u, v] = GraphTools::randomEdge(G);
+            G.removeEdge(u, v);
+            dyn.update(GraphEvent(GraphEvent::EDGE_REMOVAL, u, v));
+        }
+        expectExact();
+    }
+
+    // mixed batches, including new nodes and self-loops
+    for (index i = 0; i < 20; ++i) {
+        std::vector<GraphEvent> batch;
+        const node x = G.addNode();
+        batch.emplace_back(GraphEvent::NODE_ADDITION, x);
+        for (index j = 0; j < 30; ++j) {
+            const double r = Aux::Random::real();
+            if (r < 0.1) {
+                const node u = GraphTools::randomNode(G);
+                if (G.hasEdge(u, x))
+                    continue;
+                G.addEdge(u, x);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, u, x);
+            } else if (r < 0.6) {
+                const auto [u, v] = randomEdge();
+                if (G.hasEdge(u, v))
+                    continue;
+                G.addEdge(u, v);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+            } else {
+                const auto [u, v] = GraphTools::randomEdge(G);
+                G.removeEdge(u, v);
+                batch.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
+            }
+        }
+        dyn.updateBatch(batch);
+        expectExact();
+    }
+
+    // a node removal without the removal events of its edges triggers a recomputation
+    const node u = GraphTools::randomNode(G);
+    G.removeNode(u);
+    dyn.update(GraphEvent(GraphEvent::NODE_REMOVAL, u));
+    EXPECT_EQ(dyn.score(u), 0);
+    expectExact();
+}
+
+TEST_F(CentralityGTest, testDynCoreDecompositionLocality) {
+    // a clique with a path of 10 nodes attached to each clique node: closing a cycle within a
+    // path only visits the nodes of this path
+    Graph G(1100);
+    for (node u = 0; u < 100; ++u) {
+        for (node v = u + 1; v < 100; ++v)
+            G.addEdge(u, v);
+        const node first = 100 + 10 * u;
+        G.addEdge(u, first);
+        for (node v = first; v + 1 < first + 10; ++v)
+            G.addEdge(v, v + 1);
+    }
+
+    DynCoreDecomposition dyn(G);
+    dyn.run();
+    EXPECT_EQ(dyn.coreNumber(500), 1);
+
+    G.addEdge(502, 508);
+    dyn.update(GraphEvent(GraphEvent::EDGE_ADDITION, 502, 508));
+    for (node u = 500; u < 510; ++u)
+        EXPECT_EQ(dyn.coreNumber(u), u <= 508 ? 2 : 1);
+    EXPECT_LE(dyn.numberOfVisitedNodes(), 10);
+
+    G.removeEdge(505, 506);
+    dyn.update(GraphEvent(GraphEvent::EDGE_REMOVAL, 505, 506));
+    for (node u = 500; u < 510; ++u)
+        EXPECT_EQ(dyn.coreNumber(u), 1);
+    EXPECT_LE(dyn.numberOfVisitedNodes(), 10);
+    EXPECT_EQ(dyn.maxCoreNumber(), 99);
+}
+
 TEST_F(CentralityGTest, testLocalClusteringCoefficientUndirected) {
     count n = 16;
     Graph G(n, false, false);
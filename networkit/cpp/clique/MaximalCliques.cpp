@@ -1,7 +1,12 @@
 #include <algorithm>
+#include <atomic>
 #include <cassert>
-
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <utility>
+#include <omp.h>
+
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/CoreDecomposition.hpp>
 #include <networkit/clique/MaximalCliques.hpp>
@@ -11,43 +16,56 @@ namespace {
 using NetworKit::count;
 using NetworKit::index;
 using NetworKit::node;
+using NetworKit::omp_index;
 
-class MaximalCliquesImpl {
-private:
-    const NetworKit::Graph *G;
-    std::vector<std::vector<node>> *result;
-    std::function<void(const std::vector<node> &)> &callback;
-    bool maximumOnly;
-    count maxFound;
+// Subproblems with at most this many candidate and excluded nodes are solved on bit sets.
+constexpr count maxDenseSize = 4096;
 
-    std::vector<node> pxvector;
-    std::vector<node> pxlookup;
+// Subproblems with at least this many candidates are split into one task per branch.
+constexpr count minSplitCandidates = 32;
 
-    std::vector<index> firstOut;
-    std::vector<node> head;
+// Number of clique nodes a thread buffers before handing its cliques to a serialized callback.
+constexpr count callbackBufferSize = 1 << 14;
 
+/**
+ * Out-going edges in the direction of higher core numbers, i.e., the out-degree is bounded by
+ * the maximum core number. Built once and shared by all threads.
+ */
+class OutGraph {
 public:
-    MaximalCliquesImpl(const NetworKit::Graph &G, std::vector<std::vector<node>> &result,
-                       std::function<void(const std::vector<node> &)> &callback, bool maximumOnly)
-        : G(&G), result(&result), callback(callback), maximumOnly(maximumOnly), maxFound(0),
-          pxvector(G.numberOfNodes()), pxlookup(G.upperNodeIdBound()),
-          firstOut(G.upperNodeIdBound() + 1), head(G.numberOfEdges()) {}
+    std::vector<node> orderedNodes;
+    std::vector<index> position;
+
+    OutGraph(const NetworKit::Graph &G, const std::vector<node> &orderedNodes)
+        : orderedNodes(orderedNodes), position(G.upperNodeIdBound()),
+          firstOut(G.upperNodeIdBound() + 1) {
+        const count z = G.upperNodeIdBound();
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(orderedNodes.size()); ++i)
+            position[orderedNodes[i]] = i;
+
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            count outDeg = 0;
+            if (G.hasNode(u))
+                G.forEdgesOf(u, [&](node v) { outDeg += position[u] < position[v]; });
+            firstOut[u + 1] = outDeg;
+        }
+        for (node u = 0; u < z; ++u)
+            firstOut[u + 1] += firstOut[u];
 
-private:
-    void buildOutGraph() {
-        index currentOut = 0;
-        for (node u = 0; u < G->upperNodeIdBound(); ++u) {
-            firstOut[u] = currentOut;
-            if (G->hasNode(u)) {
-                index xpboundU = pxlookup[u];
-                G->forEdgesOf(u, [&](node v) {
-                    if (xpboundU < pxlookup[v]) {
-                        head[currentOut++] = v;
-                    }
-                });
-            }
+        head.resize(firstOut[z]);
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            if (!G.hasNode(u))
+                continue;
+            index currentOut = firstOut[u];
+            G.forEdgesOf(u, [&](node v) {
+                if (position[u] < position[v])
+                    head[currentOut++] = v;
+            });
         }
-        firstOut[G->upperNodeIdBound()] = currentOut;
     }
 
     template <typename F>
@@ -68,6 +86,325 @@ private:
 
     count outDegree(node u) const { return firstOut[u + 1] - firstOut[u]; }
 
+private:
+    std::vector<index> firstOut;
+    std::vector<node> head;
+};
+
+/**
+ * Collects the cliques reported by all threads. Stored cliques and the maximum clique are kept
+ * per thread and merged in finish(). A callback is either called directly (if it is thread-safe)
+ * or the cliques are buffered per thread and handed to the callback under a lock.
+ */
+class CliqueOutput {
+public:
+    CliqueOutput(std::vector<std::vector<node>> &result,
+                 const std::function<void(const std::vector<node> &)> &callback,
+                 bool maximumOnly, bool concurrentCallback)
+        : result(&result), callback(callback), maximumOnly(maximumOnly),
+          concurrentCallback(concurrentCallback), buffers(omp_get_max_threads()) {}
+
+    void report(const std::vector<node> &clique) {
+        if (callback && concurrentCallback) {
+            callback(clique);
+            return;
+        }
+
+        auto &buffer = buffers[omp_get_thread_num()];
+        if (maximumOnly) {
+            count current = maxFound.load(std::memory_order_relaxed);
+            if (clique.size() <= current)
+                return;
+            buffer.cliques.assign(1, clique);
+            while (current < clique.size()
+                   && !maxFound.compare_exchange_weak(current, clique.size(),
+                                                      std::memory_order_relaxed)) {
+            }
+            return;
+        }
+
+        buffer.cliques.push_back(clique);
+        buffer.bufferedNodes += clique.size();
+        if (callback && buffer.bufferedNodes >= callbackBufferSize)
+            flush(buffer);
+    }
+
+    // Size of the largest clique found so far by any thread (only tracked if maximumOnly is set).
+    count maximumSize() const { return maxFound.load(std::memory_order_relaxed); }
+
+    void finish() {
+        if (maximumOnly) {
+            for (auto &buffer : buffers)
+                if (!buffer.cliques.empty()
+                    && (result->empty() || buffer.cliques[0].size() > (*result)[0].size()))
+                    *result = std::move(buffer.cliques);
+        } else if (callback) {
+            for (auto &buffer : buffers)
+                flush(buffer);
+        } else {
+            count total = 0;
+            for (const auto &buffer : buffers)
+                total += buffer.cliques.size();
+            result->reserve(total);
+            for (auto &buffer : buffers)
+                std::move(buffer.cliques.begin(), buffer.cliques.end(),
+                          std::back_inserter(*result));
+        }
+        buffers.clear();
+    }
+
+private:
+    struct alignas(64) ThreadBuffer {
+        std::vector<std::vector<node>> cliques;
+        count bufferedNodes = 0;
+    };
+
+    void flush(ThreadBuffer &buffer) {
+        {
+            std::lock_guard<std::mutex> lock(callbackMutex);
+            for (const auto &clique : buffer.cliques)
+                callback(clique);
+        }
+        buffer.cliques.clear();
+        buffer.bufferedNodes = 0;
+    }
+
+    std::vector<std::vector<node>> *result;
+    const std::function<void(const std::vector<node> &)> &callback;
+    bool maximumOnly, concurrentCallback;
+
+    std::vector<ThreadBuffer> buffers;
+    std::mutex callbackMutex;
+    std::atomic<count> maxFound{0};
+};
+
+/**
+ * The first exception thrown by any thread or task; all remaining work is skipped once it is set.
+ */
+class SearchFailure {
+public:
+    void capture() {
+#pragma omp critical(MaximalCliquesFailure)
+        if (!error)
+            error = std::current_exception();
+        failed.store(true, std::memory_order_relaxed);
+    }
+
+    bool hasFailed() const { return failed.load(std::memory_order_relaxed); }
+
+    void rethrow() const {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+private:
+    std::exception_ptr error;
+    std::atomic<bool> failed{false};
+};
+
+/**
+ * The subproblem of a node u as a dense bit matrix: the candidates P are the out-neighbors of u,
+ * the excluded nodes X are the neighbors of u before u in the degeneracy order that have at least
+ * one neighbor in P (the others cannot prevent any clique containing u from being maximal).
+ * Local ids [0, numCandidates) are the nodes in P, the remaining ones the nodes in X.
+ */
+struct DenseSubproblem {
+    std::vector<node> nodes;
+    count numCandidates = 0;
+    count words = 0;
+    std::vector<uint64_t> adjacency;
+
+    const uint64_t *row(index i) const { return adjacency.data() + i * words; }
+    uint64_t *row(index i) { return adjacency.data() + i * words; }
+};
+
+/**
+ * Tomita-style pivoting on the bit matrix of a DenseSubproblem. The pivot is the node of P and X
+ * with the most neighbors in P, determined with word-wise intersections and popcounts.
+ */
+class DenseSearch {
+public:
+    DenseSearch(std::shared_ptr<const DenseSubproblem> subproblem, CliqueOutput &output,
+                SearchFailure &failure, bool maximumOnly)
+        : subproblem(std::move(subproblem)), output(&output), failure(&failure),
+          maximumOnly(maximumOnly), words(this->subproblem->words) {}
+
+    /**
+     * Lists all maximal cliques that extend @a r by nodes of @a p and no node of @a x. If
+     * @a split is set, each branch of the first level becomes an OpenMP task that is executed
+     * by any idle thread.
+     */
+    void run(std::vector<node> r, std::vector<uint64_t> p, std::vector<uint64_t> x, bool split) {
+        if (levels.empty())
+            levels.resize(1);
+        levels[0].resize(3 * words);
+        std::copy(p.begin(), p.end(), levels[0].begin());
+        std::copy(x.begin(), x.end(), levels[0].begin() + words);
+        this->r = std::move(r);
+        expand(0, split);
+    }
+
+private:
+    static count popcount(uint64_t word) { return static_cast<count>(__builtin_popcountll(word)); }
+
+    void expand(index depth, bool split) {
+        uint64_t *p = levels[depth].data();
+        uint64_t *x = p + words;
+        uint64_t *candidates = x + words;
+
+        count pSize = 0;
+        bool xEmpty = true;
+        for (index w = 0; w < words; ++w) {
+            pSize += popcount(p[w]);
+            xEmpty = xEmpty && !x[w];
+        }
+
+        if (pSize == 0) {
+            if (xEmpty)
+                output->report(r);
+            return;
+        }
+
+        // r.size() + |P| is an upper bound for the size of any clique found in this branch.
+        if (maximumOnly && r.size() + pSize <= output->maximumSize())
+            return;
+
+        if (depth == 0) {
+            Aux::SignalHandler handler;
+            handler.assureRunning();
+        }
+
+        const index pivot = findPivot(p, x, pSize);
+        const uint64_t *pivotRow = subproblem->row(pivot);
+        for (index w = 0; w < words; ++w)
+            candidates[w] = p[w] & ~pivotRow[w];
+
+        // Deeper levels may reallocate levels, but not the buffers of the individual levels.
+        if (levels.size() <= depth + 1)
+            levels.resize(depth + 2);
+        levels[depth + 1].resize(3 * words);
+        uint64_t *next = levels[depth + 1].data();
+
+        for (index w = 0; w < words; ++w) {
+            while (candidates[w]) {
+                const index v = w * 64 + static_cast<index>(__builtin_ctzll(candidates[w]));
+                candidates[w] &= candidates[w] - 1;
+
+                const uint64_t *vRow = subproblem->row(v);
+                for (index i = 0; i < words; ++i) {
+                    next[i] = p[i] & vRow[i];
+                    next[words + i] = x[i] & vRow[i];
+                }
+
+                r.push_back(subproblem->nodes[v]);
+                if (split) {
+                    spawn(next);
+                } else {
+                    expand(depth + 1, false);
+                }
+                r.pop_back();
+
+                // move v from P to X
+                p[w] &= ~(uint64_t{1} << (v % 64));
+                x[w] |= uint64_t{1} << (v % 64);
+            }
+        }
+    }
+
+    void spawn(const uint64_t *next) {
+        std::vector<node> taskR = r;
+        std::vector<uint64_t> taskP(next, next + words);
+        std::vector<uint64_t> taskX(next + words, next + 2 * words);
+        auto taskSubproblem = subproblem;
+        CliqueOutput *taskOutput = output;
+        SearchFailure *taskFailure = failure;
+        const bool taskMaximumOnly = maximumOnly;
+
+#pragma omp task firstprivate(taskR, taskP, taskX, taskSubproblem, taskOutput, taskFailure,       \
+                              taskMaximumOnly)
+        {
+            try {
+                if (!taskFailure->hasFailed())
+                    DenseSearch(taskSubproblem, *taskOutput, *taskFailure, taskMaximumOnly)
+                        .run(std::move(taskR), std::move(taskP), std::move(taskX), false);
+            } catch (...) {
+                taskFailure->capture();
+            }
+        }
+    }
+
+    index findPivot(const uint64_t *p, const uint64_t *x, count pSize) const {
+        index maxNode = none;
+        count maxVal = 0;
+        auto consider = [&](const uint64_t *set) -> bool {
+            for (index w = 0; w < words; ++w) {
+                for (uint64_t bits = set[w]; bits; bits &= bits - 1) {
+                    const index u = w * 64 + static_cast<index>(__builtin_ctzll(bits));
+                    const uint64_t *uRow = subproblem->row(u);
+                    count val = 0;
+                    for (index i = 0; i < words; ++i)
+                        val += popcount(p[i] & uRow[i]);
+                    if (maxNode == none || val > maxVal) {
+                        maxNode = u;
+                        maxVal = val;
+                        // If a node has |P| neighbors, we cannot find a better candidate
+                        if (val == pSize)
+                            return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        if (!consider(x))
+            consider(p);
+        return maxNode;
+    }
+
+    static constexpr index none = NetworKit::none;
+
+    std::shared_ptr<const DenseSubproblem> subproblem;
+    CliqueOutput *output;
+    SearchFailure *failure;
+    bool maximumOnly;
+    count words;
+
+    std::vector<node> r;
+    // P, X and the remaining candidates of each recursion level.
+    std::vector<std::vector<uint64_t>> levels;
+};
+
+/**
+ * Per-thread state of the search. The position vector pxvector is a permutation of the nodes
+ * that is initially the degeneracy order; while the subproblem of u is processed, X and P are
+ * arranged around the position of u. As threads take the nodes of the outer loop in an arbitrary
+ * order, each thread lazily moves the nodes it skipped back to their initial position before it
+ * processes the next node.
+ */
+class MaximalCliquesImpl {
+private:
+    const NetworKit::Graph *G;
+    const OutGraph *out;
+    CliqueOutput *output;
+    SearchFailure *failure;
+    bool maximumOnly;
+
+    // The positions < restoredBound in pxvector hold exactly the nodes that are before
+    // restoredBound in the degeneracy order (in arbitrary order). Allocated on first use.
+    index restoredBound;
+    std::vector<node> pxvector;
+    std::vector<node> pxlookup;
+
+    // Local ids of the nodes of the current dense subproblem, none for all other nodes.
+    std::vector<index> localId;
+
+public:
+    MaximalCliquesImpl(const NetworKit::Graph &G, const OutGraph &out, CliqueOutput &output,
+                       SearchFailure &failure, bool maximumOnly)
+        : G(&G), out(&out), output(&output), failure(&failure), maximumOnly(maximumOnly),
+          restoredBound(out.orderedNodes.size()) {}
+
+private:
     void swapNodeToPos(node u, index pos) {
         assert(pos < pxvector.size());
         node pxvec2 = pxvector[pos];
@@ -76,118 +413,180 @@ private:
         pxlookup[u] = pos;
     }
 
-public:
-    void run() {
-        NetworKit::CoreDecomposition cores(*G, false, false, true);
-        cores.run();
+    // Establishes the invariant of restoredBound for iu + 1 by moving the nodes between iu and
+    // the previously processed node of this thread to their positions in the degeneracy order.
+    void restoreOrderAbove(index iu) {
+        const auto &orderedNodes = out->orderedNodes;
+        if (pxvector.empty()) {
+            pxvector = orderedNodes;
+            pxlookup = out->position;
+            restoredBound = iu + 1;
+            return;
+        }
 
-        Aux::SignalHandler handler;
-        handler.assureRunning();
+        while (restoredBound > iu + 1) {
+            --restoredBound;
+            swapNodeToPos(orderedNodes[restoredBound], restoredBound);
+        }
+    }
 
-        const auto &orderedNodes = cores.getNodeOrder();
+    std::shared_ptr<DenseSubproblem> buildDenseSubproblem(node u) {
+        if (localId.empty())
+            localId.resize(G->upperNodeIdBound(), NetworKit::none);
 
-        index ii = 0;
-        for (const node u : orderedNodes) {
-            pxvector[ii] = u;
-            pxlookup[u] = ii;
-            ii += 1;
+        auto subproblem = std::make_shared<DenseSubproblem>();
+        auto &nodes = subproblem->nodes;
+        out->forOutEdgesOf(u, [&](node v) {
+            if (localId[v] == NetworKit::none) {
+                localId[v] = nodes.size();
+                nodes.push_back(v);
+            }
+        });
+        subproblem->numCandidates = nodes.size();
+
+        // A neighbor x before u and a node of P are adjacent iff the latter is an out-neighbor
+        // of x, as both are after x in the degeneracy order.
+        const index upos = out->position[u];
+        G->forNeighborsOf(u, [&](node x) {
+            if (out->position[x] >= upos || localId[x] != NetworKit::none)
+                return;
+            bool hasCandidateNeighbor = false;
+            out->forOutEdgesOf(x, [&](node v) {
+                hasCandidateNeighbor =
+                    hasCandidateNeighbor || localId[v] < subproblem->numCandidates;
+            });
+            if (hasCandidateNeighbor) {
+                localId[x] = nodes.size();
+                nodes.push_back(x);
+            }
+        });
+
+        if (nodes.size() <= maxDenseSize) {
+            // Each edge between two local nodes is an out-edge of exactly one of them.
+            const count words = (nodes.size() + 63) / 64;
+            subproblem->words = words;
+            subproblem->adjacency.assign(nodes.size() * words, 0);
+            for (index a = 0; a < nodes.size(); ++a) {
+                out->forOutEdgesOf(nodes[a], [&](node v) {
+                    const index b = localId[v];
+                    if (b == NetworKit::none)
+                        return;
+                    subproblem->row(a)[b / 64] |= uint64_t{1} << (b % 64);
+                    subproblem->row(b)[a / 64] |= uint64_t{1} << (a % 64);
+                });
+            }
         }
 
-        handler.assureRunning();
+        for (const node v : nodes)
+            localId[v] = NetworKit::none;
 
-#ifndef NDEBUG
-        for (auto u : orderedNodes) {
-            assert(pxvector[pxlookup[u]] == u);
-        }
-#endif
+        if (nodes.size() > maxDenseSize)
+            return nullptr;
+        return subproblem;
+    }
 
-        // Store out-going neighbors in the direction of higher core numbers.
-        // This means that the out-degree is bounded by the maximum core number.
-        buildOutGraph();
+    void runDense(node u, std::shared_ptr<DenseSubproblem> subproblem) {
+        const count words = subproblem->words;
+        const count numCandidates = subproblem->numCandidates;
+        std::vector<uint64_t> p(words), x(words);
+        for (index i = 0; i < subproblem->nodes.size(); ++i) {
+            auto &set = i < numCandidates ? p : x;
+            set[i / 64] |= uint64_t{1} << (i % 64);
+        }
 
-        handler.assureRunning();
+        DenseSearch(std::move(subproblem), *output, *failure, maximumOnly)
+            .run({u}, std::move(p), std::move(x), numCandidates >= minSplitCandidates);
+    }
 
-        for (index iu = orderedNodes.size(); iu-- > 0;) {
-            node u = orderedNodes[iu];
-            index xpbound = iu + 1;
+public:
+    /**
+     * Lists the maximal cliques whose node with the lowest position in the degeneracy order is
+     * the node at position @a iu.
+     */
+    void processNode(index iu) {
+        const node u = out->orderedNodes[iu];
+
+        // Check if u can be the starting point of a new clique
+        // of size greater than maxFound.
+        // Note that the clique starting at u could be of
+        // size outDegree(u) + 1, but then it is still only the
+        // same size as maxFound.
+        if (maximumOnly && output->maximumSize() > out->outDegree(u))
+            return;
 
-#ifndef NDEBUG
-            for (auto v : orderedNodes) {
-                if (v == u)
-                    break;
+        if (out->outDegree(u) == 0) {
+            // {u} is maximal iff u has no neighbors at all
+            if (G->degree(u) == 0)
+                output->report({u});
+            return;
+        }
 
-                assert(pxlookup[v] < xpbound);
+        if (out->outDegree(u) < maxDenseSize) {
+            auto subproblem = buildDenseSubproblem(u);
+            if (subproblem) {
+                runDense(u, std::move(subproblem));
+                return;
             }
-#endif
+        }
 
-            // Check if u can be the starting point of a new clique
-            // of size greater than maxFound.
-            // Note that the clique starting at u could be of
-            // size outDegree(u) + 1, but then it is still only the
-            // same size as maxFound.
-            if (maximumOnly && maxFound > outDegree(u)) {
-                swapNodeToPos(u, iu);
-                continue;
-            }
+        restoreOrderAbove(iu);
+        index xpbound = iu + 1;
 
-            count xcount = 0;
-            count pcount = 0;
-            G->forNeighborsOf(u, [&](node v) {
+#ifndef NDEBUG
+        for (index i = 0; i < iu; ++i) {
+            assert(pxlookup[out->orderedNodes[i]] < xpbound);
+        }
+#endif
+
+        count xcount = 0;
+        count pcount = 0;
+        G->forNeighborsOf(u, [&](node v) {
 
 #ifndef NDEBUG
-                assert(pxlookup[v] < pxvector.size());
+            assert(pxlookup[v] < pxvector.size());
 
-                assert(xcount <= xpbound);
-                assert(pcount <= pxvector.size() - xpbound);
+            assert(xcount <= xpbound);
+            assert(pcount <= pxvector.size() - xpbound);
 #endif
 
-                if (pxlookup[v] < xpbound) { // v is in X
-                    swapNodeToPos(v, xpbound - xcount - 1);
-                    xcount += 1;
-                } else { // v is in P
-                    swapNodeToPos(v, xpbound + pcount);
-                    pcount += 1;
-                }
-            });
+            if (pxlookup[v] < xpbound) { // v is in X
+                swapNodeToPos(v, xpbound - xcount - 1);
+                xcount += 1;
+            } else { // v is in P
+                swapNodeToPos(v, xpbound + pcount);
+                pcount += 1;
+            }
+        });
 
 #ifndef NDEBUG
-            { // assert all neighbors of u were stored in one range around xpbound
+        { // assert all neighbors of u were stored in one range around xpbound
 
-                assert(xcount + pcount == G->degree(u));
+            assert(xcount + pcount == G->degree(u));
 
-                std::vector<index> neighborPositions;
-                G->forNeighborsOf(u, [&](node v) {
-                    neighborPositions.push_back(pxlookup[v]);
-                    assert(pxvector[pxlookup[v]] == v);
-                });
+            std::vector<index> neighborPositions;
+            G->forNeighborsOf(u, [&](node v) {
+                neighborPositions.push_back(pxlookup[v]);
+                assert(pxvector[pxlookup[v]] == v);
+            });
 
-                std::sort(neighborPositions.begin(), neighborPositions.end());
-                for (index i = 0; i < neighborPositions.size(); ++i) {
-                    assert(neighborPositions[i] == xpbound - xcount + i);
-                }
+            std::sort(neighborPositions.begin(), neighborPositions.end());
+            for (index i = 0; i < neighborPositions.size(); ++i) {
+                assert(neighborPositions[i] == xpbound - xcount + i);
             }
+        }
 #endif
 
-            std::vector<node> r = {u};
-            tomita(xpbound - xcount, xpbound, xpbound + pcount, r);
-
-            swapNodeToPos(u, iu);
+        std::vector<node> r = {u};
+        tomita(xpbound - xcount, xpbound, xpbound + pcount, r);
 
-            handler.assureRunning();
-        }
+        swapNodeToPos(u, iu);
+        restoredBound = iu;
     }
 
+private:
     void tomita(index xbound, index xpbound, index pbound, std::vector<node> &r) {
         if (xbound == pbound) { // if (X, P are empty)
-            if (callback) {
-                callback(r);
-            } else if (!maximumOnly) {
-                result->push_back(r);
-            } else if (r.size() > maxFound) {
-                result->clear();
-                result->push_back(r);
-                maxFound = r.size();
-            }
+            output->report(r);
             return;
         }
 
@@ -213,7 +612,7 @@ public:
 
         // Step 1: mark all outgoing neighbors of the pivot in P
         std::vector<bool> pivotNeighbors(pbound - xpbound);
-        forOutEdgesOf(u, [&](node v) {
+        out->forOutEdgesOf(u, [&](node v) {
             index vpos = pxlookup[v];
             if (vpos >= xpbound && vpos < pbound) {
                 pivotNeighbors[vpos - xpbound] = true;
@@ -226,7 +625,7 @@ public:
             if (!pivotNeighbors[i - xpbound]) {
                 node p = pxvector[i];
 
-                if (!hasNeighbor(p, u)) {
+                if (!out->hasNeighbor(p, u)) {
                     toCheck.push_back(p);
                 }
             }
@@ -237,7 +636,7 @@ public:
 
             // Group all neighbors of pxveci in P \cup X around xpbound.
             // Step 1: collect all outgoing neighbors of pxveci
-            forOutEdgesOf(pxveci, [&](node v) {
+            out->forOutEdgesOf(pxveci, [&](node v) {
                 if (pxlookup[v] < xpbound && pxlookup[v] >= xbound) { // v is in X
                     swapNodeToPos(v, xpbound - xcount - 1);
                     xcount += 1;
@@ -255,7 +654,7 @@ public:
                     break;
                 node x = pxvector[i];
 
-                if (hasNeighbor(x, pxveci)) {
+                if (out->hasNeighbor(x, pxveci)) {
                     swapNodeToPos(x, xpbound - xcount - 1);
                     xcount += 1;
                 } else {
@@ -270,7 +669,7 @@ public:
             for (index i = xpbound + pcount; i < pbound; ++i) {
                 node p = pxvector[i];
 
-                if (hasNeighbor(p, pxveci)) {
+                if (out->hasNeighbor(p, pxveci)) {
                     swapNodeToPos(p, xpbound + pcount);
                     pcount += 1;
                 }
@@ -287,7 +686,7 @@ public:
             // therefore r.size() + pcount is an upper bound for the maximum
             // size of the clique that can still be found in this branch
             // of the recursion.
-            if (!maximumOnly || maxFound < (r.size() + pcount)) {
+            if (!maximumOnly || output->maximumSize() < (r.size() + pcount)) {
                 tomita(xpbound - xcount, xpbound, xpbound + pcount, r);
             }
 
@@ -321,7 +720,7 @@ public:
         // Step 1: for all nodes in X count how many outgoing neighbors they have in P
         for (index i = 0; i < xpbound - xbound; i++) {
             node u = pxvector[i + xbound];
-            forOutEdgesOf(u, [&](node v) {
+            out->forOutEdgesOf(u, [&](node v) {
                 if (pxlookup[v] >= xpbound && pxlookup[v] < pbound) {
                     ++pivotNeighbors[i];
                 }
@@ -337,7 +736,7 @@ public:
         // b) count all outgoing neighbors in P
         for (index i = xpbound - xbound; i < pivotNeighbors.size(); ++i) {
             node u = pxvector[i + xbound];
-            forOutEdgesOf(u, [&](node v) {
+            out->forOutEdgesOf(u, [&](node v) {
                 index neighborPos = pxlookup[v];
                 if (neighborPos >= xbound && neighborPos < pbound) {
                     ++pivotNeighbors[neighborPos - xbound];
@@ -376,8 +775,10 @@ MaximalCliques::MaximalCliques(const Graph &G, bool maximumOnly)
     : G(&G), maximumOnly(maximumOnly) {}
 
 MaximalCliques::MaximalCliques(const Graph &G,
-                               std::function<void(const std::vector<node> &)> callback)
-    : G(&G), callback(std::move(callback)), maximumOnly(false) {}
+                               std::function<void(const std::vector<node> &)> callback,
+                               bool concurrentCallback)
+    : G(&G), callback(std::move(callback)), maximumOnly(false),
+      concurrentCallback(concurrentCallback) {}
 
 const std::vector<std::vector<node>> &MaximalCliques::getCliques() const {
     if (callback)
@@ -391,7 +792,42 @@ void MaximalCliques::run() {
 
     result.clear();
 
-    MaximalCliquesImpl(*G, result, callback, maximumOnly).run();
+    CoreDecomposition cores(*G, false, false, true);
+    cores.run();
+
+    Aux::SignalHandler handler;
+    handler.assureRunning();
+
+    const OutGraph out(*G, cores.getNodeOrder());
+
+    handler.assureRunning();
+
+    CliqueOutput output(result, callback, maximumOnly, concurrentCallback);
+    SearchFailure failure;
+    const count n = out.orderedNodes.size();
+
+#pragma omp parallel
+    {
+        MaximalCliquesImpl impl(*G, out, output, failure, maximumOnly);
+
+        // Nodes with high core numbers come last in the degeneracy order and usually have the
+        // largest subproblems, so they are processed first.
+#pragma omp for schedule(dynamic, 1)
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            if (failure.hasFailed())
+                continue;
+            try {
+                impl.processNode(n - 1 - i);
+            } catch (...) {
+                failure.capture();
+            }
+        }
+        // Tasks of split subproblems are completed at the implicit barrier.
+    }
+
+    failure.rethrow();
+
+    output.finish();
 
     hasRun = true;
 }
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/clique/MaximalCliques.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/EdgeListReader.hpp>
@@ -12,6 +18,41 @@ namespace NetworKit {
 
 class MaximalCliquesGTest : public testing::Test {};
 
+namespace {
+
+// Sorts the nodes of each clique and the cliques, so results can be compared as sets.
+std::vector<std::vector<node>> normalized(std::vector<std::vector<node>> cliques) {
+    for (auto &clique : cliques)
+        std::sort(clique.begin(), clique.end());
+    std::sort(cliques.begin(), cliques.end());
+    return cliques;
+}
+
+void expectMaximalCliques(const Graph &G, const std::vector<std::vector<node>> &cliques) {
+    std::vector<bool> inClique(G.upperNodeIdBound());
+    for (const auto &clique : cliques) {
+        for (node u : clique)
+            inClique[u] = true;
+        for (node u : clique) {
+            count neighborsInClique = 0;
+            G.forNeighborsOf(u, [&](node v) { neighborsInClique += inClique[v]; });
+            EXPECT_EQ(clique.size() - 1, neighborsInClique);
+        }
+        // no node outside of the clique is adjacent to all clique nodes
+        G.forNodes([&](node v) {
+            if (inClique[v])
+                return;
+            count neighborsInClique = 0;
+            G.forNeighborsOf(v, [&](node w) { neighborsInClique += inClique[w]; });
+            EXPECT_LT(neighborsInClique, clique.size());
+        });
+        for (node u : clique)
+            inClique[u] = false;
+    }
+}
+
+} // namespace
+
 TEST_F(MaximalCliquesGTest, testMaximalCliques) {
 
     METISGraphReader reader;
@@ -115,6 +156,92 @@ TEST_F(MaximalCliquesGTest, testMaximalCliquesWithCallback) {
     EXPECT_GT(numCliques, 1u);
 }
 
+TEST_F(MaximalCliquesGTest, testMaximalCliquesDenseSubproblems) {
+    Aux::Random::setSeed(42, false);
+    // Dense enough that subproblems are split into tasks.
+    const Graph G = ErdosRenyiGenerator(150, 0.4).generate();
+
+    MaximalCliques stored(G);
+    stored.run();
+    const auto expected = normalized(stored.getCliques());
+    expectMaximalCliques(G, expected);
+    EXPECT_EQ(std::adjacent_find(expected.begin(), expected.end()), expected.end());
+
+    std::vector<std::vector<node>> serialized;
+    MaximalCliques withCallback(G, [&](const std::vector<node> &clique) {
+        serialized.push_back(clique);
+    });
+    withCallback.run();
+    EXPECT_EQ(expected, normalized(serialized));
+
+    std::mutex mutex;
+    std::vector<std::vector<node>> concurrent;
+    MaximalCliques withConcurrentCallback(
+        G,
+        [&](const std::vector<node> &clique) {
+            std::lock_guard<std::mutex> lock(mutex);
+            concurrent.push_back(clique);
+        },
+        true);
+    withConcurrentCallback.run();
+    EXPECT_EQ(expected, normalized(concurrent));
+}
+
+TEST_F(MaximalCliquesGTest, testMaximalCliquesLargeSubproblem) {
+    // The subproblems of the hubs have more excluded nodes than fit into a bit matrix.
+    const count leaves = 5000;
+    Graph G(leaves + 3);
+    const node hub1 = leaves, hub2 = leaves + 1, isolated = leaves + 2;
+    G.addEdge(hub1, hub2);
+    for (node u = 0; u < leaves; ++u) {
+        G.addEdge(u, hub1);
+        G.addEdge(u, hub2);
+    }
+
+    MaximalCliques clique(G);
+    clique.run();
+    const auto cliques = normalized(clique.getCliques());
+    ASSERT_EQ(cliques.size(), leaves + 1);
+    for (node u = 0; u < leaves; ++u)
+        EXPECT_EQ(cliques[u], std::vector<node>({u, hub1, hub2}));
+    EXPECT_EQ(cliques.back(), std::vector<node>({isolated}));
+}
+
+TEST_F(MaximalCliquesGTest, testMaximumCliqueParallel) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.1).generate();
+    std::vector<node> planted;
+    for (node u = 0; u < 300; u += 25)
+        planted.push_back(u);
+    for (node u : planted)
+        for (node v : planted)
+            if (u < v && !G.hasEdge(u, v))
+                G.addEdge(u, v);
+
+    MaximalCliques clique(G, true);
+    clique.run();
+    const auto &cliques = clique.getCliques();
+    ASSERT_EQ(cliques.size(), 1u);
+    auto maximum = cliques.front();
+    std::sort(maximum.begin(), maximum.end());
+    EXPECT_EQ(maximum, planted);
+}
+
+TEST_F(MaximalCliquesGTest, testMaximalCliquesCallbackException) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(100, 0.3).generate();
+    std::atomic<count> calls{0};
+    MaximalCliques clique(
+        G,
+        [&](const std::vector<node> &) {
+            ++calls;
+            throw std::runtime_error("stop");
+        },
+        true);
+    EXPECT_THROW(clique.run(), std::runtime_error);
+    EXPECT_GT(calls.load(), 0u);
+}
+
 TEST_F(MaximalCliquesGTest, benchMaximalCliques) {
     std::string graphPath;
 
@@ -5,7 +5,11 @@
  *      Author: Christian Staudt
  */
 
+#include <algorithm>
+#include <atomic>
 #include <omp.h>
+#include <utility>
+#include <vector>
 
 #include <networkit/Globals.hpp>
 #include <networkit/auxiliary/Log.hpp>
@@ -60,13 +64,122 @@ void PLP::run() {
      * iteration.
      */
 
-    std::vector<bool> activeNodes(z, true); // record if node must be processed
+    const index numLabels = result.upperBound();
+    const bool synchronous = mode == Mode::SYNCHRONOUS;
+
+    // Nodes to process in the current iteration. A node is queued for the next iteration when a
+    // neighbor changes its label; the atomic flag ensures that exactly one thread enqueues it.
+    std::vector<node> frontier;
+    frontier.reserve(n);
+    G->forNodes([&](node v) {
+        if (G->degree(v) > 0)
+            frontier.push_back(v);
+    });
+    std::vector<std::atomic<uint8_t>> queued(z);
+    G->parallelForNodes([&](node v) { queued[v].store(0, std::memory_order_relaxed); });
+
+    // In synchronous mode, the nodes are processed in the color classes of a greedy coloring.
+    // Nodes of one class are not adjacent, so they are evaluated on the labels of the previous
+    // classes, independently of the number of threads. Updating all nodes at once instead would
+    // let the labels oscillate, e.g., on bipartite graphs.
+    std::vector<index> color;
+    count numColors = 0;
+    if (synchronous) {
+        color.assign(z, 0);
+        std::vector<index> usedBy;
+        G->forNodes([&](node v) {
+            G->forNeighborsOf(v, [&](node w) {
+                if (w < v) {
+                    if (usedBy.size() <= color[w])
+                        usedBy.resize(color[w] + 1, none);
+                    usedBy[color[w]] = v;
+                }
+            });
+            index c = 0;
+            while (c < usedBy.size() && usedBy[c] == v)
+                ++c;
+            color[v] = c;
+            numColors = std::max(numColors, c + 1);
+        });
+    }
+    std::vector<index> classBegin(numColors + 1);
+    std::vector<node> sortedFrontier;
+
+    // Per-thread state: dense label weights with the list of touched labels, nodes queued for
+    // the next iteration and, in synchronous mode, the label updates of the iteration.
+    struct ThreadData {
+        std::vector<edgeweight> labelWeight;
+        std::vector<label> touched;
+        std::vector<node> nextFrontier;
+        std::vector<std::pair<node, label>> updates;
+    };
+    std::vector<ThreadData> threadData(omp_get_max_threads());
+
+    // Returns the label with the largest weight in the neighborhood of v.
+    auto heaviestLabel = [&](ThreadData &data, node v) -> label {
+        if (data.labelWeight.empty())
+            data.labelWeight.assign(numLabels, 0); // allocated by the thread using it
+
+        G->forNeighborsOf(v, [&](node w, edgeweight weight) {
+            const label lw = result[w];
+            if (data.labelWeight[lw] == 0)
+                data.touched.push_back(lw);
+            data.labelWeight[lw] += weight;
+        });
+
+        const label current = result[v];
+        label heaviest = current;
+        edgeweight maxWeight = data.labelWeight[current];
+        for (const label l : data.touched) {
+            const edgeweight w = data.labelWeight[l];
+            if (w > maxWeight || (w == maxWeight && heaviest != current && l < heaviest)) {
+                heaviest = l;
+                maxWeight = w;
+            }
+            data.labelWeight[l] = 0;
+        }
+        data.touched.clear();
+        return heaviest;
+    };
+
+    // Evaluates the nodes in [begin, end) of the given frontier and updates their labels
+    // directly (asynchronous mode) or after all of them are evaluated (synchronous mode).
+    auto processNodes = [&](const std::vector<node> &nodes, index begin, index end) {
+        count updated = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : updated)
+        for (omp_index i = static_cast<omp_index>(begin); i < static_cast<omp_index>(end); ++i) {
+            const node v = nodes[i];
+            auto &data = threadData[omp_get_thread_num()];
+            const label heaviest = heaviestLabel(data, v);
+            if (heaviest == result[v])
+                continue;
+
+            if (synchronous)
+                data.updates.emplace_back(v, heaviest);
+            else
+                result[v] = heaviest;
+            ++updated;
+
+            G->forNeighborsOf(v, [&](node u) {
+                if (!queued[u].exchange(1, std::memory_order_relaxed))
+                    data.nextFrontier.push_back(u);
+            });
+        }
+
+        for (auto &data : threadData) {
+            for (const auto &[v, l] : data.updates)
+                result[v] = l;
+            data.updates.clear();
+        }
+        nUpdated += updated;
+    };
 
     Aux::Timer runtime;
 
     // propagate labels
     // as long as a label has changed... or maximum iterations reached
-    while ((nUpdated > this->updateThreshold) && (nIterations < maxIterations)) {
+    while ((nUpdated > this->updateThreshold) && (nIterations < maxIterations)
+           && !frontier.empty()) {
         runtime.start();
         nIterations += 1;
         DEBUG("[BEGIN] LabelPropagation: iteration #", nIterations);
@@ -74,38 +187,34 @@ void PLP::run() {
         // reset updated
         nUpdated = 0;
 
-        G->balancedParallelForNodes([&](node v) {
-            if (!activeNodes[v] || G->degree(v) == 0)
-                return; // node is isolated
-
-            // neighborLabelCounts maps label -> frequency in the neighbors
-            std::map<label, double> labelWeights;
-
-            // weigh the labels in the neighborhood of v
-            G->forNeighborsOf(v, [&](node w, edgeweight weight) {
-                label lw = result.subsetOf(w);
-                labelWeights[lw] += weight; // add weight of edge {v, w}
-            });
-
-            // get heaviest label
-            label heaviest = std::max_element(labelWeights.begin(), labelWeights.end(),
-                                              [](const std::pair<label, edgeweight> &p1,
-                                                 const std::pair<label, edgeweight> &p2) {
-                                                  return p1.second < p2.second;
-                                              })
-                                 ->first;
-
-            if (result.subsetOf(v) != heaviest) { // UPDATE
-                result.moveToSubset(heaviest, v); // result[v] = heaviest;
-#pragma omp atomic
-                nUpdated += 1;
-                G->forNeighborsOf(v, [&](node u) { activeNodes[u] = true; });
-            } else {
-                activeNodes[v] = false;
-            }
-        });
-
-        // for each while loop iteration...
+        if (synchronous) {
+            // group the frontier by color class; the order within a class does not matter
+            std::fill(classBegin.begin(), classBegin.end(), 0);
+            for (const node v : frontier)
+                ++classBegin[color[v] + 1];
+            for (index c = 0; c < numColors; ++c)
+                classBegin[c + 1] += classBegin[c];
+            sortedFrontier.resize(frontier.size());
+            for (const node v : frontier)
+                sortedFrontier[classBegin[color[v]]++] = v;
+            std::copy_backward(classBegin.begin(), classBegin.end() - 1, classBegin.end());
+            classBegin[0] = 0;
+
+            for (index c = 0; c < numColors; ++c)
+                if (classBegin[c] < classBegin[c + 1])
+                    processNodes(sortedFrontier, classBegin[c], classBegin[c + 1]);
+        } else {
+            processNodes(frontier, 0, frontier.size());
+        }
+
+        // collect the next frontier
+        frontier.clear();
+        for (auto &data : threadData) {
+            frontier.insert(frontier.end(), data.nextFrontier.begin(), data.nextFrontier.end());
+            data.nextFrontier.clear();
+        }
+        for (const node u : frontier)
+            queued[u].store(0, std::memory_order_relaxed);
 
         runtime.stop();
         this->timing.push_back(runtime.elapsedMilliseconds());
@@ -0,0 +1,54 @@
+/*
+ * CommunityGBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/community/PLM.hpp>
+#include <networkit/community/PLP.hpp>
+#include <networkit/community/ParallelLeiden.hpp>
+
+#include "../../BenchmarkGraphs.hpp"
+
+namespace NetworKit {
+
+namespace {
+
+using BenchmarkGraphs::graphSizes;
+using BenchmarkGraphs::hyperbolic;
+
+template <class Algorithm>
+void runCommunityDetection(benchmark::State &state) {
+    const Graph &G = hyperbolic(state.range(0));
+    Aux::Random::setSeed(42, false);
+    for (auto _ : state) {
+        Algorithm algo(G);
+        algo.run();
+        state.counters["communities"] =
+            static_cast<double>(algo.getPartition().numberOfSubsets());
+    }
+    state.SetItemsProcessed(state.iterations() * G.numberOfEdges());
+}
+
+void BM_PLP(benchmark::State &state) {
+    runCommunityDetection<PLP>(state);
+}
+
+void BM_PLM(benchmark::State &state) {
+    runCommunityDetection<PLM>(state);
+}
+
+void BM_ParallelLeiden(benchmark::State &state) {
+    runCommunityDetection<ParallelLeiden>(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_PLP)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_PLM)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ParallelLeiden)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace NetworKit
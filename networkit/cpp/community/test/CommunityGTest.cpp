@@ -147,6 +147,64 @@ TEST_F(CommunityGTest, testLabelPropagationOnManySmallClusters) {
         << "Can LabelPropagation detect the reference clustering?";
 }
 
+TEST_F(CommunityGTest, testLabelPropagationSynchronous) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator graphGen(1000, 20, 0.5, 0.002);
+    const Graph G = graphGen.generate();
+
+    const int maxThreads = omp_get_max_threads();
+    auto runPLP = [&](int threads) {
+        omp_set_num_threads(threads);
+        PLP lp(G);
+        lp.setMode(PLP::Mode::SYNCHRONOUS);
+        lp.run();
+        omp_set_num_threads(maxThreads);
+        return lp.getPartition();
+    };
+
+    const Partition zeta = runPLP(1);
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+    EXPECT_GE(Modularity().getQuality(zeta, G), 0.5);
+
+    // synchronous updates do not depend on the number of threads
+    const Partition zeta2 = runPLP(std::max(maxThreads, 2));
+    G.forNodes([&](node u) { EXPECT_EQ(zeta[u], zeta2[u]); });
+}
+
+TEST_F(CommunityGTest, testLabelPropagationSynchronousConverges) {
+    // bipartite graphs, on which updating all labels at once would swap them forever
+    Graph edge(2);
+    edge.addEdge(0, 1);
+    Graph path(10);
+    for (node u = 1; u < path.numberOfNodes(); ++u)
+        path.addEdge(u - 1, u);
+
+    for (const Graph *G : {&edge, &path}) {
+        PLP lp(*G);
+        lp.setMode(PLP::Mode::SYNCHRONOUS);
+        lp.setUpdateThreshold(0);
+        lp.run();
+        EXPECT_LE(lp.numberOfIterations(), G->numberOfNodes());
+        const Partition &zeta = lp.getPartition();
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(*G, zeta));
+        EXPECT_EQ(zeta[0], zeta[1]);
+    }
+}
+
+TEST_F(CommunityGTest, testLabelPropagationMaxIterations) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(500, 0.02).generate();
+
+    for (auto mode : {PLP::Mode::ASYNCHRONOUS, PLP::Mode::SYNCHRONOUS}) {
+        PLP lp(G, none, 2);
+        lp.setMode(mode);
+        lp.run();
+        EXPECT_LE(lp.numberOfIterations(), 2u);
+        EXPECT_EQ(lp.getTiming().size(), lp.numberOfIterations());
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, lp.getPartition()));
+    }
+}
+
 TEST_F(CommunityGTest, testPLM) {
     METISGraphReader reader;
     Modularity modularity;
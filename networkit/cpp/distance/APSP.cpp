@@ -15,10 +15,7 @@ namespace NetworKit {
 
 APSP::APSP(const Graph &G) : Algorithm(), G(G) {}
 
-void APSP::run() {
-    const count n = G.upperNodeIdBound();
-    distances.assign(n, std::vector<edgeweight>(n));
-
+void APSP::initSSSPs() {
     sssps.resize(omp_get_max_threads());
 #pragma omp parallel
     {
@@ -28,6 +25,12 @@ void APSP::run() {
         else
             sssps[i] = std::unique_ptr<SSSP>(new BFS(G, 0, false));
     }
+}
+
+void APSP::run() {
+    const count n = G.upperNodeIdBound();
+    distances.assign(n, std::vector<edgeweight>(n));
+    initSSSPs();
 
     G.parallelForNodes([&](node source) {
         auto sssp = sssps[omp_get_thread_num()].get();
@@ -39,4 +42,17 @@ void APSP::run() {
     hasRun = true;
 }
 
+void APSP::streamRows(const RowCallback &handle) {
+    std::vector<std::vector<edgeweight>>().swap(distances);
+    hasRun = false;
+    initSSSPs();
+
+    G.balancedParallelForNodes([&](node source) {
+        auto sssp = sssps[omp_get_thread_num()].get();
+        sssp->setSource(source);
+        sssp->run();
+        handle(source, sssp->getDistances());
+    });
+}
+
 } /* namespace NetworKit */
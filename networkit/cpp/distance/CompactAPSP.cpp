@@ -0,0 +1,103 @@
+/*
+ * CompactAPSP.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <atomic>
+#include <fstream>
+#include <omp.h>
+
+#include <networkit/distance/APSP.hpp>
+#include <networkit/distance/CompactAPSP.hpp>
+
+namespace NetworKit {
+
+template <typename DistanceType>
+CompactAPSP<DistanceType>::CompactAPSP(const Graph &G, std::string path)
+    : G(&G), path(std::move(path)) {
+    if (std::is_integral<DistanceType>::value && G.isWeighted())
+        throw std::runtime_error("Integral distance types require an unweighted graph.");
+}
+
+template <typename DistanceType>
+void CompactAPSP<DistanceType>::run() {
+    hasRun = false;
+    data = nullptr;
+    mappedFile.close();
+    std::vector<DistanceType>().swap(inMemory);
+
+    n = G->upperNodeIdBound();
+    const bool toFile = !path.empty();
+    const auto rowBytes = static_cast<std::streamoff>(n * sizeof(DistanceType));
+
+    // Each thread writes its rows through its own stream at the row's offset.
+    std::vector<std::fstream> files;
+    std::vector<std::vector<DistanceType>> rowBuffers;
+    if (toFile) {
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file)
+                throw std::runtime_error("Unable to open " + path);
+            const std::vector<DistanceType> unreachable(n, infDist);
+            for (node u = 0; u < n; ++u)
+                if (!G->hasNode(u))
+                    file.seekp(u * rowBytes).write(
+                        reinterpret_cast<const char *>(unreachable.data()), rowBytes);
+            if (n > 0)
+                file.seekp(n * rowBytes - 1).put('\0');
+        }
+        files.resize(omp_get_max_threads());
+        for (auto &file : files)
+            file.open(path, std::ios::binary | std::ios::in | std::ios::out);
+        rowBuffers.resize(omp_get_max_threads(), std::vector<DistanceType>(n));
+    } else {
+        inMemory.assign(n * n, infDist);
+    }
+
+    std::atomic<bool> overflow{false};
+    APSP(*G).streamRows([&](node source, const std::vector<edgeweight> &row) {
+        const auto tid = omp_get_thread_num();
+        DistanceType *out = toFile ? rowBuffers[tid].data() : inMemory.data() + source * n;
+        for (node v = 0; v < n; ++v) {
+            const edgeweight dist = v < row.size() ? row[v] : std::numeric_limits<edgeweight>::max();
+            if (dist == std::numeric_limits<edgeweight>::max()) {
+                out[v] = infDist;
+            } else if (dist >= static_cast<edgeweight>(infDist)) {
+                overflow.store(true, std::memory_order_relaxed);
+                out[v] = infDist;
+            } else {
+                out[v] = static_cast<DistanceType>(dist);
+            }
+        }
+        if (toFile)
+            files[tid].seekp(source * rowBytes).write(reinterpret_cast<const char *>(out),
+                                                      rowBytes);
+    });
+
+    for (auto &file : files) {
+        file.close();
+        if (!file)
+            throw std::runtime_error("Error while writing " + path);
+    }
+    if (overflow)
+        throw std::runtime_error("Distance does not fit into the distance type.");
+
+    if (toFile) {
+        if (n > 0) {
+            mappedFile.open(path);
+            data = reinterpret_cast<const DistanceType *>(mappedFile.cbegin());
+        }
+    } else {
+        data = inMemory.data();
+    }
+
+    hasRun = true;
+}
+
+template class CompactAPSP<uint8_t>;
+template class CompactAPSP<uint16_t>;
+template class CompactAPSP<uint32_t>;
+template class CompactAPSP<float>;
+
+} /* namespace NetworKit */
@@ -0,0 +1,226 @@
+/*
+ * DeltaStepping.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <tuple>
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
+
+namespace NetworKit {
+
+DeltaStepping::DeltaStepping(const Graph &G, node source, bool storePaths,
+                             bool storeNodesSortedByDistance, node target, edgeweight delta)
+    : SSSP(G, source, storePaths, storeNodesSortedByDistance, target), delta(delta) {
+    if (delta < 0)
+        throw std::runtime_error("Error: delta must not be negative.");
+}
+
+void DeltaStepping::run() {
+    const count z = G->upperNodeIdBound();
+    const auto infDist = std::numeric_limits<edgeweight>::max();
+
+    usedDelta = delta;
+    if (usedDelta == 0 && G->numberOfEdges() > 0)
+        usedDelta = G->totalEdgeWeight() / static_cast<edgeweight>(G->numberOfEdges());
+    if (usedDelta <= 0)
+        usedDelta = defaultEdgeWeight;
+
+    std::vector<std::atomic<edgeweight>> tentative(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        tentative[u].store(infDist, std::memory_order_relaxed);
+    tentative[source].store(0., std::memory_order_relaxed);
+
+    auto bucketOf = [&](edgeweight dist) -> index { return static_cast<index>(dist / usedDelta); };
+
+    // All tentative distances are below (current + 1) * delta + maxWeight while bucket current is
+    // processed, so the buckets that may be non-empty fit into a ring of numSlots slots.
+    edgeweight maxWeight = defaultEdgeWeight;
+    if (G->isWeighted()) {
+        maxWeight = 0;
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(max : maxWeight)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+            G->forNeighborsOf(u, [&](node, edgeweight w) { maxWeight = std::max(maxWeight, w); });
+#else
+        G->forEdges([&](node, node, edgeweight w) { maxWeight = std::max(maxWeight, w); });
+#endif
+    }
+    const index numSlots = static_cast<index>(maxWeight / usedDelta) + 2;
+
+    // buckets[t][b % numSlots] holds the nodes that thread t inserted into bucket b. Nodes are not
+    // removed when their distance decreases; stale entries are skipped when the bucket is
+    // processed.
+    std::vector<std::vector<std::vector<node>>> buckets(
+        omp_get_max_threads(), std::vector<std::vector<node>>(numSlots));
+    buckets[0][0].push_back(source);
+
+    auto relax = [&](node v, edgeweight newDist, std::vector<std::vector<node>> &myBuckets) {
+        edgeweight oldDist = tentative[v].load(std::memory_order_relaxed);
+        while (newDist < oldDist) {
+            if (tentative[v].compare_exchange_weak(oldDist, newDist, std::memory_order_relaxed)) {
+                myBuckets[bucketOf(newDist) % numSlots].push_back(v);
+                return;
+            }
+        }
+    };
+
+    // Relaxes the light (or heavy) edges of all nodes in the given vector in parallel.
+    auto relaxEdges = [&](const std::vector<node> &nodes, bool light) {
+#pragma omp parallel
+        {
+            auto &myBuckets = buckets[omp_get_thread_num()];
+#pragma omp for schedule(guided) nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(nodes.size()); ++i) {
+                const node u = nodes[i];
+                const edgeweight du = tentative[u].load(std::memory_order_relaxed);
+                G->forNeighborsOf(u, [&](node v, edgeweight w) {
+                    if ((w <= usedDelta) == light)
+                        relax(v, du + w, myBuckets);
+                });
+            }
+        }
+    };
+
+    std::vector<index> frontierStamp(z, none), settledStamp(z, none);
+    std::vector<node> frontier, settled;
+    index round = 0;
+
+    for (index current = 0;; ++current) {
+        // find the smallest non-empty bucket
+        index next = none;
+        for (const auto &myBuckets : buckets)
+            for (index b = current; b < std::min(next, current + numSlots); ++b)
+                if (!myBuckets[b % numSlots].empty()) {
+                    next = b;
+                    break;
+                }
+        if (next == none)
+            break;
+        current = next;
+
+        // the distance of the target is final once all smaller buckets are settled
+        if (target != none
+            && tentative[target].load(std::memory_order_relaxed) < current * usedDelta)
+            break;
+
+        settled.clear();
+        while (true) {
+            ++round;
+            frontier.clear();
+            for (auto &myBuckets : buckets) {
+                for (const node v : myBuckets[current % numSlots]) {
+                    if (frontierStamp[v] == round
+                        || bucketOf(tentative[v].load(std::memory_order_relaxed)) != current)
+                        continue;
+                    frontierStamp[v] = round;
+                    frontier.push_back(v);
+                    if (settledStamp[v] != current) {
+                        settledStamp[v] = current;
+                        settled.push_back(v);
+                    }
+                }
+                myBuckets[current % numSlots].clear();
+            }
+            if (frontier.empty())
+                break;
+            relaxEdges(frontier, true);
+        }
+
+        // heavy edges lead to later buckets, so they are relaxed only once
+        relaxEdges(settled, false);
+    }
+
+    distances.resize(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        distances[u] = tentative[u].load(std::memory_order_relaxed);
+
+    std::vector<node> reached;
+    G->forNodes([&](node u) {
+        if (distances[u] != infDist)
+            reached.push_back(u);
+    });
+    reachedNodes = reached.size();
+    sumDist = 0.;
+#pragma omp parallel for reduction(+ : sumDist)
+    for (omp_index i = 0; i < static_cast<omp_index>(reached.size()); ++i)
+        sumDist += distances[reached[i]];
+
+    if (!storePaths && !storeNodesSortedByDistance) {
+        hasRun = true;
+        return;
+    }
+
+    Aux::Parallel::sort(reached.begin(), reached.end(), [&](node u, node v) {
+        return std::tie(distances[u], u) < std::tie(distances[v], v);
+    });
+
+    if (storePaths) {
+        previous.clear();
+        previous.resize(z);
+        npaths.clear();
+        npaths.resize(z, 0);
+        npaths[source] = 1;
+
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(reached.size()); ++i) {
+            const node v = reached[i];
+            if (v == source)
+                continue;
+            G->forInNeighborsOf(v, [&](node u, edgeweight w) {
+                if (u != v && distances[u] != infDist && distances[u] + w == distances[v])
+                    previous[v].push_back(u);
+            });
+        }
+
+        // The path counts are computed level by level along the shortest path DAG: a node is
+        // ready once the counts of all its predecessors are final. The number of levels is the
+        // maximum number of edges on a shortest path, not the number of distinct distances.
+        std::vector<std::atomic<count>> remaining(z);
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(reached.size()); ++i)
+            remaining[reached[i]].store(previous[reached[i]].size(), std::memory_order_relaxed);
+
+        std::vector<node> level{source};
+        std::vector<std::vector<node>> nextLevel(omp_get_max_threads());
+        while (!level.empty()) {
+#pragma omp parallel
+            {
+                auto &myNext = nextLevel[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(level.size()); ++i) {
+                    const node u = level[i];
+                    G->forNeighborsOf(u, [&](node v, edgeweight w) {
+                        if (v == u || v == source || distances[u] + w != distances[v])
+                            return;
+                        if (remaining[v].fetch_sub(1, std::memory_order_acq_rel) != 1)
+                            return;
+                        for (const node p : previous[v])
+                            npaths[v] += npaths[p];
+                        myNext.push_back(v);
+                    });
+                }
+            }
+
+            level.clear();
+            for (auto &myNext : nextLevel) {
+                level.insert(level.end(), myNext.begin(), myNext.end());
+                myNext.clear();
+            }
+        }
+    }
+
+    if (storeNodesSortedByDistance)
+        nodesSortedByDistance = std::move(reached);
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,170 @@
+/*
+ * ParallelBFS.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <atomic>
+#include <omp.h>
+
+#include <networkit/distance/ParallelBFS.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+using Bitmap = std::vector<std::atomic<uint64_t>>;
+
+void clearBitmap(Bitmap &bits) {
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(bits.size()); ++i)
+        bits[i].store(0, std::memory_order_relaxed);
+}
+
+bool testBit(const Bitmap &bits, node u) {
+    return bits[u / 64].load(std::memory_order_relaxed) & (uint64_t{1} << (u % 64));
+}
+
+// Returns true iff the bit was not set before.
+bool setBit(Bitmap &bits, node u) {
+    const uint64_t mask = uint64_t{1} << (u % 64);
+    return !(bits[u / 64].fetch_or(mask, std::memory_order_relaxed) & mask);
+}
+
+} // namespace
+
+ParallelBFS::ParallelBFS(const Graph &G, node source, bool storePaths,
+                         bool storeNodesSortedByDistance, node target, double alpha, double beta)
+    : SSSP(G, source, storePaths, storeNodesSortedByDistance, target), alpha(alpha), beta(beta) {
+    if (alpha <= 0 || beta <= 0)
+        throw std::runtime_error("Error: alpha and beta must be positive.");
+}
+
+void ParallelBFS::run() {
+    const count z = G->upperNodeIdBound();
+    const auto infDist = std::numeric_limits<edgeweight>::max();
+    distances.assign(z, infDist);
+    bottomUpSteps = 0;
+
+    Bitmap visited((z + 63) / 64), frontierBits((z + 63) / 64);
+    clearBitmap(visited);
+
+    // All nodes reached so far, level by level; level d is order[levelBegin[d], levelBegin[d+1]).
+    std::vector<node> order{source};
+    std::vector<index> levelBegin{0, 1};
+    distances[source] = 0.;
+    setBit(visited, source);
+
+    std::vector<std::vector<node>> localNext(omp_get_max_threads());
+    count unexploredEdges = G->isDirected() ? G->numberOfEdges() : 2 * G->numberOfEdges();
+    count frontierEdges = G->degreeOut(source);
+    bool bottomUp = false;
+
+    for (count level = 0; levelBegin[level] < levelBegin[level + 1]; ++level) {
+        if (target != none && testBit(visited, target))
+            break;
+
+        const index frontierBegin = levelBegin[level];
+        const index frontierEnd = levelBegin[level + 1];
+        unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+        if (!bottomUp)
+            bottomUp = static_cast<double>(frontierEdges) > unexploredEdges / alpha;
+        else
+            bottomUp = static_cast<double>(frontierEnd - frontierBegin) >= z / beta;
+
+        if (bottomUp) {
+            ++bottomUpSteps;
+            clearBitmap(frontierBits);
+#pragma omp parallel for
+            for (omp_index i = frontierBegin; i < static_cast<omp_index>(frontierEnd); ++i)
+                setBit(frontierBits, order[i]);
+
+            auto hasParentInFrontier = [&](auto neighbors) -> bool {
+                for (const node u : neighbors)
+                    if (testBit(frontierBits, u))
+                        return true;
+                return false;
+            };
+
+#pragma omp parallel
+            {
+                auto &next = localNext[omp_get_thread_num()];
+#pragma omp for schedule(guided) nowait
+                for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+                    if (!G->hasNode(v) || testBit(visited, v))
+                        continue;
+                    const bool found = G->isDirected()
+                                           ? hasParentInFrontier(G->inNeighborRange(v))
+                                           : hasParentInFrontier(G->neighborRange(v));
+                    if (found) {
+                        // other threads may set bits of the same word
+                        setBit(visited, v);
+                        next.push_back(v);
+                    }
+                }
+            }
+        } else {
+#pragma omp parallel
+            {
+                auto &next = localNext[omp_get_thread_num()];
+#pragma omp for schedule(guided) nowait
+                for (omp_index i = frontierBegin; i < static_cast<omp_index>(frontierEnd); ++i) {
+                    G->forNeighborsOf(order[i], [&](node v) {
+                        if (!testBit(visited, v) && setBit(visited, v))
+                            next.push_back(v);
+                    });
+                }
+            }
+        }
+
+        for (auto &next : localNext) {
+            order.insert(order.end(), next.begin(), next.end());
+            next.clear();
+        }
+        levelBegin.push_back(order.size());
+
+        const index nextBegin = levelBegin[level + 1];
+        const index nextEnd = levelBegin[level + 2];
+        const edgeweight nextDist = static_cast<edgeweight>(level + 1);
+        frontierEdges = 0;
+#pragma omp parallel for reduction(+ : frontierEdges)
+        for (omp_index i = nextBegin; i < static_cast<omp_index>(nextEnd); ++i) {
+            distances[order[i]] = nextDist;
+            frontierEdges += G->degreeOut(order[i]);
+        }
+    }
+
+    reachedNodes = order.size();
+    sumDist = 0.;
+    for (count level = 1; level + 1 < levelBegin.size(); ++level)
+        sumDist += static_cast<double>(level) * (levelBegin[level + 1] - levelBegin[level]);
+
+    if (storePaths) {
+        previous.clear();
+        previous.resize(z);
+        npaths.clear();
+        npaths.resize(z, 0);
+        npaths[source] = 1;
+
+        // Levels are processed in order so that npaths of all predecessors is final.
+        for (count level = 1; level + 1 < levelBegin.size(); ++level) {
+#pragma omp parallel for schedule(guided)
+            for (omp_index i = levelBegin[level]; i < static_cast<omp_index>(levelBegin[level + 1]);
+                 ++i) {
+                const node v = order[i];
+                G->forInNeighborsOf(v, [&](node u) {
+                    if (distances[u] + 1. == distances[v]) {
+                        previous[v].push_back(u);
+                        npaths[v] += npaths[u];
+                    }
+                });
+            }
+        }
+    }
+
+    if (storeNodesSortedByDistance)
+        nodesSortedByDistance = std::move(order);
+
+    hasRun = true;
+}
+} // namespace NetworKit
@@ -1,19 +1,28 @@
 #include <algorithm>
-#include <queue>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <type_traits>
 #include <vector>
+#include <omp.h>
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/distance/PrunedLandmarkLabeling.hpp>
+#include <networkit/distance/PrunedLandmarkLabelingIndex.hpp>
+#include <networkit/distance/PrunedLandmarkLabelingQueries.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
 
-PrunedLandmarkLabeling::PrunedLandmarkLabeling(const Graph &G)
-    : G(&G), nodesSortedByDegreeDesc(G.nodeRange().begin(), G.nodeRange().end()) {
+PrunedLandmarkLabeling::PrunedLandmarkLabeling(const Graph &G, count bitParallelRoots)
+    : G(&G), nodesSortedByDegreeDesc(G.nodeRange().begin(), G.nodeRange().end()),
+      bitParallelRoots(G.isDirected() ? 0 : bitParallelRoots) {
 
     if (G.isWeighted())
         WARN("This algorithm ignores edge weights.");
+    if (G.isDirected() && bitParallelRoots)
+        WARN("Bit-parallel searches are only supported for undirected graphs.");
 
     if (G.isDirected())
         Aux::Parallel::sort(nodesSortedByDegreeDesc.begin(), nodesSortedByDegreeDesc.end(),
@@ -26,81 +35,312 @@ PrunedLandmarkLabeling::PrunedLandmarkLabeling(const Graph &G)
     else
         Aux::Parallel::sort(nodesSortedByDegreeDesc.begin(), nodesSortedByDegreeDesc.end(),
                             [&G](node u, node v) { return G.degree(u) > G.degree(v); });
-
-    visited.resize(G.upperNodeIdBound());
-
-    labelsOut.resize(G.upperNodeIdBound());
-    if (G.isDirected())
-        labelsIn.resize(G.upperNodeIdBound());
-
-    labelsUCopy.reserve(G.upperNodeIdBound());
-    labelsVCopy.reserve(G.upperNodeIdBound());
 }
 
 template <bool Reverse>
-void PrunedLandmarkLabeling::prunedBFS(node root, node rankOfRootNode) {
-    std::fill(visited.begin(), visited.end(), false);
-    visited[root] = true;
+void PrunedLandmarkLabeling::prunedBFS(node root, SearchState &state) const {
+    // Labels of the root, i.e., hubs h with distance root -> h (or h -> root if Reverse).
+    const auto &rootLabels =
+        G->isDirected() ? (Reverse ? labelsOut[root] : labelsIn[root]) : labelsOut[root];
+    for (const auto &label : rootLabels)
+        state.rootLabelDistance[label.node_] = label.distance_;
 
-    std::queue<node> q1, q2;
-    q1.push(root);
+    auto &queue = state.queue;
+    queue.assign(1, root);
+    state.visited[root] = true;
+    state.newLabels.clear();
 
-    index level = 0;
-
-    const auto visitNeighbor = [&](node v) -> void {
-        if (visited[v])
-            return;
-        visited[v] = true;
-        q2.push(v);
-    };
-
-    do {
-        do {
-            const node u = q1.front();
-            q1.pop();
-            if constexpr (Reverse) {
-                if (u != root && queryImpl(u, root) <= level)
+    index levelBegin = 0;
+    for (count level = 0; levelBegin < queue.size(); ++level) {
+        const index levelEnd = queue.size();
+        for (index i = levelBegin; i < levelEnd; ++i) {
+            const node u = queue[i];
+            if (u != root) {
+                if (bitParallelRoots && bitParallelQuery(root, u) <= level)
                     continue;
-            } else {
-                if (u != root && queryImpl(root, u) <= level)
+                const auto &labelsU = Reverse ? labelsIn[u] : labelsOut[u];
+                bool pruned = false;
+                for (const auto &label : labelsU) {
+                    const count dist = state.rootLabelDistance[label.node_];
+                    if (dist != infDist && dist + label.distance_ <= level) {
+                        pruned = true;
+                        break;
+                    }
+                }
+                if (pruned)
                     continue;
             }
 
-            if constexpr (Reverse) {
-                labelsIn[u].emplace_back(rankOfRootNode, level);
+            state.newLabels.emplace_back(u, level);
+            const auto visitNeighbor = [&](node v) -> void {
+                if (state.visited[v])
+                    return;
+                state.visited[v] = true;
+                queue.push_back(v);
+            };
+            if constexpr (Reverse)
                 G->forInNeighborsOf(u, visitNeighbor);
-            } else {
-                labelsOut[u].emplace_back(rankOfRootNode, level);
+            else
                 G->forNeighborsOf(u, visitNeighbor);
+        }
+        levelBegin = levelEnd;
+    }
+
+    for (const node u : queue)
+        state.visited[u] = false;
+    for (const auto &label : rootLabels)
+        state.rootLabelDistance[label.node_] = infDist;
+}
+
+std::vector<uint8_t> PrunedLandmarkLabeling::bitParallelBFS() {
+    const count z = G->upperNodeIdBound();
+    std::vector<uint8_t> covered(z, false);
+    bitParallelLabels.assign(z * bitParallelRoots, BitParallelLabel{});
+
+    // Select the roots and their neighbors sequentially in the order of the pruned searches.
+    std::vector<std::vector<node>> selected(bitParallelRoots);
+    auto nextRoot = nodesSortedByDegreeDesc.begin();
+    for (auto &roots : selected) {
+        while (nextRoot != nodesSortedByDegreeDesc.end() && covered[*nextRoot])
+            ++nextRoot;
+        if (nextRoot == nodesSortedByDegreeDesc.end())
+            break;
+        const node root = *nextRoot;
+        covered[root] = true;
+        roots.push_back(root);
+        for (const node v : G->neighborRange(root)) {
+            if (roots.size() > 64)
+                break;
+            if (!covered[v]) {
+                covered[v] = true;
+                roots.push_back(v);
             }
+        }
+    }
 
-        } while (!q1.empty());
+#pragma omp parallel
+    {
+        std::vector<count> dist(z, infDist);
+        std::vector<std::pair<uint64_t, uint64_t>> sets(z);
+        std::vector<node> queue;
+        std::vector<std::pair<node, node>> siblingEdges, childEdges;
 
-        ++level;
-        std::swap(q1, q2);
-    } while (!q1.empty());
+#pragma omp for schedule(dynamic, 1)
+        for (omp_index i = 0; i < static_cast<omp_index>(bitParallelRoots); ++i) {
+            const auto &roots = selected[i];
+            if (roots.empty())
+                continue;
+
+            std::fill(dist.begin(), dist.end(), infDist);
+            std::fill(sets.begin(), sets.end(), std::make_pair(uint64_t{0}, uint64_t{0}));
+            queue.assign(1, roots[0]);
+            dist[roots[0]] = 0;
+            for (index j = 1; j < roots.size(); ++j) {
+                queue.push_back(roots[j]);
+                dist[roots[j]] = 1;
+                sets[roots[j]].first = uint64_t{1} << (j - 1);
+            }
+
+            index levelBegin = 0, levelEnd = 1;
+            for (count level = 0; levelBegin < queue.size(); ++level) {
+                siblingEdges.clear();
+                childEdges.clear();
+                for (index k = levelBegin; k < levelEnd; ++k) {
+                    const node v = queue[k];
+                    G->forNeighborsOf(v, [&](node w) {
+                        if (dist[w] == level) {
+                            if (v < w)
+                                siblingEdges.emplace_back(v, w);
+                        } else if (dist[w] > level) {
+                            if (dist[w] == infDist) {
+                                dist[w] = level + 1;
+                                queue.push_back(w);
+                            }
+                            childEdges.emplace_back(v, w);
+                        }
+                    });
+                }
+                for (const auto &[v, w] : siblingEdges) {
+                    sets[v].second |= sets[w].first;
+                    sets[w].second |= sets[v].first;
+                }
+                for (const auto &[v, c] : childEdges) {
+                    sets[c].first |= sets[v].first;
+                    sets[c].second |= sets[v].second;
+                }
+                levelBegin = levelEnd;
+                levelEnd = queue.size();
+            }
+
+            for (const node v : queue)
+                bitParallelLabels[v * bitParallelRoots + i] = {
+                    dist[v], sets[v].first, sets[v].second & ~sets[v].first};
+        }
+    }
+
+    return covered;
+}
+
+count PrunedLandmarkLabeling::bitParallelQuery(node u, node v) const {
+    return PrunedLandmarkLabelingQueries::bitParallelDistance(
+        bitParallelLabels.data() + u * bitParallelRoots,
+        bitParallelLabels.data() + v * bitParallelRoots, bitParallelRoots);
 }
 
 void PrunedLandmarkLabeling::run() {
-    index rankOfRootNode = 0;
-    for (node root : nodesSortedByDegreeDesc) {
-        prunedBFS(root, rankOfRootNode);
+    const count z = G->upperNodeIdBound();
+    labelsOut.assign(z, {});
+    labelsIn.assign(G->isDirected() ? z : 0, {});
+    std::vector<uint8_t> covered =
+        bitParallelRoots ? bitParallelBFS() : std::vector<uint8_t>(z, false);
+
+    std::vector<SearchState> states(omp_get_max_threads());
+    for (auto &state : states) {
+        state.visited.assign(z, false);
+        state.rootLabelDistance.assign(nodesSortedByDegreeDesc.size(), infDist);
+    }
+
+    // The searches of the first roots prune the most, so batches start small.
+    const count maxBatchSize = 4 * static_cast<count>(omp_get_max_threads());
+    std::vector<std::vector<Label>> batchLabels;
+
+    auto runBatch = [&](index first, index last, auto reverse) {
+        constexpr bool Reverse = decltype(reverse)::value;
+        batchLabels.resize(last - first);
+#pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index rank = first; rank < static_cast<omp_index>(last); ++rank) {
+            auto &labels = batchLabels[rank - first];
+            labels.clear();
+            const node root = nodesSortedByDegreeDesc[rank];
+            if (covered[root])
+                continue;
+            auto &state = states[omp_get_thread_num()];
+            prunedBFS<Reverse>(root, state);
+            labels.swap(state.newLabels);
+        }
+
+        // Appending in rank order keeps the labels of every node sorted.
+        for (index rank = first; rank < last; ++rank)
+            for (const auto &label : batchLabels[rank - first])
+                (Reverse ? labelsIn : labelsOut)[label.node_].emplace_back(rank,
+                                                                          label.distance_);
+    };
+
+    for (index first = 0, batchSize = 1; first < nodesSortedByDegreeDesc.size();
+         first += batchSize, batchSize = std::min(2 * batchSize, maxBatchSize)) {
+        const index last = std::min(first + batchSize, nodesSortedByDegreeDesc.size());
+        runBatch(first, last, std::false_type{});
         if (G->isDirected())
-            prunedBFS<true>(root, rankOfRootNode);
-        ++rankOfRootNode;
+            runBatch(first, last, std::true_type{});
     }
 
+    if (compactLabels)
+        compact();
     hasRun = true;
 }
 
+void PrunedLandmarkLabeling::compact() {
+    const count z = G->upperNodeIdBound();
+    auto compactDirection = [z](std::vector<std::vector<Label>> &labels,
+                                std::vector<index> &offsets, std::vector<Label> &flat) {
+        offsets.assign(z + 1, 0);
+        for (node u = 0; u < z; ++u)
+            offsets[u + 1] = offsets[u] + labels[u].size();
+
+        flat.resize(offsets[z]);
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            std::copy(labels[u].begin(), labels[u].end(), flat.begin() + offsets[u]);
+            std::vector<Label>().swap(labels[u]);
+        }
+        std::vector<std::vector<Label>>().swap(labels);
+    };
+
+    compactDirection(labelsOut, flatOffsetsOut, flatLabelsOut);
+    if (G->isDirected())
+        compactDirection(labelsIn, flatOffsetsIn, flatLabelsIn);
+}
+
+void PrunedLandmarkLabeling::writeIndex(const std::string &path) const {
+    assureFinished();
+    using Index = PrunedLandmarkLabelingIndex;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        throw std::runtime_error("Unable to open " + path);
+
+    auto countLabels = [&](bool in) -> uint64_t {
+        uint64_t total = 0;
+        for (node u = 0; u < G->upperNodeIdBound(); ++u) {
+            const auto [begin, end] = labelRange(u, in);
+            total += end - begin;
+        }
+        return total;
+    };
+
+    const uint64_t z = G->upperNodeIdBound();
+    Index::Header header{};
+    std::copy(std::begin(Index::magic), std::end(Index::magic), header.magic);
+    header.nodes = z;
+    header.directed = G->isDirected();
+    header.bitParallelRoots = bitParallelRoots;
+    header.numLabelsOut = countLabels(false);
+    header.numLabelsIn = G->isDirected() ? countLabels(true) : 0;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    std::vector<Index::BitParallelLabel> bitParallelBuffer(bitParallelLabels.size());
+    std::transform(bitParallelLabels.begin(), bitParallelLabels.end(), bitParallelBuffer.begin(),
+                   [](const BitParallelLabel &label) -> Index::BitParallelLabel {
+                       return {label.distance, label.setMinusOne, label.setZero};
+                   });
+    file.write(reinterpret_cast<const char *>(bitParallelBuffer.data()),
+               bitParallelBuffer.size() * sizeof(Index::BitParallelLabel));
+
+    auto writeLabels = [&](bool in) {
+        std::vector<uint64_t> offsets(z + 1, 0);
+        for (index u = 0; u < z; ++u) {
+            const auto [begin, end] = labelRange(u, in);
+            offsets[u + 1] = offsets[u] + (end - begin);
+        }
+        file.write(reinterpret_cast<const char *>(offsets.data()),
+                   offsets.size() * sizeof(uint64_t));
+
+        std::vector<Index::Label> buffer;
+        for (index u = 0; u < z; ++u) {
+            const auto [begin, end] = labelRange(u, in);
+            buffer.clear();
+            for (const Label *label = begin; label != end; ++label)
+                buffer.push_back({label->node_, label->distance_});
+            file.write(reinterpret_cast<const char *>(buffer.data()),
+                       buffer.size() * sizeof(Index::Label));
+        }
+    };
+
+    writeLabels(false);
+    if (G->isDirected())
+        writeLabels(true);
+
+    if (!file)
+        throw std::runtime_error("Error while writing " + path);
+}
+
 count PrunedLandmarkLabeling::queryImpl(node u, node v, node upperBound) const {
     if (u == v)
         return 0;
 
-    auto [iterLabelsU, iterLabelsUEnd] = getSourceLabelsIterators(u, G->isDirected());
-    auto [iterLabelsV, iterLabelsVEnd] = getSourceLabelsIterators(v);
+    auto [iterLabelsU, iterLabelsUEnd] = labelRange(u, G->isDirected());
+    auto [iterLabelsV, iterLabelsVEnd] = labelRange(v);
+
+    count result = bitParallelRoots ? bitParallelQuery(u, v) : infDist;
 
-    count result = infDist;
+    if (upperBound == none) {
+        static_assert(sizeof(Label) == 2 * sizeof(uint64_t), "Labels are (hub, distance) pairs");
+        return std::min(result, PrunedLandmarkLabelingQueries::mergeLabels(
+                                    reinterpret_cast<const uint64_t *>(iterLabelsU),
+                                    iterLabelsUEnd - iterLabelsU,
+                                    reinterpret_cast<const uint64_t *>(iterLabelsV),
+                                    iterLabelsVEnd - iterLabelsV));
+    }
 
     while (iterLabelsU != iterLabelsUEnd && iterLabelsV != iterLabelsVEnd) {
         if (std::max(iterLabelsU->node_, iterLabelsV->node_) > upperBound)
@@ -125,4 +365,14 @@ count PrunedLandmarkLabeling::query(node u, node v) const {
     return queryImpl(u, v);
 }
 
+std::vector<count>
+PrunedLandmarkLabeling::queryBatch(const std::vector<std::pair<node, node>> &pairs) const {
+    assureFinished();
+    std::vector<count> result(pairs.size());
+#pragma omp parallel for schedule(guided)
+    for (omp_index i = 0; i < static_cast<omp_index>(pairs.size()); ++i)
+        result[i] = queryImpl(pairs[i].first, pairs[i].second);
+    return result;
+}
+
 } // namespace NetworKit
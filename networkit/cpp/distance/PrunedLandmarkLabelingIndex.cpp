@@ -0,0 +1,88 @@
+/*
+ * PrunedLandmarkLabelingIndex.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <networkit/distance/PrunedLandmarkLabelingIndex.hpp>
+#include <networkit/distance/PrunedLandmarkLabelingQueries.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Returns a pointer to @a entries objects of type T at @a offset and advances the offset.
+template <typename T>
+const T *takeSection(const MemoryMappedFile &file, size_t &offset, uint64_t entries,
+                     const std::string &path) {
+    const size_t available = (file.size() - offset) / sizeof(T);
+    if (entries > available)
+        throw std::runtime_error("PrunedLandmarkLabelingIndex: " + path + " is truncated");
+    const T *section = reinterpret_cast<const T *>(file.cbegin() + offset);
+    offset += entries * sizeof(T);
+    return section;
+}
+
+void checkOffsets(const uint64_t *offsets, uint64_t nodes, uint64_t numLabels,
+                  const std::string &path) {
+    if (offsets[0] != 0 || offsets[nodes] != numLabels
+        || !std::is_sorted(offsets, offsets + nodes + 1))
+        throw std::runtime_error("PrunedLandmarkLabelingIndex: invalid label offsets in " + path);
+}
+
+} // namespace
+
+PrunedLandmarkLabelingIndex::PrunedLandmarkLabelingIndex(const std::string &path)
+    : file(path), offsetsIn(nullptr), labelsIn(nullptr) {
+    if (file.size() < sizeof(Header))
+        throw std::runtime_error("PrunedLandmarkLabelingIndex: " + path + " is truncated");
+    header = reinterpret_cast<const Header *>(file.cbegin());
+    if (std::memcmp(header->magic, magic, sizeof(magic)) != 0)
+        throw std::runtime_error("PrunedLandmarkLabelingIndex: " + path
+                                 + " is not a pruned landmark labeling index");
+
+    const uint64_t n = header->nodes, roots = header->bitParallelRoots;
+    if (n >= file.size() || (roots && n > std::numeric_limits<uint64_t>::max() / roots))
+        throw std::runtime_error("PrunedLandmarkLabelingIndex: " + path + " is truncated");
+
+    size_t offset = sizeof(Header);
+    bitParallelLabels = takeSection<BitParallelLabel>(file, offset, n * roots, path);
+    offsetsOut = takeSection<uint64_t>(file, offset, n + 1, path);
+    labelsOut = takeSection<Label>(file, offset, header->numLabelsOut, path);
+    checkOffsets(offsetsOut, n, header->numLabelsOut, path);
+    if (header->directed) {
+        offsetsIn = takeSection<uint64_t>(file, offset, n + 1, path);
+        labelsIn = takeSection<Label>(file, offset, header->numLabelsIn, path);
+        checkOffsets(offsetsIn, n, header->numLabelsIn, path);
+    }
+}
+
+count PrunedLandmarkLabelingIndex::bitParallelQuery(node u, node v) const {
+    const count roots = header->bitParallelRoots;
+    return PrunedLandmarkLabelingQueries::bitParallelDistance(bitParallelLabels + u * roots,
+                                                              bitParallelLabels + v * roots, roots);
+}
+
+count PrunedLandmarkLabelingIndex::query(node u, node v) const {
+    if (u >= header->nodes || v >= header->nodes)
+        throw std::runtime_error("PrunedLandmarkLabelingIndex: node out of range");
+    if (u == v)
+        return 0;
+
+    const count result = header->bitParallelRoots ? bitParallelQuery(u, v) : infDist;
+
+    const uint64_t *offsetsU = header->directed ? offsetsIn : offsetsOut;
+    const Label *labelsU = header->directed ? labelsIn : labelsOut;
+    static_assert(sizeof(Label) == 2 * sizeof(uint64_t), "Labels must be (hub, distance) pairs");
+    return std::min(result, PrunedLandmarkLabelingQueries::mergeLabels(
+                                reinterpret_cast<const uint64_t *>(labelsU + offsetsU[u]),
+                                offsetsU[u + 1] - offsetsU[u],
+                                reinterpret_cast<const uint64_t *>(labelsOut + offsetsOut[v]),
+                                offsetsOut[v + 1] - offsetsOut[v]));
+}
+
+} // namespace NetworKit
@@ -0,0 +1,127 @@
+/*
+ * PrunedLandmarkLabelingQueries.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <networkit/distance/PrunedLandmarkLabelingQueries.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define NETWORKIT_PLL_AVX2_MERGE
+#include <immintrin.h>
+#endif
+
+namespace NetworKit {
+
+namespace PrunedLandmarkLabelingQueries {
+
+namespace {
+
+// Merges the remaining labels of both lists; labels are (hub, distance) pairs.
+count mergeTail(const uint64_t *iterU, const uint64_t *endU, const uint64_t *iterV,
+                const uint64_t *endV, count result) {
+    while (iterU != endU && iterV != endV) {
+        if (iterU[0] < iterV[0])
+            iterU += 2;
+        else if (iterV[0] < iterU[0])
+            iterV += 2;
+        else {
+            result = std::min<count>(result, iterU[1] + iterV[1]);
+            iterU += 2;
+            iterV += 2;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+count mergeLabelsScalar(const uint64_t *labelsU, count sizeU, const uint64_t *labelsV,
+                        count sizeV) {
+    return mergeTail(labelsU, labelsU + 2 * sizeU, labelsV, labelsV + 2 * sizeV,
+                     std::numeric_limits<count>::max());
+}
+
+#ifdef NETWORKIT_PLL_AVX2_MERGE
+
+namespace {
+
+// Splits four consecutive labels into hubs and distances (in the lane order 0, 2, 1, 3).
+__attribute__((target("avx2"))) inline void loadBlock(const uint64_t *labels, __m256i &hubs,
+                                                      __m256i &distances) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(labels));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(labels + 4));
+    hubs = _mm256_unpacklo_epi64(lo, hi);
+    distances = _mm256_unpackhi_epi64(lo, hi);
+}
+
+} // namespace
+
+// Compiled for AVX2 regardless of the compiler flags; only called if the CPU supports AVX2.
+__attribute__((target("avx2"))) count mergeLabelsAVX2(const uint64_t *labelsU, count sizeU,
+                                                      const uint64_t *labelsV, count sizeV) {
+    const uint64_t *iterU = labelsU, *endU = labelsU + 2 * sizeU;
+    const uint64_t *iterV = labelsV, *endV = labelsV + 2 * sizeV;
+
+    // Blocks of four labels are compared all-to-all by rotating one of the blocks; the block with
+    // the smaller last hub cannot match any later label of the other list and is skipped.
+    const __m256i noMatch = _mm256_set1_epi64x(std::numeric_limits<int64_t>::max());
+    __m256i best = noMatch;
+
+    while (endU - iterU >= 8 && endV - iterV >= 8) {
+        __m256i hubsU, distancesU, hubsV, distancesV;
+        loadBlock(iterU, hubsU, distancesU);
+        loadBlock(iterV, hubsV, distancesV);
+        for (int rotation = 0; rotation < 4; ++rotation) {
+            const __m256i match = _mm256_cmpeq_epi64(hubsU, hubsV);
+            const __m256i candidate = _mm256_blendv_epi8(
+                noMatch, _mm256_add_epi64(distancesU, distancesV), match);
+            best = _mm256_blendv_epi8(best, candidate, _mm256_cmpgt_epi64(best, candidate));
+            hubsV = _mm256_permute4x64_epi64(hubsV, _MM_SHUFFLE(0, 3, 2, 1));
+            distancesV = _mm256_permute4x64_epi64(distancesV, _MM_SHUFFLE(0, 3, 2, 1));
+        }
+
+        const uint64_t lastU = iterU[6], lastV = iterV[6];
+        if (lastU <= lastV)
+            iterU += 8;
+        if (lastV <= lastU)
+            iterV += 8;
+    }
+
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), best);
+    count result = std::numeric_limits<count>::max();
+    for (const int64_t lane : lanes)
+        if (lane != std::numeric_limits<int64_t>::max())
+            result = std::min(result, static_cast<count>(lane));
+
+    return mergeTail(iterU, endU, iterV, endV, result);
+}
+
+bool hasAVX2Merge() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#else
+
+count mergeLabelsAVX2(const uint64_t *labelsU, count sizeU, const uint64_t *labelsV,
+                      count sizeV) {
+    return mergeLabelsScalar(labelsU, sizeU, labelsV, sizeV);
+}
+
+bool hasAVX2Merge() {
+    return false;
+}
+
+#endif // NETWORKIT_PLL_AVX2_MERGE
+
+count mergeLabels(const uint64_t *labelsU, count sizeU, const uint64_t *labelsV, count sizeV) {
+    static const bool useAVX2 = hasAVX2Merge();
+    return useAVX2 ? mergeLabelsAVX2(labelsU, sizeU, labelsV, sizeV)
+                   : mergeLabelsScalar(labelsU, sizeU, labelsV, sizeV);
+}
+
+} // namespace PrunedLandmarkLabelingQueries
+
+} // namespace NetworKit
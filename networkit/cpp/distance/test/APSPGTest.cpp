@@ -5,6 +5,7 @@
  *      Author: Arie Slobbe, Elisabetta Bergamini
  */
 
+#include <atomic>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -13,6 +14,7 @@
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/distance/APSP.hpp>
 #include <networkit/distance/BFS.hpp>
+#include <networkit/distance/CompactAPSP.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/DynAPSP.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
@@ -428,4 +430,75 @@ TEST_F(APSPGTest, testAPSPEventTypeError) {
     EXPECT_ANY_THROW(apsp.update(event3));
 }
 
+TEST_F(APSPGTest, testAPSPStreamRows) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.02, true).generate();
+    G.removeNode(3);
+
+    APSP apsp(G);
+    apsp.run();
+    const auto expected = apsp.getDistances();
+
+    std::vector<std::atomic<bool>> seen(G.upperNodeIdBound());
+    APSP streamed(G);
+    streamed.streamRows([&](node source, const std::vector<edgeweight> &row) {
+        EXPECT_FALSE(seen[source].exchange(true));
+        G.forNodes([&](node v) { EXPECT_EQ(row[v], expected[source][v]); });
+    });
+    G.forNodes([&](node u) { EXPECT_TRUE(seen[u]); });
+    EXPECT_FALSE(seen[3]);
+}
+
+TEST_F(APSPGTest, testCompactAPSP) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.02).generate();
+    G.removeNode(3);
+
+    APSP apsp(G);
+    apsp.run();
+
+    auto check = [&](const auto &compact) {
+        using DistanceType = std::remove_cv_t<std::remove_pointer_t<decltype(compact.getRow(0))>>;
+        G.forNodes([&](node u) {
+            G.forNodes([&](node v) {
+                const edgeweight expected = apsp.getDistance(u, v);
+                if (expected == std::numeric_limits<edgeweight>::max())
+                    EXPECT_EQ(compact.getDistance(u, v), CompactAPSP<DistanceType>::infDist);
+                else
+                    EXPECT_EQ(compact.getDistance(u, v), static_cast<DistanceType>(expected));
+            });
+        });
+    };
+
+    CompactAPSP<uint8_t> inMemory(G);
+    inMemory.run();
+    check(inMemory);
+
+    CompactAPSP<uint16_t> onDisk(G, "output/compactAPSP.bin");
+    onDisk.run();
+    check(onDisk);
+
+    Graph weighted = GraphTools::toWeighted(G);
+    weighted.forEdges([&](node u, node v) { weighted.setWeight(u, v, 0.5); });
+    EXPECT_THROW(CompactAPSP<uint8_t>{weighted}, std::runtime_error);
+    CompactAPSP<float> floats(weighted);
+    floats.run();
+    G.forNodes([&](node u) {
+        G.forNodes([&](node v) {
+            if (apsp.getDistance(u, v) != std::numeric_limits<edgeweight>::max()) {
+                EXPECT_FLOAT_EQ(floats.getDistance(u, v), 0.5 * apsp.getDistance(u, v));
+            }
+        });
+    });
+}
+
+TEST_F(APSPGTest, testCompactAPSPOverflow) {
+    // the path has a diameter of 299, which does not fit into uint8_t
+    Graph G(300);
+    for (node u = 0; u + 1 < 300; ++u)
+        G.addEdge(u, u + 1);
+    CompactAPSP<uint8_t> apsp(G);
+    EXPECT_THROW(apsp.run(), std::runtime_error);
+}
+
 } /* namespace NetworKit */
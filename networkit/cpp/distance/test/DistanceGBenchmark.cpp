@@ -0,0 +1,59 @@
+/*
+ * DistanceGBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <networkit/distance/BFS.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
+#include <networkit/distance/Dijkstra.hpp>
+#include <networkit/distance/ParallelBFS.hpp>
+
+#include "../../BenchmarkGraphs.hpp"
+
+namespace NetworKit {
+
+namespace {
+
+using BenchmarkGraphs::erdosRenyi;
+using BenchmarkGraphs::graphSizes;
+
+template <class Algorithm>
+void runSSSP(benchmark::State &state, bool weighted) {
+    const Graph &G = erdosRenyi(state.range(0), weighted);
+    node source = 0;
+    for (auto _ : state) {
+        Algorithm algo(G, source, false);
+        algo.run();
+        benchmark::DoNotOptimize(algo.getReachableNodes());
+        source = (source + 1) % G.upperNodeIdBound();
+    }
+    state.SetItemsProcessed(state.iterations() * G.numberOfEdges());
+}
+
+void BM_BFS(benchmark::State &state) {
+    runSSSP<BFS>(state, false);
+}
+
+void BM_ParallelBFS(benchmark::State &state) {
+    runSSSP<ParallelBFS>(state, false);
+}
+
+void BM_Dijkstra(benchmark::State &state) {
+    runSSSP<Dijkstra>(state, true);
+}
+
+void BM_DeltaStepping(benchmark::State &state) {
+    runSSSP<DeltaStepping>(state, true);
+}
+
+} // namespace
+
+BENCHMARK(BM_BFS)->Apply(graphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelBFS)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Dijkstra)->Apply(graphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeltaStepping)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace NetworKit
@@ -26,6 +26,8 @@
 #include <networkit/distance/NeighborhoodFunctionApproximation.hpp>
 #include <networkit/distance/NeighborhoodFunctionHeuristic.hpp>
 #include <networkit/distance/PrunedLandmarkLabeling.hpp>
+#include <networkit/distance/PrunedLandmarkLabelingIndex.hpp>
+#include <networkit/distance/PrunedLandmarkLabelingQueries.hpp>
 #include <networkit/distance/SPSP.hpp>
 
 #include <networkit/generators/DorogovtsevMendesGenerator.hpp>
@@ -612,6 +614,102 @@ TEST_P(DistanceGTest, testPrunedLandmarkLabeling) {
     });
 }
 
+TEST_P(DistanceGTest, testPrunedLandmarkLabelingBitParallel) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator{300, 0.02, isDirected()}.generate();
+    PrunedLandmarkLabeling pll(G, 16);
+    pll.run();
+
+    APSP apsp(G);
+    apsp.run();
+
+    G.forNodes([&](node u) {
+        G.forNodes([&](node v) {
+            const double distUV = apsp.getDistance(u, v);
+            if (distUV == infdist)
+                EXPECT_EQ(pll.query(u, v), std::numeric_limits<count>::max());
+            else
+                EXPECT_EQ(pll.query(u, v), distUV);
+        });
+    });
+}
+
+TEST_P(DistanceGTest, testPrunedLandmarkLabelingQueryBatch) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator{300, 0.02, isDirected()}.generate();
+    PrunedLandmarkLabeling pll(G);
+    pll.run();
+
+    std::vector<std::pair<node, node>> pairs;
+    G.forNodes([&](node u) { G.forNodes([&](node v) { pairs.emplace_back(u, v); }); });
+    const auto distances = pll.queryBatch(pairs);
+
+    APSP apsp(G);
+    apsp.run();
+
+    ASSERT_EQ(distances.size(), pairs.size());
+    for (index i = 0; i < pairs.size(); ++i) {
+        const double dist = apsp.getDistance(pairs[i].first, pairs[i].second);
+        if (dist == infdist)
+            EXPECT_EQ(distances[i], std::numeric_limits<count>::max());
+        else
+            EXPECT_EQ(distances[i], dist);
+    }
+}
+
+TEST_P(DistanceGTest, testPrunedLandmarkLabelingIndex) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator{300, 0.02, isDirected()}.generate();
+    G.removeNode(7);
+    PrunedLandmarkLabeling pll(G, 4);
+    pll.run();
+
+    const std::string path = "output/pll.idx";
+    pll.writeIndex(path);
+    PrunedLandmarkLabelingIndex index(path);
+    EXPECT_EQ(index.upperNodeIdBound(), G.upperNodeIdBound());
+
+    G.forNodes([&](node u) {
+        G.forNodes([&](node v) { EXPECT_EQ(index.query(u, v), pll.query(u, v)); });
+    });
+    EXPECT_THROW(index.query(0, G.upperNodeIdBound()), std::runtime_error);
+
+    EXPECT_THROW(PrunedLandmarkLabelingIndex("input/jazz.graph"), std::runtime_error);
+}
+
+TEST_F(DistanceGTest, testPrunedLandmarkLabelingMergeKernels) {
+    namespace Queries = PrunedLandmarkLabelingQueries;
+    if (!Queries::hasAVX2Merge())
+        GTEST_SKIP() << "The CPU does not support AVX2";
+
+    Aux::Random::setSeed(42, false);
+    // Returns up to maxSize labels with distinct, sorted hubs below 64.
+    auto randomLabels = [](count maxSize) {
+        std::vector<uint64_t> labels;
+        for (uint64_t hub = 0; hub < 64 && labels.size() < 2 * maxSize; ++hub)
+            if (Aux::Random::probability() < 0.4) {
+                labels.push_back(hub);
+                labels.push_back(Aux::Random::integer(1, 20));
+            }
+        return labels;
+    };
+
+    for (count size : {0, 1, 3, 4, 5, 8, 9, 17, 40}) {
+        for (index trial = 0; trial < 50; ++trial) {
+            const auto labelsU = randomLabels(size), labelsV = randomLabels(2 * size + 1);
+            const count sizeU = labelsU.size() / 2, sizeV = labelsV.size() / 2;
+            const count expected =
+                Queries::mergeLabelsScalar(labelsU.data(), sizeU, labelsV.data(), sizeV);
+            EXPECT_EQ(Queries::mergeLabelsAVX2(labelsU.data(), sizeU, labelsV.data(), sizeV),
+                      expected);
+            EXPECT_EQ(Queries::mergeLabelsAVX2(labelsV.data(), sizeV, labelsU.data(), sizeU),
+                      expected);
+            EXPECT_EQ(Queries::mergeLabels(labelsU.data(), sizeU, labelsV.data(), sizeV),
+                      expected);
+        }
+    }
+}
+
 TEST_P(DistanceGTest, testDynPrunedLandmarkLabelingThrowsWithEdgeRemoval) {
     Graph G(2, isWeighted(), isDirected());
     G.addEdge(0, 1);
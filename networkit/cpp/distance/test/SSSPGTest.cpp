@@ -7,13 +7,19 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <stack>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/distance/BFS.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/DynBFS.hpp>
 #include <networkit/distance/DynDijkstra.hpp>
+#include <networkit/distance/ParallelBFS.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 
 #include <tlx/unused.hpp>
@@ -194,4 +200,114 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
     EXPECT_EQ(sssp.distance(6), 1);
     EXPECT_EQ(sssp.distance(7), 3);
 }
+
+TEST_F(SSSPGTest, testParallelBFS) {
+    for (bool directed : {false, true}) {
+        // a dense graph triggers bottom-up steps, a sparse one does not
+        for (double p : {0.002, 0.05}) {
+            Aux::Random::setSeed(42, false);
+            Graph G = ErdosRenyiGenerator(2000, p, directed).generate();
+            G.removeNode(1);
+            const node source = 0;
+
+            BFS bfs(G, source, true, true);
+            bfs.run();
+            ParallelBFS pbfs(G, source, true, true);
+            pbfs.run();
+
+            EXPECT_EQ(pbfs.getReachableNodes(), bfs.getReachableNodes());
+            EXPECT_DOUBLE_EQ(pbfs.getSumOfDistances(), bfs.getSumOfDistances());
+            if (p > 0.01) {
+                EXPECT_GT(pbfs.getNumberOfBottomUpSteps(), 0);
+            }
+
+            G.forNodes([&](node u) {
+                EXPECT_EQ(pbfs.distance(u), bfs.distance(u));
+                EXPECT_EQ(pbfs.numberOfPaths(u), bfs.numberOfPaths(u));
+                auto expected = bfs.getPredecessors(u);
+                auto actual = pbfs.getPredecessors(u);
+                std::sort(expected.begin(), expected.end());
+                std::sort(actual.begin(), actual.end());
+                EXPECT_EQ(actual, expected);
+            });
+
+            const auto &sorted = pbfs.getNodesSortedByDistance();
+            EXPECT_EQ(sorted.size(), pbfs.getReachableNodes());
+            for (index i = 1; i < sorted.size(); ++i)
+                EXPECT_LE(pbfs.distance(sorted[i - 1]), pbfs.distance(sorted[i]));
+        }
+    }
+}
+
+TEST_F(SSSPGTest, testParallelBFSTarget) {
+    // path 0 - 1 - 2 - 3 - 4
+    Graph G(5);
+    for (node u = 0; u + 1 < 5; ++u)
+        G.addEdge(u, u + 1);
+
+    ParallelBFS pbfs(G, 0, false, false, 2);
+    pbfs.run();
+    EXPECT_EQ(pbfs.distance(2), 2);
+    EXPECT_EQ(pbfs.getReachableNodes(), 3);
+    EXPECT_EQ(pbfs.distance(4), std::numeric_limits<edgeweight>::max());
+}
+
+TEST_F(SSSPGTest, testDeltaStepping) {
+    for (bool directed : {false, true}) {
+        Aux::Random::setSeed(42, false);
+        Graph G = ErdosRenyiGenerator(1000, 0.01, directed).generate();
+        G = GraphTools::toWeighted(G);
+        // integral weights produce many shortest paths of equal length
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 10)); });
+        G.removeNode(1);
+
+        Dijkstra dijkstra(G, 0);
+        dijkstra.run();
+
+        for (edgeweight delta : {0., 1., 3.5, 100.}) {
+            DeltaStepping ds(G, 0, true, true, none, delta);
+            ds.run();
+            EXPECT_GT(ds.getDelta(), 0);
+            EXPECT_EQ(ds.getReachableNodes(), dijkstra.getReachableNodes());
+            EXPECT_DOUBLE_EQ(ds.getSumOfDistances(), dijkstra.getSumOfDistances());
+
+            G.forNodes([&](node u) {
+                EXPECT_EQ(ds.distance(u), dijkstra.distance(u));
+                EXPECT_EQ(ds.numberOfPaths(u), dijkstra.numberOfPaths(u));
+                auto expected = dijkstra.getPredecessors(u);
+                auto actual = ds.getPredecessors(u);
+                std::sort(expected.begin(), expected.end());
+                std::sort(actual.begin(), actual.end());
+                EXPECT_EQ(actual, expected);
+            });
+
+            const auto &sorted = ds.getNodesSortedByDistance();
+            EXPECT_EQ(sorted.size(), ds.getReachableNodes());
+            for (index i = 1; i < sorted.size(); ++i)
+                EXPECT_LE(ds.distance(sorted[i - 1]), ds.distance(sorted[i]));
+        }
+
+        DeltaStepping ds(G, 0, false, false, 42);
+        ds.run();
+        EXPECT_EQ(ds.distance(42), dijkstra.distance(42));
+    }
+}
+
+TEST_F(SSSPGTest, testDeltaSteppingLongPath) {
+    // the distances are far larger than the ring of buckets, which wraps around many times
+    Graph G(2000, true);
+    for (node u = 1; u < G.numberOfNodes(); ++u)
+        G.addEdge(u - 1, u, u % 2 ? 1. : 0.25);
+    G.addEdge(0, 1999, 600.);
+
+    DeltaStepping ds(G, 0, true, false, none, 0.1);
+    ds.run();
+    Dijkstra dijkstra(G, 0);
+    dijkstra.run();
+    G.forNodes([&](node u) {
+        EXPECT_DOUBLE_EQ(ds.distance(u), dijkstra.distance(u));
+        EXPECT_EQ(ds.numberOfPaths(u), dijkstra.numberOfPaths(u));
+    });
+}
+
 } // namespace NetworKit
@@ -0,0 +1,439 @@
+/*
+ * PushRelabel.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+#include <omp.h>
+
+#include <networkit/flow/PushRelabel.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Estimated work of a relabel operation in addition to scanning the arcs of the node, and the
+// number of nodes per unit of work after which the labels are recomputed (Cherkassky and
+// Goldberg, "On implementing the push-relabel method for the maximum flow problem", 1997).
+constexpr count relabelWork = 12;
+constexpr count globalRelabelFactor = 6;
+
+// Rounds with fewer active nodes are processed sequentially.
+constexpr count minParallelActive = 256;
+
+void atomicAdd(std::atomic<edgeweight> &target, edgeweight value) {
+    edgeweight old = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(old, old + value, std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<node> sortedUnique(std::vector<node> nodes) {
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    return nodes;
+}
+
+} // namespace
+
+PushRelabel::PushRelabel(const Graph &G, node source, node sink)
+    : PushRelabel(G, std::vector<node>{source}, std::vector<node>{sink}) {}
+
+PushRelabel::PushRelabel(const Graph &G, std::vector<node> sources, std::vector<node> sinks)
+    : G(&G), sources(sortedUnique(std::move(sources))), sinks(sortedUnique(std::move(sinks))) {
+    if (this->sources.empty() || this->sinks.empty())
+        throw std::runtime_error("Error: at least one source and one sink are required.");
+    for (const node u : this->sources)
+        if (!G.hasNode(u))
+            throw std::runtime_error("Error: a source is not in the graph.");
+    for (const node u : this->sinks)
+        if (!G.hasNode(u))
+            throw std::runtime_error("Error: a sink is not in the graph.");
+    if (std::find_first_of(this->sources.begin(), this->sources.end(), this->sinks.begin(),
+                           this->sinks.end())
+        != this->sources.end())
+        throw std::runtime_error("Error: a node must not be both a source and a sink.");
+}
+
+void PushRelabel::buildResidualNetwork() {
+    const count z = G->upperNodeIdBound();
+    const bool directed = G->isDirected();
+    // Each edge (u, v) yields a forward arc at u and a reverse arc at v.
+    auto isForward = [directed](node u, node v) { return directed ? u != v : v < u; };
+
+    std::vector<count> numForward(z, 0);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        stamp[u].store(0, std::memory_order_relaxed);
+
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        if (!G->hasNode(u))
+            continue;
+        G->forNeighborsOf(u, [&](node v) {
+            if (isForward(u, v)) {
+                ++numForward[u];
+                stamp[v].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    firstArc.assign(z + 1, 0);
+    firstReverseArc.resize(z);
+    for (node u = 0; u < z; ++u) {
+        firstReverseArc[u] = firstArc[u] + numForward[u];
+        firstArc[u + 1] = firstReverseArc[u] + stamp[u].load(std::memory_order_relaxed);
+        // from now on, stamp holds the next free reverse arc of u
+        stamp[u].store(firstReverseArc[u], std::memory_order_relaxed);
+    }
+
+    const count numArcs = firstArc[z];
+    head.resize(numArcs);
+    reverse.resize(numArcs);
+    residual.resize(numArcs);
+
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        if (!G->hasNode(u))
+            continue;
+        index a = firstArc[u];
+        G->forNeighborsOf(u, [&](node v, edgeweight w) {
+            if (!isForward(u, v))
+                return;
+            const index b = stamp[v].fetch_add(1, std::memory_order_relaxed);
+            head[a] = v;
+            head[b] = u;
+            reverse[a] = b;
+            reverse[b] = a;
+            residual[a] = w;
+            residual[b] = directed ? 0 : w;
+            ++a;
+        });
+    }
+
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        stamp[u].store(0, std::memory_order_relaxed);
+    epoch = 0;
+}
+
+void PushRelabel::run() {
+    const count z = G->upperNodeIdBound();
+    stamp = std::vector<std::atomic<index>>(z);
+    addedExcess = std::vector<std::atomic<edgeweight>>(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        addedExcess[u].store(0, std::memory_order_relaxed);
+    excess.assign(z, 0);
+
+    buildResidualNetwork();
+
+    std::vector<bool> isSource(z), isTerminal(z);
+    for (const node s : sources)
+        isSource[s] = isTerminal[s] = true;
+    for (const node t : sinks)
+        isTerminal[t] = true;
+
+    // Initial preflow: saturate all arcs leaving the sources.
+    for (const node s : sources) {
+        for (index a = firstArc[s]; a < firstArc[s + 1]; ++a) {
+            const node v = head[a];
+            if (isSource[v] || residual[a] <= 0)
+                continue;
+            excess[v] += residual[a];
+            residual[reverse[a]] += residual[a];
+            residual[a] = 0;
+        }
+    }
+
+    // Phase 1: compute a maximum preflow.
+    pushRelabel(sinks, isTerminal);
+    // Phase 2: return the excess of nodes that cannot reach a sink to the sources.
+    pushRelabel(sources, isTerminal);
+
+    flowValue = 0;
+    for (const node t : sinks)
+        flowValue += excess[t];
+
+    flow.clear();
+    if (G->hasEdgeIds()) {
+        flow.resize(G->upperEdgeIdBound(), 0);
+        const bool directed = G->isDirected();
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            if (!G->hasNode(u))
+                continue;
+            index a = firstArc[u];
+            G->forNeighborsOf(u, [&](node, node v, edgeweight, edgeid eid) {
+                if (directed ? u == v : v >= static_cast<node>(u))
+                    return;
+                flow[eid] = directed ? residual[reverse[a]]
+                                     : (residual[reverse[a]] - residual[a]) / 2;
+                ++a;
+            });
+        }
+    }
+
+    excess.clear();
+    excess.shrink_to_fit();
+    addedExcess.clear();
+    addedExcess.shrink_to_fit();
+    stamp.clear();
+    stamp.shrink_to_fit();
+
+    hasRun = true;
+}
+
+void PushRelabel::pushRelabel(const std::vector<node> &targets,
+                              const std::vector<bool> &isTerminal) {
+    const count z = G->upperNodeIdBound();
+    // Labels are lower bounds of the distance to the targets; nodes with label limit cannot
+    // reach any target.
+    const index limit = G->numberOfNodes();
+    const count numArcs = head.size();
+    const count maxThreads = omp_get_max_threads();
+
+    std::vector<index> label(z, limit);
+    std::vector<std::atomic<count>> labelCount(limit + 1);
+    std::vector<std::vector<node>> localNext(maxThreads), localRelabel(maxThreads);
+
+    // Returns true iff v was not marked since the epoch was incremented.
+    auto mark = [&](node v) -> bool {
+        return stamp[v].exchange(epoch, std::memory_order_relaxed) != epoch;
+    };
+
+    std::vector<node> active;
+    ++epoch;
+    G->forNodes([&](node v) {
+        if (!isTerminal[v] && excess[v] > 0 && mark(v))
+            active.push_back(v);
+    });
+
+    // Sets the labels to the exact distances to the targets in the residual network by a
+    // parallel breadth-first search.
+    auto globalRelabel = [&]() {
+        ++epoch;
+#pragma omp parallel for
+        for (omp_index v = 0; v < static_cast<omp_index>(z); ++v)
+            label[v] = limit;
+
+        std::vector<node> frontier;
+        for (const node t : targets) {
+            label[t] = 0;
+            mark(t);
+            frontier.push_back(t);
+        }
+
+        for (index level = 1; !frontier.empty(); ++level) {
+#pragma omp parallel if (frontier.size() >= minParallelActive)
+            {
+                auto &next = localNext[omp_get_thread_num()];
+#pragma omp for schedule(guided) nowait
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    const node w = frontier[i];
+                    for (index a = firstArc[w]; a < firstArc[w + 1]; ++a) {
+                        const node u = head[a];
+                        if (!isTerminal[u] && residual[reverse[a]] > 0 && mark(u)) {
+                            label[u] = level;
+                            next.push_back(u);
+                        }
+                    }
+                }
+            }
+            frontier.clear();
+            for (auto &next : localNext) {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+                next.clear();
+            }
+        }
+
+#pragma omp parallel for
+        for (omp_index k = 0; k <= static_cast<omp_index>(limit); ++k)
+            labelCount[k].store(0, std::memory_order_relaxed);
+#pragma omp parallel for
+        for (omp_index v = 0; v < static_cast<omp_index>(z); ++v)
+            if (label[v] < limit)
+                labelCount[label[v]].fetch_add(1, std::memory_order_relaxed);
+
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](node v) { return label[v] >= limit; }),
+                     active.end());
+    };
+
+    globalRelabel();
+    count work = 0;
+    std::vector<node> relabel;
+    std::vector<index> newLabel;
+
+    while (!active.empty()) {
+        ++epoch;
+
+        // Push: the labels do not change, so an arc (v, w) and its reverse arc are never
+        // admissible at the same time and each residual capacity is modified by one thread.
+#pragma omp parallel if (active.size() >= minParallelActive)
+        {
+            const index thread = omp_get_thread_num();
+            auto &next = localNext[thread];
+            auto &myRelabel = localRelabel[thread];
+#pragma omp for schedule(dynamic, 16) nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+                const node v = active[i];
+                const index d = label[v];
+                edgeweight e = excess[v];
+                for (index a = firstArc[v]; a < firstArc[v + 1] && e > 0; ++a) {
+                    const node w = head[a];
+                    if (label[w] + 1 != d || residual[a] <= 0)
+                        continue;
+                    const edgeweight delta = std::min(e, residual[a]);
+                    residual[a] -= delta;
+                    residual[reverse[a]] += delta;
+                    e -= delta;
+                    atomicAdd(addedExcess[w], delta);
+                    if (!isTerminal[w] && mark(w))
+                        next.push_back(w);
+                }
+                excess[v] = e;
+                if (e > 0)
+                    myRelabel.push_back(v);
+            }
+        }
+
+        relabel.clear();
+        for (auto &myRelabel : localRelabel) {
+            relabel.insert(relabel.end(), myRelabel.begin(), myRelabel.end());
+            myRelabel.clear();
+        }
+
+        // Relabel: all new labels are computed from the labels of the previous round, which
+        // keeps the labeling valid.
+        newLabel.resize(relabel.size());
+        count roundWork = 0;
+#pragma omp parallel for schedule(dynamic, 16) reduction(+ : roundWork) \
+    if (relabel.size() >= minParallelActive)
+        for (omp_index i = 0; i < static_cast<omp_index>(relabel.size()); ++i) {
+            const node v = relabel[i];
+            index minLabel = limit;
+            for (index a = firstArc[v]; a < firstArc[v + 1]; ++a)
+                if (residual[a] > 0)
+                    minLabel = std::min(minLabel, label[head[a]] + 1);
+            newLabel[i] = std::min(minLabel, limit);
+            roundWork += relabelWork + firstArc[v + 1] - firstArc[v];
+        }
+        work += roundWork;
+
+        index gap = limit;
+        for (index i = 0; i < relabel.size(); ++i) {
+            const node v = relabel[i];
+            labelCount[label[v]].fetch_sub(1, std::memory_order_relaxed);
+            if (newLabel[i] < limit)
+                labelCount[newLabel[i]].fetch_add(1, std::memory_order_relaxed);
+        }
+        for (index i = 0; i < relabel.size(); ++i) {
+            const node v = relabel[i];
+            if (labelCount[label[v]].load(std::memory_order_relaxed) == 0)
+                gap = std::min(gap, label[v]);
+            label[v] = newLabel[i];
+        }
+
+        // Gap heuristic: nodes above a label that no node has cannot reach a target.
+        if (gap < limit) {
+#pragma omp parallel for
+            for (omp_index v = 0; v < static_cast<omp_index>(z); ++v)
+                if (label[v] > gap && label[v] < limit)
+                    label[v] = limit;
+            for (index k = gap + 1; k < limit; ++k)
+                labelCount[k].store(0, std::memory_order_relaxed);
+        }
+
+        active.clear();
+        for (auto &next : localNext) {
+            active.insert(active.end(), next.begin(), next.end());
+            next.clear();
+        }
+#pragma omp parallel for if (active.size() >= minParallelActive)
+        for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i)
+            excess[active[i]] += addedExcess[active[i]].exchange(0, std::memory_order_relaxed);
+        for (const node v : relabel)
+            if (mark(v))
+                active.push_back(v);
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](node v) { return label[v] >= limit; }),
+                     active.end());
+
+        // The terms correspond to alpha * n + m / 2 as each edge yields two arcs.
+        if (work > globalRelabelFactor * limit + numArcs / 4) {
+            globalRelabel();
+            work = 0;
+        }
+    }
+
+    // The terminals do not take part in the rounds; collect the flow they received.
+    G->forNodes([&](node v) {
+        if (isTerminal[v])
+            excess[v] += addedExcess[v].exchange(0, std::memory_order_relaxed);
+    });
+}
+
+edgeweight PushRelabel::getMaxFlow() const {
+    assureFinished();
+    return flowValue;
+}
+
+std::vector<node> PushRelabel::getSourceSet() const {
+    assureFinished();
+    std::vector<bool> visited(G->upperNodeIdBound(), false);
+    std::vector<node> sourceSet;
+
+    std::queue<node> Q;
+    for (const node s : sources) {
+        Q.push(s);
+        visited[s] = true;
+    }
+    while (!Q.empty()) {
+        const node u = Q.front();
+        Q.pop();
+        sourceSet.push_back(u);
+
+        // follow all arcs with remaining capacity in the residual network
+        for (index a = firstArc[u]; a < firstArc[u + 1]; ++a) {
+            const node v = head[a];
+            if (!visited[v] && residual[a] > 0) {
+                Q.push(v);
+                visited[v] = true;
+            }
+        }
+    }
+
+    return sourceSet;
+}
+
+edgeweight PushRelabel::getFlow(node u, node v) const {
+    assureFinished();
+    edgeweight result = 0;
+    if (G->isDirected()) {
+        for (index a = firstArc[u]; a < firstReverseArc[u]; ++a)
+            if (head[a] == v)
+                result += residual[reverse[a]];
+        return result;
+    }
+
+    for (index a = firstArc[u]; a < firstArc[u + 1]; ++a)
+        if (head[a] == v)
+            result += (residual[reverse[a]] - residual[a]) / 2;
+    return std::max(result, edgeweight{0});
+}
+
+const std::vector<edgeweight> &PushRelabel::getFlowVector() const {
+    assureFinished();
+    assureEdgeFlow();
+    return flow;
+}
+
+void PushRelabel::assureEdgeFlow() const {
+    if (!G->hasEdgeIds())
+        throw std::runtime_error("edges have not been indexed - call indexEdges first");
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,198 @@
+/*
+ * PushRelabelGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/flow/EdmondsKarp.hpp>
+#include <networkit/flow/PushRelabel.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+class PushRelabelGTest : public testing::TestWithParam<bool> {
+protected:
+    bool isDirected() const { return GetParam(); }
+
+    // Random graph with integral capacities in [1, 10].
+    Graph randomGraph(count n, double p) const {
+        Graph G(ErdosRenyiGenerator(n, p, isDirected()).generate(), true, isDirected());
+        G.forEdges([&](node u, node v) {
+            G.setWeight(u, v, static_cast<edgeweight>(Aux::Random::integer(1, 10)));
+        });
+        G.indexEdges();
+        return G;
+    }
+
+    // Checks capacity constraints and flow conservation at all non-terminal nodes.
+    void expectValidFlow(const Graph &G, const PushRelabel &algo,
+                         const std::vector<node> &terminals) const {
+        std::vector<edgeweight> balance(G.upperNodeIdBound(), 0);
+        G.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+            const edgeweight f = algo.getFlow(eid);
+            EXPECT_LE(std::abs(f), w + 1e-9);
+            if (isDirected()) {
+                EXPECT_GE(f, -1e-9);
+            }
+            // positive flow on undirected edges goes from the larger to the smaller id
+            const node from = isDirected() ? u : std::max(u, v);
+            const node to = isDirected() ? v : std::min(u, v);
+            balance[from] -= f;
+            balance[to] += f;
+        });
+        G.forNodes([&](node u) {
+            if (std::find(terminals.begin(), terminals.end(), u) == terminals.end()) {
+                EXPECT_NEAR(balance[u], 0, 1e-9);
+            }
+        });
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, PushRelabelGTest, testing::Values(false, true));
+
+TEST_F(PushRelabelGTest, testUndirected) {
+    Graph G(7, false);
+    G.addEdge(0, 1);
+    G.addEdge(0, 2);
+    G.addEdge(0, 3);
+    G.addEdge(1, 2);
+    G.addEdge(1, 4);
+    G.addEdge(2, 3);
+    G.addEdge(2, 4);
+    G.addEdge(3, 4);
+    G.addEdge(3, 5);
+    G.addEdge(4, 6);
+    G.addEdge(5, 6);
+
+    PushRelabel algo(G, 0, 6);
+    algo.run();
+    EXPECT_DOUBLE_EQ(2, algo.getMaxFlow());
+    EXPECT_DOUBLE_EQ(1, algo.getFlow(4, 6));
+    EXPECT_DOUBLE_EQ(1, algo.getFlow(5, 6));
+    EXPECT_DOUBLE_EQ(0, algo.getFlow(6, 5));
+    EXPECT_THAT(algo.getSourceSet(), testing::UnorderedElementsAre(0, 1, 2, 3, 4));
+
+    // the flow per edge id is only available with indexed edges
+    EXPECT_THROW(algo.getFlowVector(), std::runtime_error);
+}
+
+TEST_F(PushRelabelGTest, testDirected) {
+    Graph G(9, true, true);
+    G.addEdge(0, 1, 2);
+    G.addEdge(0, 2, 2);
+    G.addEdge(0, 3, 2);
+    G.addEdge(1, 4, 2);
+    G.addEdge(2, 4, 2);
+    G.addEdge(3, 4, 2);
+    G.addEdge(4, 5, 4);
+    G.addEdge(5, 6, 2);
+    G.addEdge(5, 7, 2);
+    G.addEdge(6, 8, 2);
+    G.addEdge(7, 8, 2);
+    G.indexEdges();
+
+    PushRelabel algo(G, 0, 8);
+    algo.run();
+    EXPECT_DOUBLE_EQ(4, algo.getMaxFlow());
+    EXPECT_DOUBLE_EQ(4, algo.getFlow(G.edgeId(4, 5)));
+    EXPECT_THAT(algo.getSourceSet(), testing::UnorderedElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST_F(PushRelabelGTest, testDirectedNoPath) {
+    Graph G(4, true, true);
+    G.addEdge(3, 2, 3.4);
+    G.addEdge(1, 2, 2.4);
+    G.addEdge(1, 0, 4.4);
+
+    PushRelabel algo(G, 3, 0);
+    algo.run();
+    EXPECT_DOUBLE_EQ(0, algo.getMaxFlow());
+    EXPECT_DOUBLE_EQ(0, algo.getFlow(3, 2));
+    EXPECT_THAT(algo.getSourceSet(), testing::UnorderedElementsAre(3, 2));
+}
+
+TEST_F(PushRelabelGTest, testInvalidTerminals) {
+    Graph G(3);
+    G.addEdge(0, 1);
+    EXPECT_THROW(PushRelabel(G, 0, 0), std::runtime_error);
+    EXPECT_THROW(PushRelabel(G, {0, 1}, {1, 2}), std::runtime_error);
+    EXPECT_THROW(PushRelabel(G, std::vector<node>{}, {1}), std::runtime_error);
+    G.removeNode(2);
+    EXPECT_THROW(PushRelabel(G, 0, 2), std::runtime_error);
+}
+
+TEST_P(PushRelabelGTest, testMatchesEdmondsKarp) {
+    Aux::Random::setSeed(42, false);
+    for (count iteration = 0; iteration < 5; ++iteration) {
+        const Graph G = randomGraph(300, 0.05);
+        const node s = Aux::Random::integer(299), t = (s + 1 + Aux::Random::integer(298)) % 300;
+
+        EdmondsKarp reference(G, s, t);
+        reference.run();
+        PushRelabel algo(G, s, t);
+        algo.run();
+
+        EXPECT_DOUBLE_EQ(reference.getMaxFlow(), algo.getMaxFlow());
+        expectValidFlow(G, algo, {s, t});
+
+        // the smallest source side of a minimum cut is unique
+        auto expectedSourceSet = reference.getSourceSet();
+        auto sourceSet = algo.getSourceSet();
+        std::sort(expectedSourceSet.begin(), expectedSourceSet.end());
+        std::sort(sourceSet.begin(), sourceSet.end());
+        EXPECT_EQ(expectedSourceSet, sourceSet);
+    }
+}
+
+TEST_P(PushRelabelGTest, testMultipleSourcesAndSinks) {
+    Aux::Random::setSeed(42, false);
+    const count n = 400;
+    const Graph G = randomGraph(n, 0.03);
+    const std::vector<node> sources{0, 1, 2}, sinks{n - 3, n - 2, n - 1};
+
+    // Reference: super source and super sink connected with edges of large capacity.
+    Graph H(G);
+    const node superSource = H.addNode(), superSink = H.addNode();
+    const edgeweight infinity = G.totalEdgeWeight() + 1;
+    for (node s : sources)
+        H.addEdge(superSource, s, infinity);
+    for (node t : sinks)
+        H.addEdge(t, superSink, infinity);
+    H.indexEdges();
+    EdmondsKarp reference(H, superSource, superSink);
+    reference.run();
+
+    PushRelabel algo(G, sources, sinks);
+    algo.run();
+    EXPECT_GT(algo.getMaxFlow(), 0);
+    EXPECT_DOUBLE_EQ(reference.getMaxFlow(), algo.getMaxFlow());
+
+    std::vector<node> terminals(sources);
+    terminals.insert(terminals.end(), sinks.begin(), sinks.end());
+    expectValidFlow(G, algo, terminals);
+
+    const auto sourceSet = algo.getSourceSet();
+    for (node t : sinks)
+        EXPECT_EQ(std::find(sourceSet.begin(), sourceSet.end(), t), sourceSet.end());
+
+    // the capacity of the cut equals the flow value
+    std::vector<bool> inSourceSet(G.upperNodeIdBound());
+    for (node u : sourceSet)
+        inSourceSet[u] = true;
+    edgeweight cut = 0;
+    G.forEdges([&](node u, node v, edgeweight w) {
+        if (inSourceSet[u] != inSourceSet[v] && (!isDirected() || inSourceSet[u]))
+            cut += w;
+    });
+    EXPECT_DOUBLE_EQ(algo.getMaxFlow(), cut);
+}
+
+} /* namespace NetworKit */
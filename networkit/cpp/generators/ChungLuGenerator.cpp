@@ -6,7 +6,10 @@
  *      Contributors: Hoske/Weisbarth
  */
 
+#include <cmath>
 #include <numeric>
+#include <random>
+#include <omp.h>
 
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/auxiliary/Random.hpp>
@@ -23,38 +26,58 @@ ChungLuGenerator::ChungLuGenerator(const std::vector<count> &degreeSequence)
 
 Graph ChungLuGenerator::generate() {
     GraphBuilder gB(n);
+    forEdges([&](node u, node v) { gB.addHalfOutEdge(u, v); });
+    return gB.completeGraph(true);
+}
+
+void ChungLuGenerator::generateEdges(const EdgeBatchHandle &handle) {
+    std::vector<EdgeBatchBuffer> buffers(omp_get_max_threads(), EdgeBatchBuffer{handle});
+    forEdges([&](node u, node v) { buffers[omp_get_thread_num()].add(u, v); });
+    for (auto &buffer : buffers)
+        buffer.flush();
+}
 
+template <typename Handle>
+void ChungLuGenerator::forEdges(Handle handle) {
     /* We need a sorted list in descending order for this algorithm */
     Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b) { return a > b; });
 
-    for (node u = 0; u <= n - 2; u++) {
+    /* The candidates of different nodes are independent; nodes with small ids have the
+     * largest degrees, so the loop is scheduled dynamically. Each node draws from its own
+     * random stream, so the graph does not depend on the number of threads. */
+    const uint64_t seed = Aux::Random::integer();
+#pragma omp parallel for schedule(dynamic, 16)
+    for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+        const node u = static_cast<node>(i);
         node v = u + 1;
+        if (v >= n)
+            continue;
+        auto prng = Aux::Random::streamURNG(seed, u);
+        std::uniform_real_distribution<double> probability{0.0, std::nexttoward(1.0, 2.0)};
         /* Apparently it is necessary to include all these casts for
          * the probability to be properly calculated */
         double p = std::min(((double)seq[u]) * ((double)seq[v]) / sum_deg, 1.0);
 
         while (v < n && p > 0) {
             if (p != 1.0) {
-                double randVal = Aux::Random::probability();
+                double randVal = probability(prng);
                 /* Calculate the distance to the next potential neighbour*/
                 v = v + (node)std::floor(std::log(randVal) / std::log(1 - p));
             }
             if ((count)v < n) {
                 double q = std::min(((double)seq[u]) * ((double)seq[v]) / sum_deg, 1.0);
-                double randVal2 = Aux::Random::probability();
+                double randVal2 = probability(prng);
                 /* The potential neighbor was selected with the probability p.
                  * In order to see if this neighbor should be rejected or accepted
                  * we correct the probability using q */
                 if (randVal2 < q / p) {
-                    gB.addHalfOutEdge(u, v);
+                    handle(u, v);
                 }
                 p = q;
                 v++;
             }
         }
     }
-
-    return gB.completeGraph(true);
 }
 
 } /* namespace NetworKit */
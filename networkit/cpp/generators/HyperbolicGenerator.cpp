@@ -70,38 +70,65 @@ Graph HyperbolicGenerator::generate() {
 }
 
 Graph HyperbolicGenerator::generate(count n, double R, double alpha, double T) {
+    vector<double> angles, radii;
+    samplePoints(n, R, alpha, angles, radii);
+    return generate(angles, radii, R, T);
+}
+
+void HyperbolicGenerator::generateEdges(const EdgeBatchHandle &handle) {
+    vector<double> angles, radii;
+    samplePoints(nodeCount, R, alpha, angles, radii);
+
+    std::vector<EdgeBatchBuffer> buffers(omp_get_max_threads(), EdgeBatchBuffer{handle});
+    forEdges(angles, radii, R, temperature,
+             [&](node u, node v) { buffers[omp_get_thread_num()].add(u, v); });
+    for (auto &buffer : buffers)
+        buffer.flush();
+}
+
+void HyperbolicGenerator::samplePoints(count n, double R, double alpha, vector<double> &angles,
+                                       vector<double> &radii) {
     assert(R > 0);
-    vector<double> angles(n);
-    vector<double> radii(n);
+    vector<double> unsortedAngles(n);
+    vector<double> unsortedRadii(n);
 
     // sample points randomly
-    HyperbolicSpace::fillPoints(angles, radii, R, alpha);
+    HyperbolicSpace::fillPoints(unsortedAngles, unsortedRadii, R, alpha);
     vector<index> permutation(n);
 
     index p = 0;
     std::generate(permutation.begin(), permutation.end(), [&p]() { return p++; });
 
     // can probably be parallelized easily, but doesn't bring much benefit
-    Aux::Parallel::sort(
-        permutation.begin(), permutation.end(), [&angles, &radii](index i, index j) {
-            return angles[i] < angles[j] || (angles[i] == angles[j] && radii[i] < radii[j]);
-        });
+    Aux::Parallel::sort(permutation.begin(), permutation.end(),
+                        [&unsortedAngles, &unsortedRadii](index i, index j) {
+                            return unsortedAngles[i] < unsortedAngles[j]
+                                   || (unsortedAngles[i] == unsortedAngles[j]
+                                       && unsortedRadii[i] < unsortedRadii[j]);
+                        });
 
-    vector<double> anglecopy(n);
-    vector<double> radiicopy(n);
+    angles.resize(n);
+    radii.resize(n);
 
 #pragma omp parallel for
     for (omp_index j = 0; j < static_cast<omp_index>(n); j++) {
-        anglecopy[j] = angles[permutation[j]];
-        radiicopy[j] = radii[permutation[j]];
+        angles[j] = unsortedAngles[permutation[j]];
+        radii[j] = unsortedRadii[permutation[j]];
     }
 
     INFO("Generated Points");
-    return generate(anglecopy, radiicopy, R, T);
 }
 
 Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vector<double> &radii,
                                         double R) {
+    GraphBuilder result(angles.size(), false, false);
+    forEdgesCold(angles, radii, R, [&](node u, node v) { result.addHalfEdge(u, v); });
+    return result.completeGraph(true);
+}
+
+template <typename Handle>
+void HyperbolicGenerator::forEdgesCold(const vector<double> &angles, const vector<double> &radii,
+                                       double R, Handle handle) {
     const count n = angles.size();
     assert(radii.size() == n);
 
@@ -163,7 +190,6 @@ Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vect
     Aux::Timer timer;
     timer.start();
     vector<double> empty;
-    GraphBuilder result(n, false, false);
 
 #pragma omp parallel
     {
@@ -205,22 +231,31 @@ Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vect
                     ERROR("Node ", j, " prospective neighbor of ", i,
                           " does not actually exist. Oops.");
                 if (radii[j] > radii[i] || (radii[j] == radii[i] && angles[j] < angles[i]))
-                    result.addHalfEdge(i, j);
+                    handle(i, j);
             }
         }
         threadtimers[id].stop();
     }
     timer.stop();
     INFO("Generating Edges took ", timer.elapsedMilliseconds(), " milliseconds.");
-    return result.completeGraph(true);
 }
 
 Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<double> &radii,
                                     double R, double T) {
+    GraphBuilder result(angles.size(), false, false); // no direct swap with probabilistic graphs
+    forEdges(angles, radii, R, T, [&](node u, node v) { result.addHalfEdge(u, v); });
+    return result.completeGraph(true);
+}
+
+template <typename Handle>
+void HyperbolicGenerator::forEdges(const vector<double> &angles, const vector<double> &radii,
+                                   double R, double T, Handle handle) {
     if (T < 0)
         throw std::runtime_error("Temperature cannot be negative.");
-    if (T == 0)
-        return generateCold(angles, radii, R);
+    if (T == 0) {
+        forEdgesCold(angles, radii, R, handle);
+        return;
+    }
     assert(T > 0);
 
     /**
@@ -254,8 +289,7 @@ Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<d
         return 1 / (std::exp(beta * (distance - R) / 2) + 1);
     };
 
-    // get Graph
-    GraphBuilder result(n, false, false); // no direct swap with probabilistic graphs
+    // get edges
     count totalCandidates = 0;
 #pragma omp parallel for reduction(+ : totalCandidates)
     for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
@@ -267,11 +301,10 @@ Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<d
                 ERROR("Node ", j, " prospective neighbor of ", i,
                       " does not actually exist. Oops.");
             if (j > i) {
-                result.addHalfEdge(i, j);
+                handle(i, j);
             }
         }
     }
     DEBUG("Candidates tested: ", totalCandidates);
-    return result.completeGraph(true);
 }
 } // namespace NetworKit
@@ -5,10 +5,14 @@
  *      Author: Henning, cls
  */
 
+#include <algorithm>
+
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
+#include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/generators/RmatGenerator.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
 
 namespace NetworKit {
 
@@ -26,101 +30,156 @@ RmatGenerator::RmatGenerator(count scale, count edgeFactor, double a, double b,
 }
 
 Graph RmatGenerator::generate() {
-    double n = (1 << scale);
+    const count n = count{1} << scale;
     if (n <= reduceNodes) {
         throw std::runtime_error("Error, shall delete more nodes than the graph originally has");
     }
-    // when nodes are deleted, all nodes have less neighbors
-    count numEdges = n * edgeFactor * n * 1.0 / static_cast<double>(n - reduceNodes);
-    count wantedEdges = (n - reduceNodes) * edgeFactor;
-    Graph G(n - reduceNodes, weighted);
-    double ab = a + b;
-    double abc = ab + c;
-
-    auto quadrant([&]() {
-        double r = Aux::Random::probability();
-        TRACE("r: ", r);
-
-        if (r <= a) {
-            return 0;
-        } else if (r <= ab) {
-            return 1;
-        } else if (r <= abc) {
-            return 2;
-        } else
-            return 3;
-    });
-
-    auto drawEdge([&]() {
-        node u = 0;
-        node v = 0;
-        for (index i = 0; i < scale; ++i) {
-            count q = quadrant();
-            u = u << 1;
-            v = v << 1;
-            u = u | (q >> 1);
-            v = v | (q & 1);
-        }
+    const uint64_t seed = Aux::Random::integer();
 
-        return std::make_pair(u, v);
-    });
+    const count numEdges = numberOfDraws();
+    const count wantedEdges = (n - reduceNodes) * edgeFactor;
 
-    if (reduceNodes > 0) {
-        std::vector<node> nodemap(n, 0);
+    const std::vector<node> nodemap = reducedNodeIds(seed);
 
-        for (count deletedNodes = 0; deletedNodes < reduceNodes;) {
-            node u = Aux::Random::index(n);
-            if (nodemap[u] == 0) {
-                nodemap[u] = none;
-                ++deletedNodes;
-            }
-        }
+    // Edges (u, v) with u >= v sorted lexicographically. Each block of draws is written to a
+    // fixed range, so the result is independent of the number of threads.
+    using Edge = std::pair<node, node>;
+    std::vector<Edge> edges;
+    index nextBlock = 0;
 
-        for (node i = 0, u = 0; i < n; ++i) {
-            if (nodemap[i] == 0) {
-                nodemap[i] = u;
-                ++u;
-            }
+    auto drawEdges = [&](count numDraws) {
+        const index begin = edges.size();
+        const count blocks = (numDraws + edgesPerBlock - 1) / edgesPerBlock;
+        edges.resize(begin + numDraws);
+
+#pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index block = 0; block < static_cast<omp_index>(blocks); ++block) {
+            index pos = begin + block * edgesPerBlock;
+            drawBlock(seed, nextBlock + block,
+                      std::min(edgesPerBlock, numDraws - block * edgesPerBlock),
+                      [&](node u, node v) {
+                          if (reduceNodes > 0) {
+                              u = nodemap[u];
+                              v = nodemap[v];
+                          }
+                          // deleted nodes and (as before) self-loops in reduced graphs are
+                          // marked invalid and sorted to the end
+                          if (u == none || v == none || (!weighted && reduceNodes > 0 && u == v))
+                              edges[pos++] = {none, none};
+                          else
+                              edges[pos++] = {std::max(u, v), std::min(u, v)};
+                      });
         }
+        nextBlock += blocks;
+
+        Aux::Parallel::sort(edges.begin() + begin, edges.end());
+        std::inplace_merge(edges.begin(), edges.begin() + begin, edges.end());
+        while (!edges.empty() && edges.back().first == none)
+            edges.pop_back();
+    };
+
+    std::vector<edgeweight> weights;
+    if (weighted) {
+        drawEdges(numEdges);
 
-        node u, v;
-        if (weighted) {
-            for (index e = 0; e < numEdges; ++e) {
-                std::tie(u, v) = drawEdge();
-                u = nodemap[u];
-                v = nodemap[v];
-                if (u != none && v != none) {
-                    G.increaseWeight(u, v, defaultEdgeWeight);
-                }
-            }
-        } else {
-            while (G.numberOfEdges() < wantedEdges) {
-                std::tie(u, v) = drawEdge();
-                u = nodemap[u];
-                v = nodemap[v];
-                if (u != none && v != none && u != v && !G.hasEdge(u, v)) {
-                    G.addEdge(u, v);
-                }
-            }
+        // multiple draws of the same edge increase its weight
+        index numUnique = 0;
+        for (index i = 0; i < edges.size();) {
+            index j = i + 1;
+            while (j < edges.size() && edges[j] == edges[i])
+                ++j;
+            edges[numUnique++] = edges[i];
+            weights.push_back(static_cast<edgeweight>(j - i) * defaultEdgeWeight);
+            i = j;
         }
+        edges.resize(numUnique);
     } else {
-        if (weighted) {
-            for (index e = 0; e < numEdges; ++e) {
-                std::pair<node, node> drawnEdge = drawEdge();
-                G.increaseWeight(drawnEdge.first, drawnEdge.second, defaultEdgeWeight);
-            }
-        } else {
-            while (G.numberOfEdges() < wantedEdges) {
-                std::pair<node, node> drawnEdge = drawEdge();
-                if (!G.hasEdge(drawnEdge.first, drawnEdge.second)) {
-                    G.addEdge(drawnEdge.first, drawnEdge.second);
-                }
-            }
+        // draw until there are enough distinct edges
+        while (edges.size() < wantedEdges) {
+            drawEdges(wantedEdges - edges.size());
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
         }
     }
 
-    G.shrinkToFit();
-    return G;
+    // Split the edges into ranges that do not share a first node, so that each node's
+    // bucket of the builder is only filled by one thread.
+    const count numRanges = std::min<count>(edges.size(), 16 * omp_get_max_threads());
+    std::vector<index> rangeBegin(numRanges + 1, edges.size());
+    for (index r = 0; r < numRanges; ++r) {
+        index pos = edges.size() * r / numRanges;
+        while (pos > 0 && pos < edges.size() && edges[pos].first == edges[pos - 1].first)
+            ++pos;
+        rangeBegin[r] = pos;
+    }
+
+    GraphBuilder builder(n - reduceNodes, weighted, false);
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index r = 0; r < static_cast<omp_index>(numRanges); ++r) {
+        for (index i = rangeBegin[r]; i < rangeBegin[r + 1]; ++i)
+            builder.addHalfEdge(edges[i].first, edges[i].second,
+                                weighted ? weights[i] : defaultEdgeWeight);
+    }
+
+    return builder.completeGraph(true);
+}
+
+void RmatGenerator::generateEdges(const EdgeBatchHandle &handle) {
+    const uint64_t seed = Aux::Random::integer();
+    const std::vector<node> nodemap = reducedNodeIds(seed);
+    const count numEdges = numberOfDraws();
+    const count blocks = (numEdges + edgesPerBlock - 1) / edgesPerBlock;
+
+    std::vector<EdgeBatchBuffer> buffers(omp_get_max_threads(), EdgeBatchBuffer{handle});
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index block = 0; block < static_cast<omp_index>(blocks); ++block) {
+        auto &buffer = buffers[omp_get_thread_num()];
+        drawBlock(seed, block, std::min(edgesPerBlock, numEdges - block * edgesPerBlock),
+                  [&](node u, node v) {
+                      if (reduceNodes > 0) {
+                          u = nodemap[u];
+                          v = nodemap[v];
+                          if (u == none || v == none)
+                              return;
+                      }
+                      buffer.add(u, v);
+                  });
+    }
+
+    for (auto &buffer : buffers)
+        buffer.flush();
+}
+
+count RmatGenerator::numberOfDraws() const {
+    const count n = count{1} << scale;
+    // when nodes are deleted, all nodes have less neighbors
+    return static_cast<count>(static_cast<double>(n) * edgeFactor * n
+                              / static_cast<double>(n - reduceNodes));
+}
+
+std::vector<node> RmatGenerator::reducedNodeIds(uint64_t seed) const {
+    if (reduceNodes == 0)
+        return {};
+
+    // nodemap[u] is the id of u in the reduced graph, none if u is deleted
+    const count n = count{1} << scale;
+    std::vector<node> nodemap(n, 0);
+    auto urng = Aux::Random::streamURNG(seed, none);
+    std::uniform_int_distribution<node> distr{0, n - 1};
+    for (count deletedNodes = 0; deletedNodes < reduceNodes;) {
+        node u = distr(urng);
+        if (nodemap[u] == 0) {
+            nodemap[u] = none;
+            ++deletedNodes;
+        }
+    }
+
+    for (node i = 0, u = 0; i < n; ++i) {
+        if (nodemap[i] == 0) {
+            nodemap[i] = u;
+            ++u;
+        }
+    }
+    return nodemap;
 }
 
 } /* namespace NetworKit */
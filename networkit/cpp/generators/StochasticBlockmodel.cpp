@@ -5,8 +5,15 @@
  *      Author: Christian Staudt
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <omp.h>
+
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/generators/StochasticBlockmodel.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
 
 namespace NetworKit {
 
@@ -32,20 +39,61 @@ StochasticBlockmodel::StochasticBlockmodel(count n, count nBlocks,
 }
 
 Graph StochasticBlockmodel::generate() {
-    Graph G(n);
-
-    G.forNodePairs([&](node u, node v) {
-        index a = membership.at(u);
-        index b = membership.at(v);
-        assert(a < affinity.size());
-        assert(b < affinity.size());
-        double p = affinity.at(a).at(b);
-        double r = Aux::Random::real();
-        if (r <= p) {
-            G.addEdge(u, v);
+    GraphBuilder builder(n);
+    forEdges([&](node u, node v) { builder.addHalfEdge(u, v); });
+    return builder.completeGraph(true);
+}
+
+void StochasticBlockmodel::generateEdges(const EdgeBatchHandle &handle) {
+    std::vector<EdgeBatchBuffer> buffers(omp_get_max_threads(), EdgeBatchBuffer{handle});
+    forEdges([&](node u, node v) { buffers[omp_get_thread_num()].add(u, v); });
+    for (auto &buffer : buffers)
+        buffer.flush();
+}
+
+template <typename Handle>
+void StochasticBlockmodel::forEdges(Handle handle) {
+    // members of each block in ascending order
+    std::vector<std::vector<node>> blocks(affinity.size());
+    for (node u = 0; u < n; ++u) {
+        if (membership[u] >= blocks.size())
+            throw std::runtime_error("membership list contains an invalid block id");
+        blocks[membership[u]].push_back(u);
+    }
+
+    // For each node u and block b, the neighbors v < u in b are a Bernoulli sample of the
+    // members of b; the gaps between them are drawn from the geometric distribution instead
+    // of testing each pair. Each node draws from its own random stream, so the graph does not
+    // depend on the number of threads.
+    const uint64_t seed = Aux::Random::integer();
+#pragma omp parallel for schedule(dynamic, 64)
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        const node u = static_cast<node>(i);
+        auto prng = Aux::Random::streamURNG(seed, u);
+        std::uniform_real_distribution<double> real{0.0, 1.0};
+        const auto &row = affinity[membership[u]];
+        for (index b = 0; b < blocks.size(); ++b) {
+            const double p = row[b];
+            if (p <= 0)
+                continue;
+            const auto &block = blocks[b];
+            const index end = std::lower_bound(block.begin(), block.end(), u) - block.begin();
+
+            if (p >= 1) {
+                for (index j = 0; j < end; ++j)
+                    handle(u, block[j]);
+                continue;
+            }
+
+            const double logq = std::log1p(-p);
+            for (double j = -1;;) {
+                j += 1 + std::floor(std::log1p(-real(prng)) / logq);
+                if (j >= static_cast<double>(end))
+                    break;
+                handle(u, block[static_cast<index>(j)]);
+            }
         }
-    });
-    return G;
+    }
 }
 
 } /* namespace NetworKit */
@@ -0,0 +1,63 @@
+/*
+ * GeneratorsGBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/BarabasiAlbertGenerator.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/generators/HyperbolicGenerator.hpp>
+#include <networkit/generators/RmatGenerator.hpp>
+
+#include "../../BenchmarkGraphs.hpp"
+
+namespace NetworKit {
+
+namespace {
+
+using BenchmarkGraphs::graphSizes;
+
+template <class Generator>
+void runGenerator(benchmark::State &state, Generator &&makeGenerator) {
+    Aux::Random::setSeed(42, false);
+    count edges = 0;
+    for (auto _ : state) {
+        auto generator = makeGenerator(static_cast<count>(state.range(0)));
+        const Graph G = generator.generate();
+        edges += G.numberOfEdges();
+    }
+    state.SetItemsProcessed(edges);
+}
+
+void BM_ErdosRenyiGenerator(benchmark::State &state) {
+    runGenerator(state, [](count n) { return ErdosRenyiGenerator(n, 16. / n); });
+}
+
+void BM_BarabasiAlbertGenerator(benchmark::State &state) {
+    runGenerator(state, [](count n) { return BarabasiAlbertGenerator(8, n); });
+}
+
+void BM_HyperbolicGenerator(benchmark::State &state) {
+    runGenerator(state, [](count n) { return HyperbolicGenerator(n, 16., 3.); });
+}
+
+void BM_RmatGenerator(benchmark::State &state) {
+    runGenerator(state, [](count n) {
+        count scale = 0;
+        while ((count{1} << (scale + 1)) <= n)
+            ++scale;
+        return RmatGenerator(scale, 8, 0.57, 0.19, 0.19, 0.05);
+    });
+}
+
+} // namespace
+
+BENCHMARK(BM_ErdosRenyiGenerator)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_BarabasiAlbertGenerator)->Apply(graphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_HyperbolicGenerator)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_RmatGenerator)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace NetworKit
@@ -612,6 +612,79 @@ TEST_F(GeneratorsGTest, testRmatGenerator) {
     EXPECT_TRUE(G.checkConsistency());
 }
 
+TEST_F(GeneratorsGTest, testRmatGeneratorReduceNodes) {
+    for (bool weighted : {false, true}) {
+        Aux::Random::setSeed(42, false);
+        RmatGenerator rmat(8, 4, 0.57, 0.19, 0.19, 0.05, weighted, 6);
+        Graph G = rmat.generate();
+
+        EXPECT_EQ(G.numberOfNodes(), 250u);
+        EXPECT_TRUE(G.checkConsistency());
+        if (weighted) {
+            // draws with a deleted endpoint are dropped
+            EXPECT_LE(G.totalEdgeWeight(), 256.0 * 4 * 256 / 250);
+        } else {
+            EXPECT_EQ(G.numberOfEdges(), 250u * 4);
+            EXPECT_EQ(G.numberOfSelfLoops(), 0u);
+        }
+    }
+}
+
+TEST_F(GeneratorsGTest, testRmatGeneratorDeterministic) {
+    const int maxThreads = omp_get_max_threads();
+    auto generate = [](int threads, bool weighted) {
+        omp_set_num_threads(threads);
+        Aux::Random::setSeed(1, false);
+        return RmatGenerator(10, 8, 0.57, 0.19, 0.19, 0.05, weighted).generate();
+    };
+
+    for (bool weighted : {false, true}) {
+        const Graph G = generate(1, weighted);
+        const Graph H = generate(std::max(maxThreads, 2), weighted);
+        ASSERT_EQ(G.numberOfEdges(), H.numberOfEdges());
+        G.forEdges([&](node u, node v, edgeweight w) { EXPECT_EQ(H.weight(u, v), w); });
+    }
+    omp_set_num_threads(maxThreads);
+}
+
+TEST_F(GeneratorsGTest, testRmatGeneratorForEdgesParallel) {
+    const count scale = 12, edgeFactor = 20;
+    RmatGenerator rmat(scale, edgeFactor, 0.57, 0.19, 0.19, 0.05);
+
+    std::vector<count> outDegree(count{1} << scale);
+    count numEdges = 0;
+    const count emitted = rmat.forEdgesParallel([&](int, node u, node) {
+#pragma omp atomic
+        ++outDegree[u];
+#pragma omp atomic
+        ++numEdges;
+    });
+
+    EXPECT_EQ(emitted, (count{1} << scale) * edgeFactor);
+    EXPECT_EQ(numEdges, emitted);
+    // the upper half of the matrix receives a + b of the draws in the first level
+    const count upper = std::accumulate(outDegree.begin(), outDegree.begin() + outDegree.size() / 2,
+                                        count{0});
+    EXPECT_NEAR(static_cast<double>(upper) / numEdges, 0.76, 0.02);
+}
+
+TEST_F(GeneratorsGTest, testErdosRenyiGeneratorDeterministic) {
+    const int maxThreads = omp_get_max_threads();
+    auto generate = [](int threads, bool directed) {
+        omp_set_num_threads(threads);
+        Aux::Random::setSeed(3, false);
+        return ErdosRenyiGenerator(1000, 0.01, directed).generate();
+    };
+
+    for (bool directed : {false, true}) {
+        const Graph G = generate(1, directed);
+        const Graph H = generate(std::max(maxThreads, 2), directed);
+        ASSERT_EQ(G.numberOfEdges(), H.numberOfEdges());
+        G.forEdges([&](node u, node v) { EXPECT_TRUE(H.hasEdge(u, v)); });
+    }
+    omp_set_num_threads(maxThreads);
+}
+
 TEST_F(GeneratorsGTest, testChungLuGenerator) {
     count n = 400;
     count maxDegree = n / 8;
@@ -635,6 +708,24 @@ TEST_F(GeneratorsGTest, testChungLuGenerator) {
     INFO("expected volume: ", expVolume, ", actual volume: ", actualVolume);
 }
 
+TEST_F(GeneratorsGTest, testChungLuGeneratorDeterministic) {
+    const int maxThreads = omp_get_max_threads();
+    std::vector<count> sequence(1000);
+    for (index i = 0; i < sequence.size(); ++i)
+        sequence[i] = 1 + (i * 37) % 100;
+    auto generate = [&](int threads) {
+        omp_set_num_threads(threads);
+        Aux::Random::setSeed(5, false);
+        return ChungLuGenerator(sequence).generate();
+    };
+
+    const Graph G = generate(1);
+    const Graph H = generate(std::max(maxThreads, 2));
+    ASSERT_EQ(G.numberOfEdges(), H.numberOfEdges());
+    G.forEdges([&](node u, node v) { EXPECT_TRUE(H.hasEdge(u, v)); });
+    omp_set_num_threads(maxThreads);
+}
+
 TEST_F(GeneratorsGTest, testChungLuGeneratorDegreeConsistency) {
     count n = 1000;
     std::vector<count> vec;
@@ -939,6 +1030,27 @@ TEST_F(GeneratorsGTest, testStochasticBlockmodel) {
     EXPECT_EQ(20u, G.numberOfEdges());
 }
 
+TEST_F(GeneratorsGTest, testStochasticBlockmodelDeterministic) {
+    const int maxThreads = omp_get_max_threads();
+    const count n = 2000;
+    std::vector<index> membership(n);
+    for (index i = 0; i < n; ++i)
+        membership[i] = i % 3;
+    const std::vector<std::vector<double>> affinity = {
+        {0.05, 0.01, 0.002}, {0.01, 0.04, 0.005}, {0.002, 0.005, 0.03}};
+    auto generate = [&](int threads) {
+        omp_set_num_threads(threads);
+        Aux::Random::setSeed(7, false);
+        return StochasticBlockmodel(n, 3, membership, affinity).generate();
+    };
+
+    const Graph G = generate(1);
+    const Graph H = generate(std::max(maxThreads, 2));
+    ASSERT_EQ(G.numberOfEdges(), H.numberOfEdges());
+    G.forEdges([&](node u, node v) { EXPECT_TRUE(H.hasEdge(u, v)); });
+    omp_set_num_threads(maxThreads);
+}
+
 /**
  * Test whether points generated in hyperbolic space fulfill basic constraints
  */
@@ -13,11 +13,15 @@
 #include <networkit/centrality/LocalClusteringCoefficient.hpp>
 #include <networkit/global/ClusteringCoefficient.hpp>
 #include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/TriangleEngine.hpp>
 
 namespace NetworKit {
 
-double ClusteringCoefficient::sequentialAvgLocal(const Graph &G) {
-    WARN("DEPRECATED: use centrality.LocalClusteringCoefficient and take average");
+namespace {
+
+// Triangles per node by marking the neighbors of the nodes in order of decreasing degree; the
+// previous implementation of sequentialAvgLocal, which is kept for directed graphs.
+std::vector<count> markedTrianglesPerNode(const Graph &G) {
     std::vector<std::vector<node>> edges(G.upperNodeIdBound());
 
     // copy edges with edge ids
@@ -85,6 +89,54 @@ double ClusteringCoefficient::sequentialAvgLocal(const Graph &G) {
         }
     }
 
+    return triangleCount;
+}
+
+// Number of ordered paths u-v-w closed by an edge u-w at every node u (six per triangle in
+// undirected graphs); the previous implementation of exactGlobal, which is kept for directed
+// graphs.
+std::vector<count> closedPathsPerNode(const Graph &G) {
+    count z = G.upperNodeIdBound();
+    // triangles including node u (every triangle is counted six times)
+    std::vector<count> triangles(z);
+
+    std::vector<std::vector<bool>> nodeMarker(omp_get_max_threads());
+    for (auto &nm : nodeMarker) {
+        nm.resize(z, false);
+    }
+
+    G.balancedParallelForNodes([&](node u) {
+        size_t tid = omp_get_thread_num();
+        count tr = 0;
+
+        if (G.degree(u) > 1) {
+            G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = true; });
+
+            G.forEdgesOf(u, [&](node, node v) {
+                G.forEdgesOf(v, [&](node, node w) {
+                    if (nodeMarker[tid][w]) {
+                        tr += 1;
+                    }
+                });
+            });
+
+            G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = false; });
+        }
+
+        triangles[u] = tr;
+    });
+
+    return triangles;
+}
+
+} // namespace
+
+double ClusteringCoefficient::sequentialAvgLocal(const Graph &G) {
+    WARN("DEPRECATED: use centrality.LocalClusteringCoefficient and take average");
+    // TriangleEngine only supports undirected graphs
+    const auto triangleCount =
+        G.isDirected() ? markedTrianglesPerNode(G) : TriangleEngine(G).trianglesPerNode();
+
     double coefficient = 0;
     count size = 0;
     G.forNodes([&](node u) {
@@ -162,48 +214,23 @@ double ClusteringCoefficient::approxAvgLocal(Graph &G, const count trials) {
 }
 
 double ClusteringCoefficient::exactGlobal(Graph &G) {
-    count z = G.upperNodeIdBound();
-    // triangles including node u (every triangle is counted six times)
-    std::vector<count> triangles(z);
-
-    std::vector<std::vector<bool>> nodeMarker(omp_get_max_threads());
-    for (auto &nm : nodeMarker) {
-        nm.resize(z, false);
+    double triangles;
+    if (G.isDirected()) {
+        const auto paths = closedPathsPerNode(G);
+        triangles = G.parallelSumForNodes([&](node u) { return paths[u]; });
+    } else {
+        // every triangle closes six ordered paths of length two
+        triangles = 6.0 * static_cast<double>(TriangleEngine(G).numberOfTriangles());
     }
 
-    G.balancedParallelForNodes([&](node u) {
-        size_t tid = omp_get_thread_num();
-        count tr = 0;
-
-        if (G.degree(u) > 1) {
-            G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = true; });
-
-            G.forEdgesOf(u, [&](node, node v) {
-                G.forEdgesOf(v, [&](node, node w) {
-                    if (nodeMarker[tid][w]) {
-                        tr += 1;
-                    }
-                });
-            });
-
-            G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = false; });
-        }
-
-        triangles[u] = tr;
-    });
-
     double denominator =
         G.parallelSumForNodes([&](node u) { return G.degree(u) * (G.degree(u) - 1); });
 
-    double cc = G.parallelSumForNodes([&](node u) { return triangles[u]; });
-
     if (denominator == 0) {
         return 0; // no triangle exists
     }
 
-    cc /= denominator;
-
-    return cc;
+    return triangles / denominator;
 }
 
 double ClusteringCoefficient::approxGlobal(Graph &G, const count trials) {
@@ -41,4 +41,16 @@ TEST_F(GlobalGTest, testGlobalClusteringCoefficient) {
     EXPECT_NEAR(ccg, 18.0 / 34.0, 1e-9);
 }
 
+TEST_F(GlobalGTest, testClusteringCoefficientDirected) {
+    // the triangle counting of undirected graphs does not apply, the out-edges are used instead
+    Graph G(3, false, true);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    G.addEdge(0, 2);
+
+    // the path 0->1->2 is closed by 0->2; only node 0 has two out-neighbors
+    EXPECT_DOUBLE_EQ(ClusteringCoefficient::exactGlobal(G), 0.5);
+    EXPECT_DOUBLE_EQ(ClusteringCoefficient::sequentialAvgLocal(G), 1.0);
+}
+
 } /* namespace NetworKit */
@@ -0,0 +1,157 @@
+/*
+ * CSRGraph.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+
+#include <networkit/graph/CSRGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Fills offsets with the exclusive prefix sum of the given degrees; offsets has size z + 1.
+template <typename DegreeFunction>
+std::vector<index> computeOffsets(node z, DegreeFunction degreeOf) {
+    std::vector<index> offsets(z + 1);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        offsets[u + 1] = degreeOf(static_cast<node>(u));
+
+    for (node u = 0; u < z; ++u)
+        offsets[u + 1] += offsets[u];
+
+    return offsets;
+}
+
+// Arrays of a CSRGraph that was created from a Graph.
+struct OwnedCSRArrays {
+    std::vector<uint8_t> exists;
+    std::vector<index> outOffsets, inOffsets;
+    std::vector<node> outTargets, inTargets;
+    std::vector<edgeweight> outWeights, inWeights;
+    std::vector<edgeid> outEdgeIds, inEdgeIds;
+};
+
+} // namespace
+
+CSRGraph::CSRGraph(const Graph &G)
+    : n(G.numberOfNodes()), m(G.numberOfEdges()), storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+      z(G.upperNodeIdBound()), omega(G.hasEdgeIds() ? G.upperEdgeIdBound() : 0),
+      weighted(G.isWeighted()), directed(G.isDirected()), edgesIndexed(G.hasEdgeIds()) {
+
+    auto arrays = std::make_shared<OwnedCSRArrays>();
+
+    arrays->exists.resize(z);
+    for (node u = 0; u < z; ++u)
+        arrays->exists[u] = G.hasNode(u);
+
+    // Copies the outgoing (or incoming) adjacency of G into the given arrays.
+    auto copyAdjacency = [&](bool in, std::vector<index> &offsets, std::vector<node> &targets,
+                             std::vector<edgeweight> &weights, std::vector<edgeid> &ids) {
+        offsets = computeOffsets(z, [&G, in](node u) -> count {
+            if (!G.hasNode(u))
+                return 0;
+            return in ? G.degreeIn(u) : G.degreeOut(u);
+        });
+
+        const count numEntries = offsets.back();
+        targets.resize(numEntries);
+        if (weighted)
+            weights.resize(numEntries);
+        if (edgesIndexed)
+            ids.resize(numEntries);
+
+        G.balancedParallelForNodes([&](node u) {
+            index pos = offsets[u];
+            auto copyEdge = [&](node, node v, edgeweight ew, edgeid eid) {
+                targets[pos] = v;
+                if (weighted)
+                    weights[pos] = ew;
+                if (edgesIndexed)
+                    ids[pos] = eid;
+                ++pos;
+            };
+            if (in)
+                G.forInEdgesOf(u, copyEdge);
+            else
+                G.forEdgesOf(u, copyEdge);
+        });
+    };
+
+    copyAdjacency(false, arrays->outOffsets, arrays->outTargets, arrays->outWeights,
+                  arrays->outEdgeIds);
+    if (directed)
+        copyAdjacency(true, arrays->inOffsets, arrays->inTargets, arrays->inWeights,
+                      arrays->inEdgeIds);
+
+    exists = arrays->exists.data();
+    outOffsets = arrays->outOffsets.data();
+    outTargets = arrays->outTargets.data();
+    outWeights = weighted ? arrays->outWeights.data() : nullptr;
+    outEdgeIds = edgesIndexed ? arrays->outEdgeIds.data() : nullptr;
+    if (directed) {
+        inOffsets = arrays->inOffsets.data();
+        inTargets = arrays->inTargets.data();
+        inWeights = weighted ? arrays->inWeights.data() : nullptr;
+        inEdgeIds = edgesIndexed ? arrays->inEdgeIds.data() : nullptr;
+    }
+
+    storage = std::move(arrays);
+}
+
+edgeweight CSRGraph::computeWeightedDegree(node u, bool inDegree,
+                                           bool countSelfLoopsTwice) const {
+    if (weighted) {
+        edgeweight sum = 0.0;
+        auto sumWeights = [&](node v, edgeweight w) {
+            sum += (countSelfLoopsTwice && u == v) ? 2. * w : w;
+        };
+        if (inDegree) {
+            forInNeighborsOf(u, sumWeights);
+        } else {
+            forNeighborsOf(u, sumWeights);
+        }
+        return sum;
+    }
+
+    count sum = inDegree ? degreeIn(u) : degreeOut(u);
+    auto countSelfLoops = [&](node v) { sum += (u == v); };
+
+    if (countSelfLoopsTwice && numberOfSelfLoops()) {
+        if (inDegree) {
+            forInNeighborsOf(u, countSelfLoops);
+        } else {
+            forNeighborsOf(u, countSelfLoops);
+        }
+    }
+
+    return static_cast<edgeweight>(sum);
+}
+
+bool CSRGraph::hasEdge(node u, node v) const noexcept {
+    if (!hasNode(u) || !hasNode(v))
+        return false;
+    const auto range = neighborRange(u);
+    return std::find(range.first, range.second, v) != range.second;
+}
+
+edgeweight CSRGraph::weight(node u, node v) const {
+    if (!hasNode(u))
+        return nullWeight;
+    const auto range = neighborRange(u);
+    const auto it = std::find(range.first, range.second, v);
+    if (it == range.second)
+        return nullWeight;
+    return weighted ? outWeights[outOffsets[u] + (it - range.first)] : defaultEdgeWeight;
+}
+
+edgeweight CSRGraph::totalEdgeWeight() const noexcept {
+    if (!weighted)
+        return static_cast<edgeweight>(m) * defaultEdgeWeight;
+    return parallelSumForEdges([](node, node, edgeweight ew) { return ew; });
+}
+
+} // namespace NetworKit
@@ -424,7 +424,8 @@ void merge(Graph &G, const Graph &G1) {
 Graph getCompactedGraph(const Graph &graph, const std::unordered_map<node, node> &nodeIdMap) {
     return getRemappedGraph(graph, nodeIdMap.size(), [&](node u) {
         const auto it = nodeIdMap.find(u);
-        assert(it != nodeIdMap.cend());
+        if (it == nodeIdMap.cend())
+            throw std::runtime_error("The node id map must contain every node of the graph.");
         return it->second;
     });
 }
@@ -0,0 +1,150 @@
+/*
+ * NodeReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <tuple>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/NodeReordering.hpp>
+
+namespace NetworKit {
+
+namespace NodeReordering {
+
+namespace {
+
+count totalDegree(const Graph &G, node u) {
+    return G.isDirected() ? G.degreeOut(u) + G.degreeIn(u) : G.degree(u);
+}
+
+template <typename L>
+void forAllNeighborsOf(const Graph &G, node u, L handle) {
+    G.forNeighborsOf(u, handle);
+    if (G.isDirected())
+        G.forInNeighborsOf(u, handle);
+}
+
+// Converts a sequence of all nodes in their new order into the permutation oldToNew.
+std::vector<node> orderToPermutation(const Graph &G, const std::vector<node> &order) {
+    assert(order.size() == G.numberOfNodes());
+    std::vector<node> oldToNew(G.upperNodeIdBound(), none);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(order.size()); ++i)
+        oldToNew[order[i]] = i;
+    return oldToNew;
+}
+
+// Appends the nodes of the component of root to order in breadth-first order. If sortByDegree is
+// set, the unvisited neighbors of each node are visited in order of increasing degree.
+void traverseComponent(const Graph &G, node root, bool sortByDegree, std::vector<bool> &visited,
+                       std::vector<node> &order) {
+    index head = order.size();
+    order.push_back(root);
+    visited[root] = true;
+    while (head < order.size()) {
+        const node u = order[head++];
+        const index firstNeighbor = order.size();
+        forAllNeighborsOf(G, u, [&](node v) {
+            if (!visited[v]) {
+                visited[v] = true;
+                order.push_back(v);
+            }
+        });
+        if (sortByDegree)
+            std::stable_sort(order.begin() + firstNeighbor, order.end(), [&](node v, node w) {
+                return totalDegree(G, v) < totalDegree(G, w);
+            });
+    }
+}
+
+std::vector<node> sortedByDegree(const Graph &G, bool descending) {
+    std::vector<node> nodes(G.nodeRange().begin(), G.nodeRange().end());
+    Aux::Parallel::sort(nodes.begin(), nodes.end(), [&](node u, node v) {
+        const count degU = totalDegree(G, u), degV = totalDegree(G, v);
+        if (degU != degV)
+            return descending ? degU > degV : degU < degV;
+        return u < v;
+    });
+    return nodes;
+}
+
+std::vector<node> traverseAll(const Graph &G, const std::vector<node> &roots, bool sortByDegree) {
+    std::vector<bool> visited(G.upperNodeIdBound());
+    std::vector<node> order;
+    order.reserve(G.numberOfNodes());
+    for (const node root : roots)
+        if (!visited[root])
+            traverseComponent(G, root, sortByDegree, visited, order);
+    return order;
+}
+
+} // namespace
+
+std::vector<node> degreeDescending(const Graph &G) {
+    return orderToPermutation(G, sortedByDegree(G, true));
+}
+
+std::vector<node> breadthFirst(const Graph &G) {
+    return orderToPermutation(G, traverseAll(G, sortedByDegree(G, true), false));
+}
+
+std::vector<node> reverseCuthillMcKee(const Graph &G) {
+    auto order = traverseAll(G, sortedByDegree(G, false), true);
+    std::reverse(order.begin(), order.end());
+    return orderToPermutation(G, order);
+}
+
+std::vector<node> communityOrder(const Graph &G, const Partition &communities) {
+    const auto bfsOrder = traverseAll(G, sortedByDegree(G, true), false);
+
+    // Rank of each community by its first node in breadth-first order.
+    std::vector<index> communityRank(communities.upperBound(), none);
+    index nextRank = 0;
+    for (const node u : bfsOrder) {
+        const index c = communities.subsetOf(u);
+        if (c != none && communityRank[c] == none)
+            communityRank[c] = nextRank++;
+    }
+
+    std::vector<index> position(G.upperNodeIdBound());
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(bfsOrder.size()); ++i)
+        position[bfsOrder[i]] = i;
+
+    auto order = bfsOrder;
+    const auto rankOf = [&](node u) -> index {
+        const index c = communities.subsetOf(u);
+        return c == none ? none : communityRank[c];
+    };
+    Aux::Parallel::sort(order.begin(), order.end(), [&](node u, node v) {
+        return std::make_tuple(rankOf(u), position[u]) < std::make_tuple(rankOf(v), position[v]);
+    });
+
+    return orderToPermutation(G, order);
+}
+
+std::vector<node> invert(const std::vector<node> &oldToNew) {
+    const count n = std::count_if(oldToNew.begin(), oldToNew.end(),
+                                  [](node newId) { return newId != none; });
+    std::vector<node> newToOld(n);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(oldToNew.size()); ++u)
+        if (oldToNew[u] != none)
+            newToOld[oldToNew[u]] = u;
+    return newToOld;
+}
+
+Graph apply(const Graph &G, const std::vector<node> &oldToNew) {
+    if (oldToNew.size() != G.upperNodeIdBound())
+        throw std::runtime_error("The permutation must have upperNodeIdBound() entries.");
+    return GraphTools::getRemappedGraph(G, G.numberOfNodes(),
+                                        [&oldToNew](node u) { return oldToNew[u]; });
+}
+
+} // namespace NodeReordering
+
+} // namespace NetworKit
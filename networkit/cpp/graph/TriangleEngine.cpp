@@ -0,0 +1,149 @@
+/*
+ * TriangleEngine.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include <networkit/graph/TriangleEngine.hpp>
+
+namespace NetworKit {
+
+TriangleEngine::TriangleEngine(const Graph &G, bool withEdgeIds) : G(&G), withEdgeIds(withEdgeIds) {
+    if (G.isDirected())
+        throw std::runtime_error("Triangles are only supported for undirected graphs.");
+    if (withEdgeIds)
+        requireEdgeIds();
+
+    const count n = G.numberOfNodes();
+
+    // counting sort of the nodes by degree; forNodes visits the nodes by increasing id, which
+    // breaks the ties
+    count maxDegree = 0;
+    G.forNodes([&](node u) { maxDegree = std::max(maxDegree, G.degree(u)); });
+    std::vector<index> bucketBegin(maxDegree + 2, 0);
+    G.forNodes([&](node u) { ++bucketBegin[G.degree(u) + 1]; });
+    std::partial_sum(bucketBegin.begin(), bucketBegin.end(), bucketBegin.begin());
+
+    nodeOfRank.resize(n);
+    std::vector<node> rank(G.upperNodeIdBound(), none);
+    G.forNodes([&](node u) {
+        const index r = bucketBegin[G.degree(u)]++;
+        nodeOfRank[r] = u;
+        rank[u] = r;
+    });
+
+    // self-loops are dropped as rank[u] > rank[u] never holds
+    outBegin.assign(n + 1, 0);
+    G.parallelForNodes([&](node u) {
+        const node ru = rank[u];
+        count outDegree = 0;
+        G.forNeighborsOf(u, [&](node v) { outDegree += static_cast<count>(rank[v] > ru); });
+        outBegin[ru + 1] = outDegree;
+    });
+    for (node ru = 0; ru < n; ++ru)
+        maxOut = std::max(maxOut, outBegin[ru + 1]);
+    std::partial_sum(outBegin.begin(), outBegin.end(), outBegin.begin());
+
+    outNeighbors.resize(outBegin[n]);
+    if (!withEdgeIds) {
+        G.balancedParallelForNodes([&](node u) {
+            const node ru = rank[u];
+            index pos = outBegin[ru];
+            G.forNeighborsOf(u, [&](node v) {
+                if (rank[v] > ru)
+                    outNeighbors[pos++] = rank[v];
+            });
+            std::sort(outNeighbors.begin() + outBegin[ru], outNeighbors.begin() + pos);
+        });
+        return;
+    }
+
+    outEdgeIds.resize(outBegin[n]);
+    std::vector<std::vector<std::pair<node, edgeid>>> buffers(omp_get_max_threads());
+    G.balancedParallelForNodes([&](node u) {
+        const node ru = rank[u];
+        auto &buffer = buffers[omp_get_thread_num()];
+        buffer.clear();
+        G.forEdgesOf(u, [&](node, node v, edgeid eid) {
+            if (rank[v] > ru)
+                buffer.emplace_back(rank[v], eid);
+        });
+        std::sort(buffer.begin(), buffer.end());
+        index pos = outBegin[ru];
+        for (const auto &[rv, eid] : buffer) {
+            outNeighbors[pos] = rv;
+            outEdgeIds[pos] = eid;
+            ++pos;
+        }
+    });
+}
+
+void TriangleEngine::requireEdgeIds() const {
+    if (!G->hasEdgeIds())
+        throw std::runtime_error("edges have not been indexed - call indexEdges first");
+    if (!withEdgeIds)
+        throw std::runtime_error("The edge ids have not been stored, set withEdgeIds.");
+}
+
+count TriangleEngine::numberOfTriangles() const {
+    count triangles = 0;
+    forRanks<true>([&](node ru, std::vector<index> &marker) {
+        count local = 0;
+        auto perTriangle = [&](index, index, index) { ++local; };
+        trianglesOfRank(ru, marker, perTriangle);
+        if (local) {
+#pragma omp atomic
+            triangles += local;
+        }
+    });
+    return triangles;
+}
+
+std::vector<count> TriangleEngine::trianglesPerNode() const {
+    std::vector<count> byRank(nodeOfRank.size(), 0);
+    forRanks<true>([&](node ru, std::vector<index> &marker) {
+        // only u is exclusive to this thread, v and w can be the smallest node of other triangles
+        count local = 0;
+        auto perTriangle = [&](index i, index j, index) {
+            ++local;
+#pragma omp atomic
+            ++byRank[outNeighbors[i]];
+#pragma omp atomic
+            ++byRank[outNeighbors[j]];
+        };
+        trianglesOfRank(ru, marker, perTriangle);
+        if (local) {
+#pragma omp atomic
+            byRank[ru] += local;
+        }
+    });
+
+    std::vector<count> result(G->upperNodeIdBound(), 0);
+#pragma omp parallel for
+    for (omp_index ru = 0; ru < static_cast<omp_index>(nodeOfRank.size()); ++ru)
+        result[nodeOfRank[ru]] = byRank[ru];
+    return result;
+}
+
+std::vector<count> TriangleEngine::trianglesPerEdge() const {
+    requireEdgeIds();
+    std::vector<count> result(G->upperEdgeIdBound(), 0);
+    forRanks<true>([&](node ru, std::vector<index> &marker) {
+        auto perTriangle = [&](index i, index j, index k) {
+#pragma omp atomic
+            ++result[outEdgeIds[i]];
+#pragma omp atomic
+            ++result[outEdgeIds[j]];
+#pragma omp atomic
+            ++result[outEdgeIds[k]];
+        };
+        trianglesOfRank(ru, marker, perTriangle);
+    });
+    return result;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,237 @@
+/*
+ * CSRGraphGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/centrality/Betweenness.hpp>
+#include <networkit/centrality/PageRank.hpp>
+#include <networkit/components/ConnectedComponents.hpp>
+#include <networkit/distance/BFS.hpp>
+#include <networkit/distance/Dijkstra.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/BFS.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/CSRGraphAlgorithms.hpp>
+#include <networkit/graph/Dijkstra.hpp>
+#include <networkit/graph/GraphTools.hpp>
+
+namespace NetworKit {
+
+class CSRGraphGTest : public testing::TestWithParam<std::tuple<bool, bool, bool>> {
+protected:
+    bool weighted() const noexcept { return std::get<0>(GetParam()); }
+    bool directed() const noexcept { return std::get<1>(GetParam()); }
+    bool indexed() const noexcept { return std::get<2>(GetParam()); }
+
+    Graph generateGraph(count n, double p) const {
+        Aux::Random::setSeed(42, false);
+        auto G = ErdosRenyiGenerator(n, p, directed()).generate();
+        if (weighted()) {
+            G = GraphTools::toWeighted(G);
+            G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+        }
+        // a self-loop and a deleted node make the node and edge counters interesting
+        G.addEdge(1, 1, 0.5);
+        G.removeNode(3);
+        if (indexed())
+            G.indexEdges();
+        return G;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, CSRGraphGTest,
+                         testing::Combine(testing::Bool(), testing::Bool(), testing::Bool()));
+
+TEST_P(CSRGraphGTest, testBasicProperties) {
+    const auto G = generateGraph(100, 0.1);
+    const CSRGraph C(G);
+
+    EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+    EXPECT_EQ(C.upperNodeIdBound(), G.upperNodeIdBound());
+    EXPECT_EQ(C.isWeighted(), G.isWeighted());
+    EXPECT_EQ(C.isDirected(), G.isDirected());
+    EXPECT_EQ(C.hasEdgeIds(), G.hasEdgeIds());
+    // both sums are computed in parallel, so the order of the summands may differ
+    EXPECT_NEAR(C.totalEdgeWeight(), G.totalEdgeWeight(), 1e-9);
+    EXPECT_FALSE(C.hasNode(3));
+
+    G.forNodes([&](node u) {
+        EXPECT_TRUE(C.hasNode(u));
+        EXPECT_EQ(C.degree(u), G.degree(u));
+        EXPECT_EQ(C.degreeIn(u), G.degreeIn(u));
+        EXPECT_DOUBLE_EQ(C.weightedDegree(u), G.weightedDegree(u));
+        EXPECT_DOUBLE_EQ(C.weightedDegree(u, true), G.weightedDegree(u, true));
+        EXPECT_DOUBLE_EQ(C.weightedDegreeIn(u), G.weightedDegreeIn(u));
+        for (index i = 0; i < G.degree(u); ++i) {
+            EXPECT_EQ(C.getIthNeighbor(u, i), G.getIthNeighbor(u, i));
+            EXPECT_EQ(C.getIthNeighborWeight(u, i), G.getIthNeighborWeight(u, i));
+        }
+    });
+
+    G.forNodePairs([&](node u, node v) {
+        EXPECT_EQ(C.hasEdge(u, v), G.hasEdge(u, v));
+        EXPECT_EQ(C.weight(u, v), G.weight(u, v));
+    });
+}
+
+TEST_P(CSRGraphGTest, testEdgeIteration) {
+    const auto G = generateGraph(100, 0.1);
+    const CSRGraph C(G);
+
+    std::vector<WeightedEdgeWithId> expected, actual;
+    G.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+        expected.emplace_back(u, v, ew, eid);
+    });
+    C.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+        actual.emplace_back(u, v, ew, eid);
+    });
+    ASSERT_EQ(actual.size(), expected.size());
+    for (index i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].u, expected[i].u);
+        EXPECT_EQ(actual[i].v, expected[i].v);
+        EXPECT_EQ(actual[i].weight, expected[i].weight);
+        EXPECT_EQ(actual[i].eid, expected[i].eid);
+    }
+
+    count edges = 0;
+    C.parallelForEdges([&](node u, node v) {
+        EXPECT_TRUE(G.hasEdge(u, v));
+#pragma omp atomic
+        ++edges;
+    });
+    EXPECT_EQ(edges, G.numberOfEdges());
+
+    EXPECT_NEAR(C.parallelSumForEdges([](node, node, edgeweight ew) { return ew; }),
+                G.parallelSumForEdges([](node, node, edgeweight ew) { return ew; }), 1e-9);
+}
+
+TEST_P(CSRGraphGTest, testNeighborIteration) {
+    const auto G = generateGraph(100, 0.1);
+    const CSRGraph C(G);
+
+    G.forNodes([&](node u) {
+        std::vector<std::pair<node, edgeweight>> expected, actual;
+        G.forNeighborsOf(u, [&](node v, edgeweight ew) { expected.emplace_back(v, ew); });
+        C.forNeighborsOf(u, [&](node v, edgeweight ew) { actual.emplace_back(v, ew); });
+        EXPECT_EQ(actual, expected);
+
+        expected.clear();
+        actual.clear();
+        G.forInNeighborsOf(u, [&](node v, edgeweight ew) { expected.emplace_back(v, ew); });
+        C.forInNeighborsOf(u, [&](node v, edgeweight ew) { actual.emplace_back(v, ew); });
+        EXPECT_EQ(actual, expected);
+
+        std::vector<edgeid> expectedIds, actualIds;
+        G.forInEdgesOf(u, [&](node, node, edgeid eid) { expectedIds.push_back(eid); });
+        C.forInEdgesOf(u, [&](node, node, edgeid eid) { actualIds.push_back(eid); });
+        EXPECT_EQ(actualIds, expectedIds);
+    });
+}
+
+TEST_P(CSRGraphGTest, testTraversal) {
+    const auto G = generateGraph(200, 0.05);
+    const CSRGraph C(G);
+
+    std::vector<std::pair<node, count>> expectedBFS, actualBFS;
+    Traversal::BFSfrom(G, 0, [&](node u, count dist) { expectedBFS.emplace_back(u, dist); });
+    Traversal::BFSfrom(C, 0, [&](node u, count dist) { actualBFS.emplace_back(u, dist); });
+    EXPECT_EQ(actualBFS, expectedBFS);
+
+    std::vector<edgeweight> expectedDist(G.upperNodeIdBound()), actualDist(G.upperNodeIdBound());
+    Traversal::DijkstraFrom(G, 0, [&](node u, edgeweight dist) { expectedDist[u] = dist; });
+    Traversal::DijkstraFrom(C, 0, [&](node u, edgeweight dist) { actualDist[u] = dist; });
+    EXPECT_EQ(actualDist, expectedDist);
+}
+
+TEST_P(CSRGraphGTest, testDistances) {
+    const auto G = generateGraph(200, 0.02);
+    const CSRGraph C(G);
+
+    BFS bfs(G, 0, false);
+    bfs.run();
+    EXPECT_EQ(CSRGraphAlgorithms::bfsDistances(C, 0), bfs.getDistances());
+
+    Dijkstra dijkstra(G, 0, false);
+    dijkstra.run();
+    EXPECT_EQ(CSRGraphAlgorithms::dijkstraDistances(C, 0), dijkstra.getDistances());
+}
+
+TEST_P(CSRGraphGTest, testConnectedComponents) {
+    const auto G = generateGraph(300, 0.005);
+    const CSRGraph C(G);
+
+    count numberOfComponents = 0;
+    if (directed()) {
+        EXPECT_THROW(CSRGraphAlgorithms::connectedComponents(C, numberOfComponents),
+                     std::runtime_error);
+        return;
+    }
+
+    const auto component = CSRGraphAlgorithms::connectedComponents(C, numberOfComponents);
+    ConnectedComponents cc(G);
+    cc.run();
+    EXPECT_EQ(numberOfComponents, cc.numberOfComponents());
+    EXPECT_EQ(component[3], none);
+
+    // the component ids may be numbered differently, but must induce the same partition
+    std::vector<index> toReference(numberOfComponents, none);
+    G.forNodes([&](node u) {
+        ASSERT_LT(component[u], numberOfComponents);
+        if (toReference[component[u]] == none)
+            toReference[component[u]] = cc.componentOfNode(u);
+        EXPECT_EQ(toReference[component[u]], cc.componentOfNode(u));
+    });
+}
+
+TEST_P(CSRGraphGTest, testPageRank) {
+    const auto G = generateGraph(200, 0.05);
+    const CSRGraph C(G);
+
+    PageRank pr(G);
+    pr.run();
+    const auto scores = CSRGraphAlgorithms::pageRank(C);
+    G.forNodes([&](node u) { EXPECT_NEAR(scores[u], pr.score(u), 1e-8); });
+
+    PageRank prNormalized(G, 0.9, 1e-9, true, PageRank::SinkHandling::DISTRIBUTE_SINKS);
+    prNormalized.norm = PageRank::Norm::L1_NORM;
+    prNormalized.maxIterations = 20;
+    prNormalized.run();
+    const auto scoresNormalized = CSRGraphAlgorithms::pageRank(
+        C, 0.9, 1e-9, true, PageRank::SinkHandling::DISTRIBUTE_SINKS, PageRank::Norm::L1_NORM, 20);
+    G.forNodes([&](node u) { EXPECT_NEAR(scoresNormalized[u], prNormalized.score(u), 1e-12); });
+}
+
+TEST_P(CSRGraphGTest, testBetweenness) {
+    const auto G = generateGraph(200, 0.03);
+    const CSRGraph C(G);
+
+    for (const bool normalized : {false, true}) {
+        Betweenness bc(G, normalized);
+        bc.run();
+        const auto scores = CSRGraphAlgorithms::betweenness(C, normalized);
+        G.forNodes([&](node u) {
+            EXPECT_NEAR(scores[u], bc.score(u), 1e-9 * std::max(1.0, bc.score(u)));
+        });
+    }
+}
+
+TEST_P(CSRGraphGTest, testEmptyGraph) {
+    const CSRGraph C(Graph(0, weighted(), directed()));
+    EXPECT_EQ(C.numberOfNodes(), 0);
+    EXPECT_EQ(C.numberOfEdges(), 0);
+    EXPECT_EQ(C.upperNodeIdBound(), 0);
+    count visited = 0;
+    C.forNodes([&](node) { ++visited; });
+    C.forEdges([&](node, node) { ++visited; });
+    EXPECT_EQ(visited, 0);
+}
+
+} // namespace NetworKit
@@ -0,0 +1,93 @@
+/*
+ * GraphGBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <networkit/graph/Graph.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
+
+#include "../../BenchmarkGraphs.hpp"
+
+namespace NetworKit {
+
+namespace {
+
+using BenchmarkGraphs::erdosRenyi;
+using BenchmarkGraphs::graphSizes;
+
+std::vector<std::pair<node, node>> edgesOf(const Graph &G) {
+    std::vector<std::pair<node, node>> edges;
+    edges.reserve(G.numberOfEdges());
+    G.forEdges([&](node u, node v) { edges.emplace_back(u, v); });
+    return edges;
+}
+
+void BM_GraphAddEdge(benchmark::State &state) {
+    const Graph &input = erdosRenyi(state.range(0));
+    const auto edges = edgesOf(input);
+    for (auto _ : state) {
+        Graph G(input.numberOfNodes());
+        for (const auto &[u, v] : edges)
+            G.addEdge(u, v);
+        benchmark::DoNotOptimize(G.numberOfEdges());
+    }
+    state.SetItemsProcessed(state.iterations() * edges.size());
+}
+
+void BM_GraphBuilderParallel(benchmark::State &state) {
+    const Graph &input = erdosRenyi(state.range(0));
+    for (auto _ : state) {
+        GraphBuilder builder(input.upperNodeIdBound());
+        input.balancedParallelForNodes([&](node u) {
+            input.forNeighborsOf(u, [&](node v) {
+                if (u < v)
+                    builder.addHalfEdge(u, v);
+            });
+        });
+        Graph G = builder.completeGraph(true);
+        benchmark::DoNotOptimize(G.numberOfEdges());
+    }
+    state.SetItemsProcessed(state.iterations() * input.numberOfEdges());
+}
+
+void BM_GraphForEdges(benchmark::State &state) {
+    const Graph &G = erdosRenyi(state.range(0));
+    for (auto _ : state) {
+        node sum = 0;
+        G.forEdges([&](node u, node v) { sum += u ^ v; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * G.numberOfEdges());
+}
+
+void BM_GraphParallelForEdges(benchmark::State &state) {
+    const Graph &G = erdosRenyi(state.range(0));
+    for (auto _ : state) {
+        const double sum = G.parallelSumForEdges([](node u, node v) { return double(u ^ v); });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * G.numberOfEdges());
+}
+
+void BM_GraphForNeighbors(benchmark::State &state) {
+    const Graph &G = erdosRenyi(state.range(0));
+    for (auto _ : state) {
+        node sum = 0;
+        G.forNodes([&](node u) { G.forNeighborsOf(u, [&](node v) { sum += v; }); });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * G.numberOfEdges());
+}
+
+} // namespace
+
+BENCHMARK(BM_GraphAddEdge)->Apply(graphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GraphBuilderParallel)->Apply(graphSizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_GraphForEdges)->Apply(graphSizes);
+BENCHMARK(BM_GraphParallelForEdges)->Apply(graphSizes)->UseRealTime();
+BENCHMARK(BM_GraphForNeighbors)->Apply(graphSizes);
+
+} // namespace NetworKit
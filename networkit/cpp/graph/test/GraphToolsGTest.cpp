@@ -637,6 +637,28 @@ TEST_P(GraphToolsGTest, testGetRemappedGraphWithDelete) {
     }
 }
 
+TEST_P(GraphToolsGTest, testGetRemappedGraphInvalidMap) {
+    const auto n = 4;
+    Graph G(n, weighted(), directed());
+    for (auto i : {0, 1, 2})
+        G.addEdge(i, i + 1, i);
+
+    // two nodes with the same id and an id out of range
+    EXPECT_THROW(GraphTools::getRemappedGraph(G, n, [](node i) { return i / 2; }),
+                 std::runtime_error);
+    EXPECT_THROW(GraphTools::getRemappedGraph(G, n, [](node i) { return i + 1; }),
+                 std::runtime_error);
+
+    // skipped nodes do not need an id
+    EXPECT_NO_THROW(GraphTools::getRemappedGraph(
+        G, n - 1, [](node i) { return i == 0 ? 0 : i - 1; }, [](node i) { return i == 0; }));
+
+    const std::unordered_map<node, node> collision{{0, 0}, {1, 1}, {2, 1}, {3, 2}};
+    EXPECT_THROW(GraphTools::getCompactedGraph(G, collision), std::runtime_error);
+    const std::unordered_map<node, node> missing{{0, 0}, {1, 1}, {3, 2}};
+    EXPECT_THROW(GraphTools::getCompactedGraph(G, missing), std::runtime_error);
+}
+
 TEST_P(GraphToolsGTest, testCopyNodes) {
     constexpr count n = 200;
     constexpr double p = 0.01;
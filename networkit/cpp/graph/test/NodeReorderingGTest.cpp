@@ -0,0 +1,133 @@
+/*
+ * NodeReorderingGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/BFS.hpp>
+#include <networkit/graph/NodeReordering.hpp>
+
+namespace NetworKit {
+
+class NodeReorderingGTest : public testing::TestWithParam<bool> {
+protected:
+    bool directed() const noexcept { return GetParam(); }
+
+    Graph generateGraph() const {
+        Aux::Random::setSeed(42, false);
+        Graph G = ErdosRenyiGenerator(200, 0.02, directed()).generate();
+        G.removeNode(3);
+        G.removeNode(17);
+        return G;
+    }
+
+    void checkPermutation(const Graph &G, const std::vector<node> &oldToNew) const {
+        ASSERT_EQ(oldToNew.size(), G.upperNodeIdBound());
+        std::vector<bool> used(G.numberOfNodes());
+        for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+            if (!G.hasNode(u)) {
+                EXPECT_EQ(oldToNew[u], none);
+                continue;
+            }
+            ASSERT_LT(oldToNew[u], G.numberOfNodes());
+            EXPECT_FALSE(used[oldToNew[u]]);
+            used[oldToNew[u]] = true;
+        }
+
+        const auto newToOld = NodeReordering::invert(oldToNew);
+        ASSERT_EQ(newToOld.size(), G.numberOfNodes());
+        for (node v = 0; v < newToOld.size(); ++v)
+            EXPECT_EQ(oldToNew[newToOld[v]], v);
+
+        const Graph H = NodeReordering::apply(G, oldToNew);
+        EXPECT_EQ(H.numberOfNodes(), G.numberOfNodes());
+        EXPECT_EQ(H.numberOfEdges(), G.numberOfEdges());
+        EXPECT_EQ(H.numberOfSelfLoops(), G.numberOfSelfLoops());
+        G.forEdges([&](node u, node v) { EXPECT_TRUE(H.hasEdge(oldToNew[u], oldToNew[v])); });
+        H.forNodes([&](node v) { EXPECT_EQ(H.degreeIn(v), G.degreeIn(newToOld[v])); });
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, NodeReorderingGTest, testing::Values(false, true));
+
+TEST_P(NodeReorderingGTest, testDegreeDescending) {
+    const Graph G = generateGraph();
+    const auto oldToNew = NodeReordering::degreeDescending(G);
+    checkPermutation(G, oldToNew);
+
+    const auto newToOld = NodeReordering::invert(oldToNew);
+    const auto degree = [&](node u) {
+        return G.isDirected() ? G.degreeOut(u) + G.degreeIn(u) : G.degree(u);
+    };
+    for (index i = 1; i < newToOld.size(); ++i)
+        EXPECT_GE(degree(newToOld[i - 1]), degree(newToOld[i]));
+}
+
+TEST_P(NodeReorderingGTest, testBreadthFirst) {
+    const Graph G = generateGraph();
+    checkPermutation(G, NodeReordering::breadthFirst(G));
+}
+
+TEST_P(NodeReorderingGTest, testReverseCuthillMcKee) {
+    const Graph G = generateGraph();
+    checkPermutation(G, NodeReordering::reverseCuthillMcKee(G));
+
+    // A shuffled path has bandwidth 1 after the reordering.
+    const count n = 50;
+    std::vector<node> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), Aux::Random::getURNG());
+    Graph path(n, false, directed());
+    for (index i = 0; i + 1 < n; ++i)
+        path.addEdge(perm[i], perm[i + 1]);
+
+    const auto oldToNew = NodeReordering::reverseCuthillMcKee(path);
+    path.forEdges([&](node u, node v) {
+        EXPECT_EQ(std::max(oldToNew[u], oldToNew[v]) - std::min(oldToNew[u], oldToNew[v]), 1);
+    });
+}
+
+TEST_P(NodeReorderingGTest, testCommunityOrder) {
+    const Graph G = generateGraph();
+    Partition communities(G.upperNodeIdBound());
+    G.forNodes([&](node u) { communities[u] = u % 5; });
+    communities.setUpperBound(5);
+    communities[0] = none;
+
+    const auto oldToNew = NodeReordering::communityOrder(G, communities);
+    checkPermutation(G, oldToNew);
+
+    // the communities are contiguous, unassigned nodes come last
+    const auto newToOld = NodeReordering::invert(oldToNew);
+    EXPECT_EQ(newToOld.back(), 0);
+    std::vector<bool> finished(5);
+    for (index i = 1; i + 1 < newToOld.size(); ++i) {
+        const index previous = communities[newToOld[i - 1]], current = communities[newToOld[i]];
+        if (previous != current) {
+            EXPECT_FALSE(finished[current]);
+            finished[previous] = true;
+        }
+    }
+}
+
+TEST_P(NodeReorderingGTest, testMapToOriginal) {
+    const Graph G = generateGraph();
+    const auto oldToNew = NodeReordering::breadthFirst(G);
+    const Graph H = NodeReordering::apply(G, oldToNew);
+
+    const node source = 0;
+    std::vector<count> distG(G.upperNodeIdBound(), none), distH(H.upperNodeIdBound(), none);
+    Traversal::BFSfrom(G, source, [&](node u, count dist) { distG[u] = dist; });
+    Traversal::BFSfrom(H, oldToNew[source], [&](node u, count dist) { distH[u] = dist; });
+
+    const auto mapped = NodeReordering::mapToOriginal(distH, oldToNew);
+    G.forNodes([&](node u) { EXPECT_EQ(mapped[u], distG[u]); });
+}
+
+} // namespace NetworKit
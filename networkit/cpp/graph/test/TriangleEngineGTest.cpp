@@ -0,0 +1,137 @@
+/*
+ * TriangleEngineGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <set>
+#include <stdexcept>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/BarabasiAlbertGenerator.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/graph/TriangleEngine.hpp>
+
+namespace NetworKit {
+
+class TriangleEngineGTest : public testing::Test {
+protected:
+    // Counts the triangles per node and per edge by checking all pairs of neighbors.
+    static void naiveCounts(const Graph &G, std::vector<count> &perNode,
+                            std::vector<count> &perEdge, std::set<std::array<node, 3>> &listed) {
+        perNode.assign(G.upperNodeIdBound(), 0);
+        perEdge.assign(G.upperEdgeIdBound(), 0);
+        listed.clear();
+        G.forEdges([&](node u, node v, edgeid uv) {
+            if (u == v)
+                return;
+            G.forNeighborsOf(u, [&](node w) {
+                if (w == u || w == v || !G.hasEdge(v, w))
+                    return;
+                ++perEdge[uv];
+                std::array<node, 3> triangle{u, v, w};
+                std::sort(triangle.begin(), triangle.end());
+                if (listed.insert(triangle).second) {
+                    for (const node x : triangle)
+                        ++perNode[x];
+                }
+            });
+        });
+    }
+
+    static void checkEngine(const Graph &G) {
+        std::vector<count> perNode, perEdge;
+        std::set<std::array<node, 3>> listed;
+        naiveCounts(G, perNode, perEdge, listed);
+
+        const TriangleEngine engine(G, true);
+        EXPECT_EQ(engine.numberOfTriangles(), listed.size());
+        EXPECT_EQ(engine.trianglesPerNode(), perNode);
+        EXPECT_EQ(engine.trianglesPerEdge(), perEdge);
+
+        std::set<std::array<node, 3>> found;
+        engine.forTriangles([&](node u, node v, node w) {
+            std::array<node, 3> triangle{u, v, w};
+            std::sort(triangle.begin(), triangle.end());
+            EXPECT_TRUE(found.insert(triangle).second);
+        });
+        EXPECT_EQ(found, listed);
+
+        engine.parallelForTrianglesWithEdgeIds(
+            [&](node u, node v, node w, edgeid uv, edgeid uw, edgeid vw) {
+                EXPECT_EQ(G.edgeId(u, v), uv);
+                EXPECT_EQ(G.edgeId(u, w), uw);
+                EXPECT_EQ(G.edgeId(v, w), vw);
+            });
+    }
+};
+
+TEST_F(TriangleEngineGTest, testSmallGraph) {
+    // two triangles sharing the edge (1, 2), a self-loop and an isolated node
+    Graph G(6);
+    G.addEdge(0, 1);
+    G.addEdge(0, 2);
+    G.addEdge(1, 2);
+    G.addEdge(1, 3);
+    G.addEdge(2, 3);
+    G.addEdge(3, 4);
+    G.addEdge(4, 4);
+    G.indexEdges();
+
+    const TriangleEngine engine(G, true);
+    EXPECT_EQ(engine.numberOfTriangles(), 2);
+    EXPECT_EQ(engine.trianglesPerNode(), std::vector<count>({1, 2, 2, 1, 0, 0}));
+    const auto perEdge = engine.trianglesPerEdge();
+    EXPECT_EQ(perEdge[G.edgeId(1, 2)], 2);
+    EXPECT_EQ(perEdge[G.edgeId(0, 1)], 1);
+    EXPECT_EQ(perEdge[G.edgeId(3, 4)], 0);
+    EXPECT_EQ(perEdge[G.edgeId(4, 4)], 0);
+}
+
+TEST_F(TriangleEngineGTest, testRandomGraphs) {
+    Aux::Random::setSeed(42, false);
+    for (const double p : {0.01, 0.05, 0.2}) {
+        Graph G = ErdosRenyiGenerator(300, p).generate();
+        G.removeNode(7);
+        G.addEdge(3, 3);
+        G.indexEdges();
+        checkEngine(G);
+    }
+}
+
+TEST_F(TriangleEngineGTest, testHubsAndGalloping) {
+    Aux::Random::setSeed(42, false);
+    Graph G = BarabasiAlbertGenerator(5, 2000).generate();
+
+    // a clique makes its nodes hubs, the star around node 0 leads to lists of different length
+    for (node u = 100; u < 200; ++u)
+        for (node v = u + 1; v < 200; ++v)
+            if (!G.hasEdge(u, v))
+                G.addEdge(u, v);
+    for (node v = 1; v < 2000; v += 3)
+        if (!G.hasEdge(0, v))
+            G.addEdge(0, v);
+    G.indexEdges();
+
+    const TriangleEngine engine(G);
+    EXPECT_GE(engine.maxOutDegree(), TriangleEngine::hubThreshold);
+    checkEngine(G);
+}
+
+TEST_F(TriangleEngineGTest, testRequirements) {
+    Graph directed(3, false, true);
+    EXPECT_THROW(TriangleEngine{directed}, std::runtime_error);
+
+    Graph G(3);
+    G.addEdge(0, 1);
+    EXPECT_THROW(TriangleEngine(G, true), std::runtime_error);
+    G.indexEdges();
+    EXPECT_THROW(TriangleEngine(G).trianglesPerEdge(), std::runtime_error);
+}
+
+} // namespace NetworKit
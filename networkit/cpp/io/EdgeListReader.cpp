@@ -5,12 +5,15 @@
  *      Author: cls
  */
 
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <tuple>
+#include <unordered_map>
+#include <omp.h>
 
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
-#include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
 #include <networkit/io/EdgeListReader.hpp>
 #include <networkit/io/MemoryMappedFile.hpp>
 
@@ -34,135 +37,245 @@ const std::map<std::string, node> &EdgeListReader::getNodeMap() const {
     return this->mapNodeIds;
 }
 
+namespace {
+
+// Edges parsed from one chunk of the input file; node ids are chunk-local if the ids are not
+// continuous.
+struct ParsedChunk {
+    std::vector<std::pair<node, node>> edges;
+    std::vector<edgeweight> weights;
+    std::vector<std::string> names; // names of the chunk-local ids in order of appearance
+};
+
+// Edge as stored in the bucket of its first endpoint; seq is the position of the edge in the
+// file and is used to keep the first occurrence of multi-edges.
+struct BucketEntry {
+    node other;
+    index seq;
+    edgeweight weight;
+};
+
+bool isLineEnding(char c) {
+    return c == '\n' || c == '\r';
+}
+
+} // namespace
+
 Graph EdgeListReader::read(const std::string &path) {
     this->mapNodeIds.clear();
     MemoryMappedFile mmfile(path);
-    auto it = mmfile.cbegin();
-    auto end = mmfile.cend();
-
-    bool weighted = false;
-    bool checkedWeighted = false;
-    Graph graph(0, weighted, directed);
+    const char *const begin = mmfile.cbegin();
+    const char *const end = mmfile.cend();
 
     DEBUG("separator: ", this->separator);
     DEBUG("first node: ", this->firstNode);
 
-    auto skipWhitespaceAndSeparator = [this, &it, &end]() -> void {
-        while (it != end && (*it == ' ' || *it == separator))
-            ++it;
-    };
+    auto isSeparator = [this](char c) { return c == ' ' || c == separator; };
+    auto isComment = [this](char c) { return !commentPrefix.empty() && c == commentPrefix[0]; };
 
-    // This function parses in whole words
-    auto scanWord = [this, &it, &end]() -> std::string {
-        std::string word = "";
-        while (it != end && *it != ' ' && *it != separator && *it != '\n' && *it != '\r') {
-            word += *it;
-            ++it;
+    // Calls handle(lineBegin, lineEnd) for every non-empty, non-comment line in [it, chunkEnd);
+    // leading whitespace and separators are skipped.
+    auto forLines = [&](const char *it, const char *chunkEnd, auto handle) {
+        while (it < chunkEnd) {
+            while (it < chunkEnd && isSeparator(*it))
+                ++it;
+            const char *lineEnd = it;
+            while (lineEnd < chunkEnd && !isLineEnding(*lineEnd))
+                ++lineEnd;
+            if (it < lineEnd && !isComment(*it))
+                handle(it, lineEnd);
+            it = lineEnd + 1;
         }
-        return word;
     };
 
-    auto scanId = [&, this]() -> node {
-        if (continuous) {
+    // Whether the graph is weighted is decided by the first edge line.
+    bool weighted = false;
+    {
+        bool checkedWeighted = false;
+        const char *it = begin;
+        while (it < end && !checkedWeighted) {
+            const char *lineEnd = it;
+            while (lineEnd < end && !isLineEnding(*lineEnd))
+                ++lineEnd;
+            forLines(it, lineEnd, [&](const char *lineIt, const char *lineEnd) {
+                checkedWeighted = true;
+                for (int token = 0; lineIt < lineEnd; ++token) {
+                    while (lineIt < lineEnd && !isSeparator(*lineIt))
+                        ++lineIt;
+                    while (lineIt < lineEnd && isSeparator(*lineIt))
+                        ++lineIt;
+                    if (token == 1 && lineIt < lineEnd) {
+                        weighted = true;
+                        DEBUG("Detected graph as weighted");
+                    }
+                }
+            });
+            it = lineEnd + 1;
+        }
+    }
+
+    // Split the file into chunks that start at the beginning of a line.
+    const count maxChunks =
+        std::max<count>(1, std::min<count>(static_cast<count>(end - begin) / minChunkSize,
+                                           4 * static_cast<count>(omp_get_max_threads())));
+    std::vector<const char *> chunkBegin(maxChunks + 1, end);
+    chunkBegin[0] = begin;
+    for (index c = 1; c < maxChunks; ++c) {
+        const char *it = std::max(begin + c * (end - begin) / maxChunks, chunkBegin[c - 1]);
+        while (it < end && it > begin && !isLineEnding(*(it - 1)))
+            ++it;
+        chunkBegin[c] = it;
+    }
+
+    std::vector<ParsedChunk> chunks(maxChunks);
+    std::vector<node> maxNodeId(maxChunks, 0);
+    std::vector<std::string> errors(maxChunks);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(maxChunks); ++c) {
+        auto &chunk = chunks[c];
+        std::unordered_map<std::string, node> localIds;
+
+        auto scanId = [&](const char *&it, const char *lineEnd) -> node {
+            if (continuous) {
+                if (it == lineEnd || !std::isdigit(static_cast<unsigned char>(*it)))
+                    throw std::runtime_error("Scanning node failed. The file may be corrupt.");
+                node value = 0;
+                for (; it < lineEnd && std::isdigit(static_cast<unsigned char>(*it)); ++it)
+                    value = 10 * value + static_cast<node>(*it - '0');
+                if (value < firstNode)
+                    throw std::runtime_error("Node id is smaller than the first node id.");
+                maxNodeId[c] = std::max(maxNodeId[c], value - firstNode + 1);
+                return value - firstNode;
+            }
+
+            const char *wordBegin = it;
+            while (it < lineEnd && !isSeparator(*it))
+                ++it;
+            auto result = localIds.emplace(std::string(wordBegin, it), chunk.names.size());
+            if (result.second)
+                chunk.names.push_back(result.first->first);
+            return result.first->second;
+        };
+
+        auto scanWeight = [](const char *&it, const char *lineEnd) -> edgeweight {
+            // Copy the token since strtod does not respect the end of the line.
+            char buffer[64];
+            const auto length = std::min<std::ptrdiff_t>(lineEnd - it, sizeof(buffer) - 1);
+            std::copy(it, it + length, buffer);
+            buffer[length] = '\0';
             char *past;
-            auto value = strtol(it, &past, 10);
-            if (past <= it)
-                throw std::runtime_error("Scanning node failed. The file may be corrupt.");
-            it = past;
+            const auto value = strtod(buffer, &past);
+            if (past == buffer)
+                throw std::runtime_error("Error in parsing file - looking for weight failed");
+            it += past - buffer;
             return value;
-        } else {
-            auto word = scanWord();
-            auto it = mapNodeIds.find(word);
-            if (it != mapNodeIds.end())
-                return it->second;
-            auto result = mapNodeIds.insert({word, graph.addNode()});
-            if (!result.second)
-                throw std::runtime_error("Error in mapping nodes");
-            return result.first->second;
+        };
+
+        try {
+            forLines(chunkBegin[c], chunkBegin[c + 1], [&](const char *it, const char *lineEnd) {
+                const node source = scanId(it, lineEnd);
+                if (it == lineEnd)
+                    throw std::runtime_error("Unexpected end of line");
+                if (!isSeparator(*it))
+                    throw std::runtime_error(
+                        "Error in parsing file - pointer is whitespace or separator");
+                while (it < lineEnd && isSeparator(*it))
+                    ++it;
+                const node target = scanId(it, lineEnd);
+                chunk.edges.emplace_back(source, target);
+
+                if (weighted) {
+                    while (it < lineEnd && isSeparator(*it))
+                        ++it;
+                    chunk.weights.push_back(scanWeight(it, lineEnd));
+                }
+            });
+        } catch (std::exception &e) {
+            errors[c] = e.what();
         }
-    };
+    }
 
-    auto scanWeight = [&it]() -> edgeweight {
-        char *past;
-        auto value = strtod(it, &past);
-        if (past <= it)
-            throw std::runtime_error("Error in parsing file - looking for weight failed");
-        it = past;
-        return value;
-    };
+    for (const auto &error : errors)
+        if (!error.empty())
+            throw std::runtime_error(error);
 
-    // Returns
-    // 0 iff it does not point to a line ending
-    // 1 iff it is a single-char ending ('\r' or '\n')
-    // 2 iff it is two-char ending ("\r\n")
-    auto detectLineEnding = [&it, &end]() -> size_t {
-        if (*it == '\r') {
-            if ((it + 1) != end && *(it + 1) == '\n')
-                return 2;
-            return 1;
+    // Assign global ids in order of first appearance and translate the chunk-local ids.
+    count numNodes = 0;
+    if (continuous) {
+        numNodes = *std::max_element(maxNodeId.begin(), maxNodeId.end());
+    } else {
+        std::vector<std::vector<node>> localToGlobal(maxChunks);
+        for (index c = 0; c < maxChunks; ++c) {
+            localToGlobal[c].reserve(chunks[c].names.size());
+            for (auto &name : chunks[c].names) {
+                auto result = mapNodeIds.emplace(std::move(name), numNodes);
+                if (result.second)
+                    ++numNodes;
+                localToGlobal[c].push_back(result.first->second);
+            }
         }
-        if (*it == '\n')
-            return 1;
 
-        return 0;
-    };
+#pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index c = 0; c < static_cast<omp_index>(maxChunks); ++c)
+            for (auto &edge : chunks[c].edges)
+                edge = {localToGlobal[c][edge.first], localToGlobal[c][edge.second]};
+    }
 
-    // Map nodes and increase graph size
-    auto mapNode = [&](node in) -> node {
-        if (graph.upperNodeIdBound() <= in - firstNode)
-            graph.addNodes(in - firstNode - graph.upperNodeIdBound() + 1);
+    // Bucket the edges by their first endpoint (the smaller one in undirected graphs).
+    std::vector<index> edgeOffset(maxChunks + 1, 0);
+    for (index c = 0; c < maxChunks; ++c)
+        edgeOffset[c + 1] = edgeOffset[c] + chunks[c].edges.size();
 
-        return in - firstNode;
+    auto orient = [this](std::pair<node, node> edge) {
+        if (!directed && edge.second < edge.first)
+            std::swap(edge.first, edge.second);
+        return edge;
     };
 
-    // This function modifies the graph on input.
-    auto handleEdge = [&graph](node source, node target, edgeweight weight) -> void {
-        if (!graph.hasEdge(source, target)) {
-            graph.addEdge(source, target, weight);
+    std::vector<index> bucketOffset(numNodes + 1, 0);
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(maxChunks); ++c)
+        for (const auto &edge : chunks[c].edges) {
+            const node u = orient(edge).first;
+#pragma omp atomic
+            ++bucketOffset[u + 1];
         }
-    };
+    for (node u = 0; u < numNodes; ++u)
+        bucketOffset[u + 1] += bucketOffset[u];
 
-    while (it < end) {
-        skipWhitespaceAndSeparator();
-        if (detectLineEnding()) {
-            // Comment line
-        } else if (*it == commentPrefix[0]) {
-            while (it != end && !detectLineEnding())
-                ++it;
-        } else {
-            auto sourceId = scanId();
-            if (it == end)
-                throw std::runtime_error("Unexpected end of file");
-            if (!(*it == ' ' || *it == separator))
-                throw std::runtime_error(
-                    "Error in parsing file - pointer is whitespace or separator");
-            skipWhitespaceAndSeparator();
-
-            auto targetId = scanId();
-            skipWhitespaceAndSeparator();
-
-            if (!checkedWeighted) {
-                checkedWeighted = true;
-                if (!detectLineEnding()) {
-                    weighted = true;
-                    DEBUG("Detected graph as weighted");
-                    graph = GraphTools::toWeighted(graph);
-                }
-            }
-            if (weighted) {
-                auto edgeWeight = scanWeight();
-                skipWhitespaceAndSeparator();
-
-                handleEdge(mapNode(sourceId), mapNode(targetId), edgeWeight);
-            } else {
-                handleEdge(mapNode(sourceId), mapNode(targetId), defaultEdgeWeight);
+    std::vector<BucketEntry> buckets(edgeOffset.back());
+    {
+        std::vector<index> fill(bucketOffset.begin(), bucketOffset.end() - 1);
+#pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index c = 0; c < static_cast<omp_index>(maxChunks); ++c) {
+            for (index i = 0; i < chunks[c].edges.size(); ++i) {
+                const auto edge = orient(chunks[c].edges[i]);
+                index pos;
+#pragma omp atomic capture
+                pos = fill[edge.first]++;
+                buckets[pos] = {edge.second, edgeOffset[c] + i,
+                                weighted ? chunks[c].weights[i] : defaultEdgeWeight};
             }
+            chunks[c] = ParsedChunk{};
         }
-        ++it;
     }
 
-    graph.shrinkToFit();
-    return graph;
+    // Multi-edges are ignored; only the first occurrence in the file is added.
+    GraphBuilder builder(numNodes, weighted, directed);
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(numNodes); ++u) {
+        const auto first = buckets.begin() + bucketOffset[u];
+        const auto last = buckets.begin() + bucketOffset[u + 1];
+        std::sort(first, last, [](const BucketEntry &a, const BucketEntry &b) {
+            return std::tie(a.other, a.seq) < std::tie(b.other, b.seq);
+        });
+        for (auto it = first; it != last; ++it)
+            if (it == first || (it - 1)->other != it->other)
+                builder.addHalfEdge(u, it->other, it->weight);
+    }
+
+    return builder.completeGraph(true);
 }
 
 } /* namespace NetworKit */
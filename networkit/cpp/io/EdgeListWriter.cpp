@@ -6,6 +6,8 @@
  */
 
 #include <fstream>
+#include <mutex>
+#include <sstream>
 
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/io/EdgeListWriter.hpp>
@@ -44,4 +46,29 @@ void EdgeListWriter::write(const Graph &G, const std::string &path) {
     file.close();
 }
 
+void EdgeListWriter::write(StreamingGraphGenerator &generator, const std::string &path) {
+    std::ofstream file(path);
+    Aux::enforceOpened(file);
+
+    const bool reverse = bothDirections && !generator.isDirected();
+    std::mutex fileMutex;
+    generator.generateEdges([&](const StreamingGraphGenerator::EdgeBatch &batch) {
+        // format the batch before locking the file
+        std::ostringstream lines;
+        for (const auto &[u, v] : batch) {
+            lines << (u + firstNode) << separator << (v + firstNode) << '\n';
+            if (reverse && u != v)
+                lines << (v + firstNode) << separator << (u + firstNode) << '\n';
+        }
+        const std::string text = lines.str();
+
+        std::lock_guard<std::mutex> lock(fileMutex);
+        file.write(text.data(), text.size());
+    });
+
+    file.close();
+    if (file.fail())
+        throw std::runtime_error("Failed to write " + path);
+}
+
 } /* namespace NetworKit */
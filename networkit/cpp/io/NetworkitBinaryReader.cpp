@@ -5,6 +5,7 @@
  *
  */
 
+#include <algorithm>
 #include <atomic>
 #include <fstream>
 
@@ -21,6 +22,19 @@ const char *accessData(const std::vector<uint8_t> &source) {
     return (char *)source.data();
 }
 
+uint64_t dataSize(const NetworKit::MemoryMappedFile &source) {
+    return source.size();
+}
+
+uint64_t dataSize(const std::vector<uint8_t> &source) {
+    return source.size();
+}
+
+bool isCSRData(const char *data, uint64_t size) {
+    return size >= sizeof(NetworKit::nkbg::CSRHeader)
+           && !memcmp(NetworKit::nkbg::CSR_MAGIC, data, sizeof(NetworKit::nkbg::CSR_MAGIC));
+}
+
 namespace NetworKit {
 
 Graph NetworkitBinaryReader::read(const std::string &path) {
@@ -33,12 +47,141 @@ Graph NetworkitBinaryReader::readFromBuffer(const std::vector<uint8_t> &data) {
     return readData(data);
 }
 
+CSRGraph NetworkitBinaryReader::readCSR(const std::string &path) {
+    auto mmfile = std::make_shared<MemoryMappedFile>(path);
+    if (!isCSRData(mmfile->cbegin(), mmfile->size()))
+        return CSRGraph(readData(*mmfile));
+
+    CSRGraph G;
+    viewCSRData(mmfile->cbegin(), mmfile->size(), G);
+    G.storage = std::move(mmfile);
+    return G;
+}
+
+void NetworkitBinaryReader::viewCSRData(const char *data, uint64_t size, CSRGraph &G) {
+    nkbg::CSRHeader header;
+    memcpy(&header, data, sizeof(nkbg::CSRHeader));
+
+    const auto weightFormat =
+        static_cast<nkbg::WeightFormat>((header.features & nkbg::WGHT_MASK) >> nkbg::WGHT_SHIFT);
+    if (weightFormat != nkbg::WeightFormat::NONE && weightFormat != nkbg::WeightFormat::DOUBLE)
+        throw std::runtime_error("CSR graph file has unsupported weight format");
+    if (reinterpret_cast<uintptr_t>(data) % nkbg::CSR_ALIGNMENT)
+        throw std::runtime_error("CSR graph data is not properly aligned");
+
+    G.directed = header.features & nkbg::DIR_MASK;
+    G.weighted = weightFormat == nkbg::WeightFormat::DOUBLE;
+    G.edgesIndexed = (header.features & nkbg::INDEX_MASK) >> nkbg::INDEX_SHIFT;
+    G.z = header.nodes;
+    G.m = header.edges;
+    G.storedNumberOfSelfLoops = header.selfLoops;
+    G.omega = header.upperEdgeIdBound;
+
+    // Returns a pointer to the section at the given offset after checking that it is in bounds.
+    auto section = [&](uint64_t offset, uint64_t entries, uint64_t entrySize) -> const char * {
+        if (offset % nkbg::CSR_ALIGNMENT || offset < sizeof(nkbg::CSRHeader) || offset > size
+            || entries > (size - offset) / entrySize)
+            throw std::runtime_error("CSR graph file is truncated or corrupt");
+        return data + offset;
+    };
+
+    // Maps offsets, targets, weights and ids of one direction; returns the number of entries.
+    auto viewAdjacency = [&](uint64_t offOffsets, uint64_t offTargets, uint64_t offWeights,
+                             uint64_t offIds, const index *&offsets, const node *&targets,
+                             const edgeweight *&weights, const edgeid *&ids) {
+        offsets =
+            reinterpret_cast<const index *>(section(offOffsets, G.z + 1, sizeof(index)));
+        if (offsets[0] != 0)
+            throw std::runtime_error("CSR graph file is truncated or corrupt");
+        for (node u = 0; u < G.z; ++u)
+            if (offsets[u + 1] < offsets[u])
+                throw std::runtime_error("CSR graph file is truncated or corrupt");
+
+        const uint64_t entries = offsets[G.z];
+        targets = reinterpret_cast<const node *>(section(offTargets, entries, sizeof(node)));
+        weights = G.weighted ? reinterpret_cast<const edgeweight *>(
+                      section(offWeights, entries, sizeof(edgeweight)))
+                             : nullptr;
+        ids = G.edgesIndexed
+                  ? reinterpret_cast<const edgeid *>(section(offIds, entries, sizeof(edgeid)))
+                  : nullptr;
+
+        // Out-of-range node or edge ids would make the graph iterators read out of bounds.
+        bool valid = true;
+#pragma omp parallel for reduction(&& : valid)
+        for (omp_index i = 0; i < static_cast<omp_index>(entries); ++i)
+            valid = valid && targets[i] < G.z && (!ids || ids[i] < G.omega);
+        if (!valid)
+            throw std::runtime_error("CSR graph file is truncated or corrupt");
+        return entries;
+    };
+
+    // every node has a flag byte, so this also rules out an overflow of G.z + 1
+    if (G.z >= size)
+        throw std::runtime_error("CSR graph file is truncated or corrupt");
+    G.exists = reinterpret_cast<const uint8_t *>(
+        section(header.offsetNodeFlags, G.z, sizeof(uint8_t)));
+    G.n = std::count_if(G.exists, G.exists + G.z, [](uint8_t flag) { return flag != 0; });
+
+    const uint64_t outEntries = viewAdjacency(
+        header.offsetOutOffsets, header.offsetOutTargets, header.offsetOutWeights,
+        header.offsetOutEdgeIds, G.outOffsets, G.outTargets, G.outWeights, G.outEdgeIds);
+    uint64_t expectedEntries = G.directed ? G.m : 2 * G.m - G.storedNumberOfSelfLoops;
+    if (G.directed) {
+        const uint64_t inEntries = viewAdjacency(
+            header.offsetInOffsets, header.offsetInTargets, header.offsetInWeights,
+            header.offsetInEdgeIds, G.inOffsets, G.inTargets, G.inWeights, G.inEdgeIds);
+        if (inEntries != expectedEntries)
+            throw std::runtime_error("CSR graph file is truncated or corrupt");
+    }
+    if (outEntries != expectedEntries)
+        throw std::runtime_error("CSR graph file is truncated or corrupt");
+}
+
+Graph NetworkitBinaryReader::materializeCSR(const CSRGraph &C) {
+    Graph G(C.upperNodeIdBound(), C.isWeighted(), C.isDirected());
+    if (C.hasEdgeIds())
+        G.indexEdges();
+    for (node u = 0; u < C.upperNodeIdBound(); ++u)
+        if (!C.hasNode(u))
+            G.removeNode(u);
+
+    C.balancedParallelForNodes([&](node u) {
+        if (C.isDirected()) {
+            G.preallocateDirected(u, C.degreeOut(u), C.degreeIn(u));
+            C.forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                G.addPartialOutEdge(unsafe, u, v, ew, eid);
+            });
+            C.forInEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                G.addPartialInEdge(unsafe, u, v, ew, eid);
+            });
+        } else {
+            G.preallocateUndirected(u, C.degree(u));
+            C.forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                G.addPartialEdge(unsafe, u, v, ew, eid);
+            });
+        }
+    });
+
+    G.setEdgeCount(unsafe, C.numberOfEdges());
+    G.setNumberOfSelfLoops(unsafe, C.numberOfSelfLoops());
+    if (C.hasEdgeIds())
+        G.setUpperEdgeIdBound(unsafe, C.upperEdgeIdBound());
+    return G;
+}
+
 template <class T>
 Graph NetworkitBinaryReader::readData(const T &source) {
     nkbg::Header header;
     nkbg::WeightFormat weightFormat;
 
     const char *startIt = accessData(source);
+    if (isCSRData(startIt, dataSize(source))) {
+        CSRGraph C;
+        viewCSRData(startIt, dataSize(source), C);
+        return materializeCSR(C);
+    }
+
     const char *it = startIt;
     auto readHeader = [&]() {
         memcpy(&header.magic, it, sizeof(uint64_t));
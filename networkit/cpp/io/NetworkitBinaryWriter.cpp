@@ -4,20 +4,49 @@
  * @author Charmaine Ndolo <charmaine.ndolo@hu-berlin.de>
  */
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
+#include <omp.h>
 #include <tlx/math/clz.hpp>
 
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/io/NetworkitBinaryGraph.hpp>
 #include <networkit/io/NetworkitBinaryWriter.hpp>
 
 namespace NetworKit {
 
+namespace {
+
+// Removes the registered files when it goes out of scope, also if an exception is thrown.
+class TemporaryFiles {
+public:
+    TemporaryFiles() = default;
+    TemporaryFiles(const TemporaryFiles &) = delete;
+    TemporaryFiles &operator=(const TemporaryFiles &) = delete;
+    ~TemporaryFiles() {
+        for (const auto &path : paths)
+            std::remove(path.c_str());
+    }
+
+    const std::string &add(std::string path) {
+        paths.push_back(std::move(path));
+        return paths.back();
+    }
+
+private:
+    std::vector<std::string> paths;
+};
+
+} // namespace
+
 NetworkitBinaryWriter::NetworkitBinaryWriter(uint64_t chunks, NetworkitBinaryWeights weightsType,
                                              NetworkitBinaryEdgeIDs edgeIndex)
     : chunks(chunks), weightsType(weightsType), edgeIndex(edgeIndex) {}
@@ -36,6 +65,168 @@ std::vector<uint8_t> NetworkitBinaryWriter::writeToBuffer(const Graph &G) {
     return std::vector<uint8_t>(str.begin(), str.end());
 }
 
+void NetworkitBinaryWriter::writeCSR(const CSRGraph &G, const std::string &path) {
+    std::ofstream outfile(path, std::ios::binary);
+    Aux::enforceOpened(outfile);
+    writeCSRData(outfile, G);
+    INFO("Written graph to ", path);
+}
+
+void NetworkitBinaryWriter::write(StreamingGraphGenerator &generator, const std::string &path,
+                                  bool removeMultiEdges) {
+    const count nodes = generator.numberOfNodes();
+    const bool directed = generator.isDirected();
+    const count numChunks = std::max<count>(1, std::min<count>(chunks, nodes));
+    const count chunkSize = std::max<count>(1, nodes / numChunks);
+
+    std::vector<uint64_t> firstInChunk(numChunks + 1, nodes);
+    for (index c = 0; c < numChunks; ++c)
+        firstInChunk[c] = c * chunkSize;
+    auto chunkOf = [&](node u) -> index { return std::min(u / chunkSize, numChunks - 1); };
+
+    // Each edge (u, v) yields the entry v in the adjacency list of u and the entry u in the
+    // transposed list of v. Both are stored in the bucket of the owning node as a pair
+    // (owner | direction bit, neighbor).
+    constexpr uint64_t transposeBit = uint64_t{1} << 63;
+    auto bucketPath = [&](index c) { return path + ".bucket" + std::to_string(c); };
+
+    TemporaryFiles bucketFiles;
+    std::vector<std::ofstream> buckets(numChunks);
+    for (index c = 0; c < numChunks; ++c) {
+        buckets[c].open(bucketFiles.add(bucketPath(c)), std::ios::binary);
+        Aux::enforceOpened(buckets[c]);
+    }
+
+    std::mutex bucketMutex;
+    bool invalidNode = false;
+    generator.generateEdges([&](const StreamingGraphGenerator::EdgeBatch &batch) {
+        std::vector<std::vector<uint64_t>> entries(numChunks);
+        bool invalid = false;
+        for (auto [u, v] : batch) {
+            if (u >= nodes || v >= nodes) {
+                invalid = true;
+                continue;
+            }
+            if (!directed && u < v)
+                std::swap(u, v);
+            entries[chunkOf(u)].insert(entries[chunkOf(u)].end(), {u, v});
+            entries[chunkOf(v)].insert(entries[chunkOf(v)].end(), {v | transposeBit, u});
+        }
+
+        std::lock_guard<std::mutex> lock(bucketMutex);
+        invalidNode |= invalid;
+        for (index c = 0; c < numChunks; ++c)
+            buckets[c].write(reinterpret_cast<const char *>(entries[c].data()),
+                             entries[c].size() * sizeof(uint64_t));
+    });
+
+    bool bucketsWritten = true;
+    for (auto &bucket : buckets) {
+        bucket.close();
+        bucketsWritten &= !bucket.fail();
+    }
+    if (invalidNode || !bucketsWritten)
+        throw std::runtime_error(invalidNode ? "Generator emitted an edge with an invalid node"
+                                             : "Failed to write temporary bucket file");
+
+    std::ofstream outStream(path, std::ios::binary);
+    Aux::enforceOpened(outStream);
+
+    nkbg::Header header{};
+    strncpy(header.magic, "nkbg003", 8);
+    header.features = directed & nkbg::DIR_MASK;
+    header.nodes = nodes;
+    header.chunks = numChunks;
+    header.offsetBaseData = sizeof(nkbg::Header);
+
+    // The header is rewritten once the offsets of the sections are known.
+    outStream.write(reinterpret_cast<const char *>(&header), sizeof(nkbg::Header));
+    const std::vector<uint8_t> nodeFlags(nodes, nkbg::DELETED_BIT);
+    outStream.write(reinterpret_cast<const char *>(nodeFlags.data()), nodes);
+    outStream.write(reinterpret_cast<const char *>(firstInChunk.data() + 1),
+                    (numChunks - 1) * sizeof(uint64_t));
+
+    // Writes the adjacency or transposed section and returns its offset.
+    auto writeSection = [&](bool transpose) -> uint64_t {
+        const uint64_t sectionBegin = outStream.tellp();
+        std::vector<uint64_t> chunkOffsets(numChunks, 0); // last entry is the list size
+        outStream.write(reinterpret_cast<const char *>(chunkOffsets.data()),
+                        numChunks * sizeof(uint64_t));
+
+        uint64_t dataSize = 0, listSize = 0;
+        std::vector<std::pair<node, node>> entries;
+        for (index c = 0; c < numChunks; ++c) {
+            entries.clear();
+            std::ifstream bucket(bucketPath(c), std::ios::binary);
+            Aux::enforceOpened(bucket);
+            std::vector<uint64_t> buffer(uint64_t{1} << 16);
+            while (bucket) {
+                bucket.read(reinterpret_cast<char *>(buffer.data()),
+                            buffer.size() * sizeof(uint64_t));
+                const count read = bucket.gcount() / sizeof(uint64_t);
+                for (index i = 0; i + 1 < read; i += 2)
+                    if (static_cast<bool>(buffer[i] & transposeBit) == transpose)
+                        entries.emplace_back(buffer[i] & ~transposeBit, buffer[i + 1]);
+            }
+
+            Aux::Parallel::sort(entries.begin(), entries.end());
+            if (removeMultiEdges)
+                entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+            listSize += entries.size();
+
+            // Encode ranges of nodes in parallel; each range starts with its first entry.
+            const count numNodes = firstInChunk[c + 1] - firstInChunk[c];
+            const count numRanges = std::min<count>(numNodes, 4 * omp_get_max_threads());
+            std::vector<std::vector<uint8_t>> encoded(numRanges);
+#pragma omp parallel for schedule(dynamic, 1)
+            for (omp_index r = 0; r < static_cast<omp_index>(numRanges); ++r) {
+                const node first = firstInChunk[c] + numNodes * r / numRanges;
+                const node last = firstInChunk[c] + numNodes * (r + 1) / numRanges;
+                auto it = std::lower_bound(entries.begin(), entries.end(),
+                                           std::make_pair(first, node{0}));
+                uint8_t tmp[10];
+                auto &out = encoded[r];
+                for (node u = first; u < last; ++u) {
+                    auto end = it;
+                    while (end != entries.end() && end->first == u)
+                        ++end;
+                    out.insert(out.end(), tmp, tmp + nkbg::varIntEncode(end - it, tmp));
+                    for (; it != end; ++it)
+                        out.insert(out.end(), tmp, tmp + nkbg::varIntEncode(it->second, tmp));
+                }
+            }
+
+            for (const auto &out : encoded) {
+                outStream.write(reinterpret_cast<const char *>(out.data()), out.size());
+                dataSize += out.size();
+            }
+            chunkOffsets[c] = dataSize;
+        }
+
+        chunkOffsets.back() = listSize;
+        const auto sectionEnd = outStream.tellp();
+        outStream.seekp(sectionBegin);
+        outStream.write(reinterpret_cast<const char *>(chunkOffsets.data()),
+                        numChunks * sizeof(uint64_t));
+        outStream.seekp(sectionEnd);
+        return sectionBegin;
+    };
+
+    header.offsetAdjLists = writeSection(false);
+    header.offsetAdjTranspose = writeSection(true);
+
+    // The offsets of the (empty) weight and edge id sections are all zero.
+    const std::vector<uint64_t> zeros(4 * (numChunks - 1), 0);
+    outStream.write(reinterpret_cast<const char *>(zeros.data()), zeros.size() * sizeof(uint64_t));
+
+    outStream.seekp(0);
+    outStream.write(reinterpret_cast<const char *>(&header), sizeof(nkbg::Header));
+    outStream.close();
+    if (outStream.fail())
+        throw std::runtime_error("Failed to write " + path);
+    INFO("Written generated graph to ", path);
+}
+
 template <class T>
 void NetworkitBinaryWriter::writeData(T &outStream, const Graph &G) {
     nkbg::WEIGHT_FORMAT weightFormat;
@@ -451,4 +642,75 @@ void NetworkitBinaryWriter::writeData(T &outStream, const Graph &G) {
     }
 }
 
+template <class T>
+void NetworkitBinaryWriter::writeCSRData(T &outStream, const CSRGraph &G) {
+    const bool writeEdgeIds = G.hasEdgeIds() && edgeIndex != NetworkitBinaryEdgeIDs::NO_EDGE_IDS;
+    const uint64_t z = G.upperNodeIdBound();
+    const uint64_t numOut = G.outOffsets[z];
+    const uint64_t numIn = G.isDirected() ? G.inOffsets[z] : 0;
+
+    nkbg::CSRHeader header{};
+    memcpy(header.magic, nkbg::CSR_MAGIC, 8);
+    const auto weightFormat =
+        static_cast<uint64_t>(G.isWeighted() ? nkbg::WeightFormat::DOUBLE : nkbg::WeightFormat::NONE);
+    header.features = (G.isDirected() & nkbg::DIR_MASK)
+                      | ((weightFormat << nkbg::WGHT_SHIFT) & nkbg::WGHT_MASK)
+                      | ((static_cast<uint64_t>(writeEdgeIds) << nkbg::INDEX_SHIFT)
+                         & nkbg::INDEX_MASK);
+    header.nodes = z;
+    header.edges = G.numberOfEdges();
+    header.selfLoops = G.numberOfSelfLoops();
+    header.upperEdgeIdBound = writeEdgeIds ? G.upperEdgeIdBound() : 0;
+
+    // All sections start at multiples of CSR_ALIGNMENT; only the node flags need padding.
+    uint64_t nextOffset = sizeof(nkbg::CSRHeader);
+    auto addSection = [&](uint64_t &offset, uint64_t bytes) {
+        offset = nextOffset;
+        nextOffset += (bytes + nkbg::CSR_ALIGNMENT - 1) / nkbg::CSR_ALIGNMENT * nkbg::CSR_ALIGNMENT;
+    };
+
+    addSection(header.offsetNodeFlags, z * sizeof(uint8_t));
+    addSection(header.offsetOutOffsets, (z + 1) * sizeof(index));
+    addSection(header.offsetOutTargets, numOut * sizeof(node));
+    if (G.isWeighted())
+        addSection(header.offsetOutWeights, numOut * sizeof(edgeweight));
+    if (writeEdgeIds)
+        addSection(header.offsetOutEdgeIds, numOut * sizeof(edgeid));
+    if (G.isDirected()) {
+        addSection(header.offsetInOffsets, (z + 1) * sizeof(index));
+        addSection(header.offsetInTargets, numIn * sizeof(node));
+        if (G.isWeighted())
+            addSection(header.offsetInWeights, numIn * sizeof(edgeweight));
+        if (writeEdgeIds)
+            addSection(header.offsetInEdgeIds, numIn * sizeof(edgeid));
+    }
+
+    uint64_t written = 0;
+    auto writeSection = [&](uint64_t offset, const void *data, uint64_t bytes) {
+        assert(offset >= written);
+        static constexpr char padding[nkbg::CSR_ALIGNMENT] = {};
+        outStream.write(padding, offset - written);
+        outStream.write(reinterpret_cast<const char *>(data), bytes);
+        written = offset + bytes;
+    };
+
+    writeSection(0, &header, sizeof(nkbg::CSRHeader));
+    writeSection(header.offsetNodeFlags, G.exists, z * sizeof(uint8_t));
+    writeSection(header.offsetOutOffsets, G.outOffsets, (z + 1) * sizeof(index));
+    writeSection(header.offsetOutTargets, G.outTargets, numOut * sizeof(node));
+    if (G.isWeighted())
+        writeSection(header.offsetOutWeights, G.outWeights, numOut * sizeof(edgeweight));
+    if (writeEdgeIds)
+        writeSection(header.offsetOutEdgeIds, G.outEdgeIds, numOut * sizeof(edgeid));
+    if (G.isDirected()) {
+        writeSection(header.offsetInOffsets, G.inOffsets, (z + 1) * sizeof(index));
+        writeSection(header.offsetInTargets, G.inTargets, numIn * sizeof(node));
+        if (G.isWeighted())
+            writeSection(header.offsetInWeights, G.inWeights, numIn * sizeof(edgeweight));
+        if (writeEdgeIds)
+            writeSection(header.offsetInEdgeIds, G.inEdgeIds, numIn * sizeof(edgeid));
+    }
+    writeSection(nextOffset, nullptr, 0);
+}
+
 } // namespace NetworKit
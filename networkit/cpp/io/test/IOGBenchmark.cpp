@@ -0,0 +1,119 @@
+/*
+ * IOGBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <filesystem>
+#include <benchmark/benchmark.h>
+
+#include <networkit/io/EdgeListReader.hpp>
+#include <networkit/io/EdgeListWriter.hpp>
+#include <networkit/io/METISGraphReader.hpp>
+#include <networkit/io/METISGraphWriter.hpp>
+#include <networkit/io/NetworkitBinaryReader.hpp>
+#include <networkit/io/NetworkitBinaryWriter.hpp>
+
+#include "../../BenchmarkGraphs.hpp"
+
+namespace NetworKit {
+
+namespace {
+
+using BenchmarkGraphs::erdosRenyi;
+
+// File access does not show up in the CPU time, so all benchmarks measure real time.
+void realTimeGraphSizes(benchmark::internal::Benchmark *benchmark) {
+    BenchmarkGraphs::graphSizes(benchmark);
+    benchmark->UseRealTime();
+}
+
+std::string tempPath(const std::string &name, count n) {
+    return (std::filesystem::temp_directory_path()
+            / ("networkit_benchmark_" + name + "_" + std::to_string(n)))
+        .string();
+}
+
+// Writes the graph of the current size with the given writer once and returns the path.
+template <class Writer>
+std::string writtenFile(benchmark::State &state, const std::string &name, Writer &&writer) {
+    const count n = state.range(0);
+    const std::string path = tempPath(name, n);
+    if (!std::filesystem::exists(path))
+        writer.write(erdosRenyi(n), path);
+    state.counters["bytes"] = static_cast<double>(std::filesystem::file_size(path));
+    return path;
+}
+
+template <class Reader>
+void runReader(benchmark::State &state, const std::string &path, Reader &&reader) {
+    count edges = 0;
+    for (auto _ : state) {
+        const Graph G = reader.read(path);
+        edges += G.numberOfEdges();
+    }
+    state.SetItemsProcessed(edges);
+}
+
+template <class Writer>
+void runWriter(benchmark::State &state, const std::string &name, Writer &&writer) {
+    const count n = state.range(0);
+    const Graph &G = erdosRenyi(n);
+    const std::string path = tempPath(name + "_out", n);
+    for (auto _ : state)
+        writer.write(G, path);
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * G.numberOfEdges());
+}
+
+void BM_EdgeListReader(benchmark::State &state) {
+    const auto path = writtenFile(state, "edgelist", EdgeListWriter('\t', 0));
+    runReader(state, path, EdgeListReader('\t', 0));
+}
+
+void BM_METISGraphReader(benchmark::State &state) {
+    const auto path = writtenFile(state, "metis", METISGraphWriter());
+    runReader(state, path, METISGraphReader());
+}
+
+void BM_NetworkitBinaryReader(benchmark::State &state) {
+    const auto path = writtenFile(state, "nkbg", NetworkitBinaryWriter());
+    runReader(state, path, NetworkitBinaryReader());
+}
+
+void BM_NetworkitBinaryReaderCSR(benchmark::State &state) {
+    const count n = state.range(0);
+    const std::string path = tempPath("nkbgcsr", n);
+    if (!std::filesystem::exists(path))
+        NetworkitBinaryWriter().writeCSR(erdosRenyi(n), path);
+    count edges = 0;
+    for (auto _ : state) {
+        const CSRGraph G = NetworkitBinaryReader().readCSR(path);
+        edges += G.numberOfEdges();
+    }
+    state.SetItemsProcessed(edges);
+}
+
+void BM_EdgeListWriter(benchmark::State &state) {
+    runWriter(state, "edgelist", EdgeListWriter('\t', 0));
+}
+
+void BM_METISGraphWriter(benchmark::State &state) {
+    runWriter(state, "metis", METISGraphWriter());
+}
+
+void BM_NetworkitBinaryWriter(benchmark::State &state) {
+    runWriter(state, "nkbg", NetworkitBinaryWriter());
+}
+
+} // namespace
+
+BENCHMARK(BM_EdgeListReader)->Apply(realTimeGraphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_METISGraphReader)->Apply(realTimeGraphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NetworkitBinaryReader)->Apply(realTimeGraphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NetworkitBinaryReaderCSR)->Apply(realTimeGraphSizes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EdgeListWriter)->Apply(realTimeGraphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_METISGraphWriter)->Apply(realTimeGraphSizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NetworkitBinaryWriter)->Apply(realTimeGraphSizes)->Unit(benchmark::kMillisecond);
+
+} // namespace NetworKit
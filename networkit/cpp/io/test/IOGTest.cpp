@@ -17,8 +17,16 @@
 #include <unordered_set>
 #include <vector>
 
+#include <omp.h>
+
 #include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/generators/ChungLuGenerator.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/generators/HyperbolicGenerator.hpp>
+#include <networkit/generators/RmatGenerator.hpp>
+#include <networkit/generators/StochasticBlockmodel.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/BinaryEdgeListPartitionReader.hpp>
 #include <networkit/io/BinaryEdgeListPartitionWriter.hpp>
 #include <networkit/io/BinaryPartitionReader.hpp>
@@ -52,6 +60,7 @@
 #include <networkit/io/ThrillGraphBinaryWriter.hpp>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
 #include <networkit/community/GraphClusteringTools.hpp>
 #include <networkit/community/Modularity.hpp>
@@ -416,6 +425,47 @@ TEST_F(IOGTest, testEdgeListReader) {
     EXPECT_EQ(1, G5.weight(2, 3));
 }
 
+TEST_F(IOGTest, testEdgeListReaderChunked) {
+    // Large enough to be split into several chunks.
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(3000, 0.01).generate();
+    G = GraphTools::toWeighted(G);
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 100)); });
+
+    const std::string path = "output/chunked.edgelist";
+    {
+        std::ofstream file(path);
+        file << "# comment\r\n";
+        G.forEdges([&](node u, node v, edgeweight w) {
+            file << "n" << u << "\tn" << v << "\t" << w << (u % 2 ? "\r\n" : "\n");
+        });
+        // multi-edges with different weights must be ignored
+        G.forEdges([&](node u, node v) { file << "n" << v << "\tn" << u << "\t1000\n"; });
+    }
+
+    EdgeListReader reader('\t', 0, "#", false, false);
+    const Graph GRead = reader.read(path);
+    const auto &nodeMap = reader.getNodeMap();
+    EXPECT_TRUE(GRead.isWeighted());
+    EXPECT_EQ(GRead.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(nodeMap.size(), GRead.numberOfNodes());
+    G.forEdges([&](node u, node v, edgeweight w) {
+        const node uRead = nodeMap.at("n" + std::to_string(u));
+        const node vRead = nodeMap.at("n" + std::to_string(v));
+        EXPECT_EQ(GRead.weight(uRead, vRead), w);
+    });
+
+    const Graph D = ErdosRenyiGenerator(3000, 0.01, true).generate();
+    {
+        std::ofstream file(path);
+        D.forEdges([&](node u, node v) { file << u + 1 << " " << v + 1 << "\n"; });
+    }
+    const Graph DRead = EdgeListReader(' ', 1, "#", true, true).read(path);
+    EXPECT_FALSE(DRead.isWeighted());
+    EXPECT_EQ(DRead.numberOfEdges(), D.numberOfEdges());
+    D.forEdges([&](node u, node v) { EXPECT_TRUE(DRead.hasEdge(u, v)); });
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
     EdgeListPartitionReader reader(1);
 
@@ -841,6 +891,97 @@ TEST_F(IOGTest, testNetworkitBinaryTiny01) {
     G.forNodes([&](node u) { G.forEdgesOf(u, [&](node v) { ASSERT_TRUE(G2.hasEdge(u, v)); }); });
 }
 
+TEST_F(IOGTest, testNetworkitBinaryWriterStreamedGenerators) {
+    const std::string path = "output/binaryStreamed";
+    std::vector<count> degrees(500);
+    for (index i = 0; i < degrees.size(); ++i)
+        degrees[i] = 1 + (i * 7) % 40;
+    std::vector<index> membership(600);
+    for (index i = 0; i < membership.size(); ++i)
+        membership[i] = i % 3;
+    const std::vector<std::vector<double>> affinity = {
+        {0.05, 0.01, 0.0}, {0.01, 0.1, 0.002}, {0.0, 0.002, 1.0}};
+
+    // Streaming and generate() draw the same random numbers on a single thread.
+    const int maxThreads = omp_get_max_threads();
+    auto check = [&](auto makeGenerator) {
+        omp_set_num_threads(1);
+        Aux::Random::setSeed(7, false);
+        Graph G = makeGenerator().generate();
+        G.removeMultiEdges();
+
+        Aux::Random::setSeed(7, false);
+        auto generator = makeGenerator();
+        NetworkitBinaryWriter(5).write(generator, path);
+        omp_set_num_threads(maxThreads);
+
+        const Graph H = NetworkitBinaryReader{}.read(path);
+        EXPECT_TRUE(H.checkConsistency());
+        ASSERT_EQ(H.numberOfNodes(), G.numberOfNodes());
+        ASSERT_EQ(H.numberOfEdges(), G.numberOfEdges());
+        ASSERT_EQ(H.numberOfSelfLoops(), G.numberOfSelfLoops());
+        G.forEdges([&](node u, node v) { EXPECT_TRUE(H.hasEdge(u, v)); });
+
+        // several threads emit batches concurrently
+        auto parallelGenerator = makeGenerator();
+        NetworkitBinaryWriter(3).write(parallelGenerator, path);
+        const Graph P = NetworkitBinaryReader{}.read(path);
+        EXPECT_TRUE(P.checkConsistency());
+        EXPECT_EQ(P.numberOfNodes(), G.numberOfNodes());
+    };
+
+    check([&] { return ChungLuGenerator(degrees); });
+    check([&] { return StochasticBlockmodel(600, 3, membership, affinity); });
+    check([&] { return HyperbolicGenerator(1000, 8, 3); });
+    check([&] { return HyperbolicGenerator(1000, 8, 3, 0.5); });
+    // the stream contains the draws of the weighted graph
+    check([&] { return RmatGenerator(10, 4, 0.57, 0.19, 0.19, 0.05, true, 24); });
+}
+
+TEST_F(IOGTest, testNetworkitBinaryWriterStreamedFailureRemovesBuckets) {
+    // Emits one valid edge, then either an edge with an invalid node or an exception.
+    class FailingGenerator final : public StreamingGraphGenerator {
+    public:
+        explicit FailingGenerator(bool throws) : throws(throws) {}
+        count numberOfNodes() const override { return 10; }
+        void generateEdges(const EdgeBatchHandle &handle) override {
+            handle({{1, 2}});
+            if (throws)
+                throw std::runtime_error("generator failed");
+            handle({{3, 10}});
+        }
+
+    private:
+        bool throws;
+    };
+
+    const std::string path = "output/binaryStreamedFailure";
+    for (const bool throws : {false, true}) {
+        FailingGenerator generator(throws);
+        EXPECT_THROW(NetworkitBinaryWriter(4).write(generator, path), std::runtime_error);
+        for (index c = 0; c < 4; ++c)
+            EXPECT_FALSE(std::ifstream(path + ".bucket" + std::to_string(c)).good());
+    }
+}
+
+TEST_F(IOGTest, testEdgeListWriterStreamedGenerator) {
+    const std::string path = "output/edgelistStreamed.txt";
+    std::vector<index> membership(100);
+    for (index i = 0; i < membership.size(); ++i)
+        membership[i] = i / 25;
+    std::vector<std::vector<double>> affinity(4, std::vector<double>(4, 0.0));
+    for (index b = 0; b < 4; ++b)
+        affinity[b][b] = 1.0;
+
+    StochasticBlockmodel generator(100, 4, membership, affinity);
+    EdgeListWriter('\t', 1).write(generator, path);
+
+    const Graph G = EdgeListReader('\t', 1).read(path);
+    EXPECT_EQ(G.numberOfNodes(), 100u);
+    EXPECT_EQ(G.numberOfEdges(), 4u * 25 * 24 / 2);
+    G.forEdges([&](node u, node v) { EXPECT_EQ(membership[u], membership[v]); });
+}
+
 TEST_F(IOGTest, testNetworkitBinaryTiny01InMemory) {
     METISGraphReader reader2;
     Graph G = reader2.read("input/tiny_01.graph");
@@ -1245,6 +1386,102 @@ TEST_F(IOGTest, testNetworkitWriterNonContinuousNodesIds) {
     });
 }
 
+TEST_F(IOGTest, testNetworkitBinaryCSR) {
+    for (bool directed : {false, true}) {
+        for (bool weighted : {false, true}) {
+            Aux::Random::setSeed(42, false);
+            Graph G = ErdosRenyiGenerator(200, 0.05, directed).generate();
+            if (weighted) {
+                G = GraphTools::toWeighted(G);
+                G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+            }
+            G.addEdge(5, 5);
+            G.removeNode(10);
+            G.indexEdges();
+
+            const std::string path = "output/binaryCSR";
+            NetworkitBinaryWriter{}.writeCSR(G, path);
+
+            const CSRGraph C = NetworkitBinaryReader{}.readCSR(path);
+            EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+            EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+            EXPECT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+            EXPECT_EQ(C.upperNodeIdBound(), G.upperNodeIdBound());
+            EXPECT_EQ(C.upperEdgeIdBound(), G.upperEdgeIdBound());
+            EXPECT_EQ(C.isDirected(), directed);
+            EXPECT_EQ(C.isWeighted(), weighted);
+            EXPECT_TRUE(C.hasEdgeIds());
+            EXPECT_FALSE(C.hasNode(10));
+
+            const Graph GRead = NetworkitBinaryReader{}.read(path);
+            EXPECT_EQ(GRead.numberOfNodes(), G.numberOfNodes());
+            EXPECT_EQ(GRead.numberOfEdges(), G.numberOfEdges());
+            EXPECT_EQ(GRead.numberOfSelfLoops(), G.numberOfSelfLoops());
+            EXPECT_EQ(GRead.upperEdgeIdBound(), G.upperEdgeIdBound());
+            EXPECT_FALSE(GRead.hasNode(10));
+
+            G.forNodes([&](node u) {
+                EXPECT_EQ(C.degree(u), G.degree(u));
+                EXPECT_EQ(C.degreeIn(u), G.degreeIn(u));
+                EXPECT_EQ(GRead.degree(u), G.degree(u));
+                EXPECT_EQ(GRead.degreeIn(u), G.degreeIn(u));
+                G.forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                    EXPECT_TRUE(C.hasEdge(u, v));
+                    EXPECT_DOUBLE_EQ(C.weight(u, v), ew);
+                    EXPECT_DOUBLE_EQ(GRead.weight(u, v), ew);
+                    EXPECT_EQ(GRead.edgeId(u, v), eid);
+                });
+            });
+        }
+    }
+}
+
+TEST_F(IOGTest, testNetworkitBinaryCSRFromCompressed) {
+    const Graph G = METISGraphReader{}.read("input/jazz.graph");
+    NetworkitBinaryWriter{}.write(G, "output/binaryCompressed");
+    const CSRGraph C = NetworkitBinaryReader{}.readCSR("output/binaryCompressed");
+    EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    G.forEdges([&](node u, node v) { EXPECT_TRUE(C.hasEdge(u, v)); });
+}
+
+TEST_F(IOGTest, testNetworkitBinaryCSRTruncated) {
+    const Graph G = METISGraphReader{}.read("input/jazz.graph");
+    std::vector<uint8_t> data;
+    {
+        NetworkitBinaryWriter{}.writeCSR(G, "output/binaryCSRTruncated");
+        std::ifstream file("output/binaryCSRTruncated", std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    EXPECT_EQ(NetworkitBinaryReader{}.readFromBuffer(data).numberOfEdges(), G.numberOfEdges());
+
+    data.resize(data.size() / 2);
+    EXPECT_THROW(NetworkitBinaryReader{}.readFromBuffer(data), std::runtime_error);
+}
+
+TEST_F(IOGTest, testNetworkitBinaryCSRCorruptTarget) {
+    const Graph G = METISGraphReader{}.read("input/jazz.graph");
+    std::vector<uint8_t> data;
+    {
+        NetworkitBinaryWriter{}.writeCSR(G, "output/binaryCSRCorrupt");
+        std::ifstream file("output/binaryCSRCorrupt", std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    nkbg::CSRHeader header;
+    memcpy(&header, data.data(), sizeof(header));
+
+    // the last target of the out-adjacency points past the node range
+    const uint64_t target = G.upperNodeIdBound();
+    memcpy(data.data() + header.offsetOutTargets + (2 * G.numberOfEdges() - 1) * sizeof(node),
+           &target, sizeof(target));
+    EXPECT_THROW(NetworkitBinaryReader{}.readFromBuffer(data), std::runtime_error);
+
+    // a node count that cannot fit into the file
+    header.nodes = std::numeric_limits<uint64_t>::max();
+    memcpy(data.data(), &header, sizeof(header));
+    EXPECT_THROW(NetworkitBinaryReader{}.readFromBuffer(data), std::runtime_error);
+}
+
 TEST_F(IOGTest, testMatrixMarketReaderUnweightedUndirected) {
     CSRMatrix csr = MatrixMarketReader{}.read("input/chesapeake.mtx");
     EXPECT_EQ(csr.numberOfRows(), 39);
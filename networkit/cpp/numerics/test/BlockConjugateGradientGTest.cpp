@@ -0,0 +1,187 @@
+/*
+ * BlockConjugateGradientGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/algebraic/Vector.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/BarabasiAlbertGenerator.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/numerics/BlockConjugateGradient.hpp>
+#include <networkit/numerics/ConjugateGradient.hpp>
+#include <networkit/numerics/Preconditioner/DiagonalPreconditioner.hpp>
+#include <networkit/numerics/Preconditioner/IdentityPreconditioner.hpp>
+#include <networkit/numerics/Preconditioner/IncompleteCholeskyPreconditioner.hpp>
+
+namespace NetworKit {
+
+class BlockConjugateGradientGTest : public testing::Test {
+protected:
+    // Weighted rows x cols grid graph.
+    static Graph gridGraph(count rows, count cols) {
+        Graph G(rows * cols, true);
+        for (index r = 0; r < rows; ++r) {
+            for (index c = 0; c < cols; ++c) {
+                const node u = r * cols + c;
+                if (c + 1 < cols)
+                    G.addEdge(u, u + 1, 1.0 + Aux::Random::probability());
+                if (r + 1 < rows)
+                    G.addEdge(u, u + cols, 1.0 + Aux::Random::probability());
+            }
+        }
+        return G;
+    }
+
+    // Random right-hand sides whose entries sum up to zero, as required for Laplacian systems.
+    static std::vector<Vector> zeroSumRhs(count n, count k) {
+        std::vector<Vector> rhs(k, Vector(n));
+        for (Vector &b : rhs) {
+            double sum = 0;
+            for (index i = 0; i < n; ++i) {
+                b[i] = Aux::Random::real(-1, 1);
+                sum += b[i];
+            }
+            b[0] -= sum;
+        }
+        return rhs;
+    }
+
+    static double relativeResidual(const CSRMatrix &A, const Vector &b, const Vector &x) {
+        return (A * x - b).length() / b.length();
+    }
+
+    template <class Preconditioner>
+    static count totalIterations(const CSRMatrix &L, const std::vector<Vector> &rhs) {
+        BlockConjugateGradient<CSRMatrix, Preconditioner> cg(1e-8, 4);
+        cg.setupConnected(L);
+        std::vector<Vector> results;
+        count iterations = 0;
+        for (const SolverStatus &status : cg.solveBlock(rhs, results)) {
+            EXPECT_TRUE(status.converged);
+            iterations += status.numIters;
+        }
+        for (index c = 0; c < rhs.size(); ++c)
+            EXPECT_LE(relativeResidual(L, rhs[c], results[c]), 1e-8);
+        return iterations;
+    }
+};
+
+TEST_F(BlockConjugateGradientGTest, testBlockMatchesSingleSolves) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = BarabasiAlbertGenerator(3, 500).generate();
+    const CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+    const std::vector<Vector> rhs = zeroSumRhs(G.numberOfNodes(), 10);
+
+    BlockConjugateGradient<CSRMatrix, DiagonalPreconditioner> blockCG(1e-8, 4);
+    blockCG.setupConnected(L);
+    std::vector<Vector> results(rhs.size(), Vector(G.numberOfNodes(), 0.0));
+    blockCG.parallelSolve(rhs, results);
+
+    ConjugateGradient<CSRMatrix, DiagonalPreconditioner> cg(1e-8);
+    cg.setupConnected(L);
+    for (index c = 0; c < rhs.size(); ++c) {
+        EXPECT_LE(relativeResidual(L, rhs[c], results[c]), 1e-8);
+        Vector x(G.numberOfNodes(), 0.0);
+        EXPECT_TRUE(cg.solve(rhs[c], x).converged);
+        // the solutions of a Laplacian system are unique up to a constant
+        const Vector diff = (x - x.mean()) - (results[c] - results[c].mean());
+        EXPECT_LE(diff.length(), 1e-5 * x.length());
+    }
+}
+
+TEST_F(BlockConjugateGradientGTest, testPreconditioners) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = gridGraph(40, 50);
+    const CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+    const std::vector<Vector> rhs = zeroSumRhs(G.numberOfNodes(), 6);
+
+    const count identityIters = totalIterations<IdentityPreconditioner>(L, rhs);
+    const count jacobiIters = totalIterations<DiagonalPreconditioner>(L, rhs);
+    const count icIters = totalIterations<IncompleteCholeskyPreconditioner>(L, rhs);
+    EXPECT_LT(icIters, jacobiIters);
+    EXPECT_LT(icIters, identityIters);
+}
+
+TEST_F(BlockConjugateGradientGTest, testIncompleteCholeskyWithoutFill) {
+    // The Laplacian of a path plus the identity is tridiagonal, IC(0) is the exact factorization.
+    const count n = 100;
+    std::vector<Triplet> triplets;
+    for (index i = 0; i < n; ++i) {
+        triplets.push_back({i, i, (i == 0 || i == n - 1) ? 2.0 : 3.0});
+        if (i + 1 < n) {
+            triplets.push_back({i, i + 1, -1.0});
+            triplets.push_back({i + 1, i, -1.0});
+        }
+    }
+    const CSRMatrix A(n, triplets);
+    Vector b(n);
+    for (index i = 0; i < n; ++i)
+        b[i] = static_cast<double>(i % 7) - 3.0;
+
+    const IncompleteCholeskyPreconditioner ic(A);
+    EXPECT_LE((A * ic.rhs(b) - b).length(), 1e-10 * b.length());
+
+    BlockConjugateGradient<CSRMatrix, IncompleteCholeskyPreconditioner> cg(1e-10);
+    cg.setup(A);
+    Vector x(n, 0.0);
+    const SolverStatus status = cg.solve(b, x);
+    EXPECT_TRUE(status.converged);
+    EXPECT_LE(status.numIters, 2);
+}
+
+TEST_F(BlockConjugateGradientGTest, testLoaderInterface) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = gridGraph(20, 20);
+    const CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+    const std::vector<Vector> rhs = zeroSumRhs(G.numberOfNodes(), 5);
+
+    BlockConjugateGradient<CSRMatrix, IncompleteCholeskyPreconditioner> cg(1e-7, 2);
+    cg.setupConnected(L);
+    std::vector<count> processed(rhs.size(), 0);
+    cg.parallelSolve([&](index i, Vector &) -> const Vector & { return rhs[i]; },
+                     [&](index i, const Vector &result) {
+                         ++processed[i];
+                         EXPECT_LE(relativeResidual(L, rhs[i], result), 1e-7);
+                     },
+                     {rhs.size(), G.numberOfNodes()});
+    EXPECT_EQ(processed, std::vector<count>(rhs.size(), 1));
+}
+
+TEST_F(BlockConjugateGradientGTest, testMaxConvergenceTime) {
+    // identity preconditioner that takes longer than the time limit
+    struct SlowPreconditioner {
+        SlowPreconditioner() = default;
+        explicit SlowPreconditioner(const CSRMatrix &) {}
+        void rhs(const std::vector<double> &b, std::vector<double> &out, count) const {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            out = b;
+        }
+    };
+
+    Aux::Random::setSeed(42, false);
+    const Graph G = gridGraph(10, 10);
+    const CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+    const std::vector<Vector> rhs = zeroSumRhs(G.numberOfNodes(), 3);
+
+    BlockConjugateGradient<CSRMatrix, SlowPreconditioner> cg(1e-8);
+    cg.setupConnected(L);
+    std::vector<Vector> results;
+    for (const SolverStatus &status : cg.solveBlock(rhs, results, 1)) {
+        EXPECT_EQ(status.numIters, 0u);
+        EXPECT_FALSE(status.converged);
+    }
+
+    Vector x(G.numberOfNodes(), 0.0);
+    const SolverStatus status = cg.solve(rhs[0], x, 60 * 1000);
+    EXPECT_GT(status.numIters, 0u);
+    EXPECT_TRUE(status.converged);
+}
+
+} /* namespace NetworKit */
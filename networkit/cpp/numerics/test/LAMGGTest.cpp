@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <stdexcept>
+
 #include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/algebraic/DynamicMatrix.hpp>
 #include <networkit/algebraic/Vector.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
@@ -17,6 +21,7 @@
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/io/METISGraphWriter.hpp>
 #include <networkit/numerics/GaussSeidelRelaxation.hpp>
+#include <networkit/numerics/LAMG/Lamg.hpp>
 #include <networkit/numerics/LAMG/MultiLevelSetup.hpp>
 #include <networkit/numerics/LAMG/SolverLamg.hpp>
 #include <networkit/structures/Partition.hpp>
@@ -79,6 +84,103 @@ TEST_F(LAMGGTest, testSmallGraphs) {
     }
 }
 
+TEST_F(LAMGGTest, testSaveAndLoadHierarchy) {
+    // many nodes of degree two lead to elimination as well as aggregation levels
+    Aux::Random::setSeed(42, false);
+    Graph G = BarabasiAlbertGenerator(2, 5000).generate();
+    GaussSeidelRelaxation<CSRMatrix> smoother;
+    MultiLevelSetup<CSRMatrix> setup(smoother);
+    LevelHierarchy<CSRMatrix> hierarchy;
+    setup.setup(G, hierarchy);
+
+    bool hasElimination = false, hasAggregation = false;
+    for (index i = 1; i < hierarchy.size(); ++i) {
+        hasElimination |= hierarchy.getType(i) == ELIMINATION;
+        hasAggregation |= hierarchy.getType(i) == AGGREGATION;
+        EXPECT_LT(hierarchy.at(i).getNumberOfNodes(), hierarchy.at(i - 1).getNumberOfNodes());
+    }
+    EXPECT_TRUE(hasElimination);
+    EXPECT_TRUE(hasAggregation);
+
+    std::stringstream stream;
+    hierarchy.save(stream);
+    LevelHierarchy<CSRMatrix> loaded;
+    loaded.load(stream);
+
+    ASSERT_EQ(loaded.size(), hierarchy.size());
+    for (index i = 0; i < hierarchy.size(); ++i) {
+        EXPECT_EQ(loaded.getType(i), hierarchy.getType(i));
+        EXPECT_TRUE(loaded.at(i).getLaplacian() == hierarchy.at(i).getLaplacian());
+    }
+
+    const Vector b = randZeroSum(G, 12345);
+    Vector x(G.numberOfNodes(), 0.0), xLoaded(G.numberOfNodes(), 0.0);
+    LAMGSolverStatus status, statusLoaded;
+    status.desiredResidualReduction = statusLoaded.desiredResidualReduction = 1e-6;
+    SolverLamg<CSRMatrix>(hierarchy, smoother).solve(x, b, status);
+    SolverLamg<CSRMatrix>(loaded, smoother).solve(xLoaded, b, statusLoaded);
+    EXPECT_TRUE(status.converged);
+    EXPECT_EQ(status.numIters, statusLoaded.numIters);
+    for (index i = 0; i < x.getDimension(); ++i)
+        EXPECT_NEAR(x[i], xLoaded[i], 1e-9);
+
+    // a solver set up with the loaded hierarchy
+    Lamg<CSRMatrix> lamg(1e-6);
+    lamg.setupConnected(loaded);
+    EXPECT_EQ(lamg.getHierarchy().size(), hierarchy.size());
+    Vector result(G.numberOfNodes(), 0.0);
+    lamg.solve(b, result);
+    const CSRMatrix &L = hierarchy.at(0).getLaplacian();
+    EXPECT_LE((L * result - b).length() / b.length(), 1e-6);
+}
+
+TEST_F(LAMGGTest, testSetupDynamicMatrix) {
+    // the generic setup builds the coarse operators of any matrix type
+    Aux::Random::setSeed(42, false);
+    Graph G = BarabasiAlbertGenerator(2, 1000).generate();
+    G.removeMultiEdges();
+    GaussSeidelRelaxation<DynamicMatrix> smoother;
+    LevelHierarchy<DynamicMatrix> hierarchy;
+    MultiLevelSetup<DynamicMatrix>(smoother).setup(G, hierarchy);
+
+    bool hasElimination = false;
+    for (index i = 0; i < hierarchy.size(); ++i) {
+        const DynamicMatrix &L = hierarchy.at(i).getLaplacian();
+        if (i > 0) {
+            hasElimination |= hierarchy.getType(i) == ELIMINATION;
+            EXPECT_LT(L.numberOfRows(), hierarchy.at(i - 1).getNumberOfNodes());
+        }
+        // the coarse operators are Laplacians again
+        for (index u = 0; u < L.numberOfRows(); ++u) {
+            double rowSum = 0;
+            L.forNonZeroElementsInRow(u, [&](index v, double value) {
+                rowSum += value;
+                EXPECT_NEAR(L(v, u), value, 1e-9);
+            });
+            EXPECT_NEAR(rowSum, 0.0, 1e-9);
+        }
+    }
+    EXPECT_TRUE(hasElimination);
+}
+
+TEST_F(LAMGGTest, testLoadInvalidHierarchy) {
+    LevelHierarchy<CSRMatrix> hierarchy;
+    std::stringstream garbage("not a hierarchy");
+    EXPECT_THROW(hierarchy.load(garbage), std::runtime_error);
+
+    Aux::Random::setSeed(42, false);
+    Graph G = BarabasiAlbertGenerator(3, 1000).generate();
+    GaussSeidelRelaxation<CSRMatrix> smoother;
+    MultiLevelSetup<CSRMatrix> setup(smoother);
+    setup.setup(G, hierarchy);
+    std::stringstream stream;
+    hierarchy.save(stream);
+    const std::string data = stream.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+    LevelHierarchy<CSRMatrix> loaded;
+    EXPECT_THROW(loaded.load(truncated), std::runtime_error);
+}
+
 Vector LAMGGTest::randVector(count dimension) const {
     Vector randVector(dimension);
     for (index i = 0; i < dimension; ++i) {
@@ -0,0 +1,204 @@
+/*
+ * BatchApproximatePageRank.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <omp.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/scd/BatchApproximatePageRank.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Scores, residuals and work queue of one thread; only the entries of touched nodes are nonzero
+// between two seeds.
+struct PushState {
+    explicit PushState(count z) : pr(z, 0.0), residual(z, 0.0), isTouched(z, 0) {}
+
+    std::vector<double> pr, residual;
+    std::vector<uint8_t> isTouched;
+    std::vector<node> touched;
+    std::vector<node> queue;
+
+    void touch(node u) {
+        if (!isTouched[u]) {
+            isTouched[u] = 1;
+            touched.push_back(u);
+        }
+    }
+};
+
+} // namespace
+
+BatchApproximatePageRank::BatchApproximatePageRank(const Graph &G, std::vector<node> seeds,
+                                                   double alpha, double epsilon)
+    : G(&G), seeds(std::move(seeds)), alpha(alpha), epsilon(epsilon) {
+    if (alpha <= 0 || alpha > 1)
+        throw std::runtime_error("Alpha must be in (0, 1].");
+    if (epsilon <= 0)
+        throw std::runtime_error("Epsilon must be positive.");
+    for (const node s : this->seeds)
+        if (!G.hasNode(s))
+            throw std::runtime_error("Seed is not a node of the graph.");
+}
+
+void BatchApproximatePageRank::run() {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+
+    std::vector<double> volume(z, 0.0);
+    G->parallelForNodes([&](node u) { volume[u] = G->weightedDegree(u, true); });
+
+    scores.clear();
+    scores.resize(seeds.size());
+    const uint64_t walkSeed = Aux::Random::integer();
+
+    auto push = [&](PushState &state, node u) {
+        const double res = state.residual[u];
+        const double vol = volume[u];
+        if (vol == 0) {
+            // the walk can only stay at u, and the mass of the non-lazy steps is lost
+            state.pr[u] += 2 * alpha * res / (1 + alpha);
+            state.residual[u] = 0;
+            return;
+        }
+
+        state.pr[u] += alpha * res;
+        state.residual[u] = (1 - alpha) * res / 2;
+        G->forNeighborsOf(u, [&](node, const node v, const edgeweight w) {
+            // as in ApproximatePageRank, the mass pushed along self-loops is dropped
+            if (v == u)
+                return;
+            const double mass = (1 - alpha) * res * w / (2 * vol);
+            state.touch(v);
+            const double threshold = epsilon * volume[v];
+            // only enqueue v if its residual crosses the threshold, so it is queued at most once
+            if (state.residual[v] < threshold && state.residual[v] + mass >= threshold)
+                state.queue.push_back(v);
+            state.residual[v] += mass;
+        });
+        if (state.residual[u] >= epsilon * vol)
+            state.queue.push_back(u);
+    };
+
+    // Endpoint of a lazy random walk from u that stops with probability alpha in each step, or
+    // none if the walk leaves through a node without neighbors or along a self-loop (whose mass
+    // the push phase drops as well).
+    auto walk = [&](std::mt19937_64 &urng, node u) -> node {
+        std::uniform_real_distribution<double> real;
+        while (real(urng) >= alpha) {
+            if (real(urng) < 0.5)
+                continue;
+            const double vol = volume[u];
+            if (vol == 0)
+                return none;
+            // self-loops count twice in the volume, so x can also exceed the sum of the weights
+            double x = real(urng) * vol;
+            const count deg = G->degree(u);
+            node next = none;
+            if (!G->isWeighted()) {
+                const auto i = static_cast<index>(x);
+                if (i < deg)
+                    next = G->getIthNeighborWithWeight(unsafe, u, i).first;
+            } else {
+                for (index i = 0; i < deg; ++i) {
+                    const auto [v, w] = G->getIthNeighborWithWeight(unsafe, u, i);
+                    x -= w;
+                    if (x < 0) {
+                        next = v;
+                        break;
+                    }
+                }
+            }
+            if (next == none || next == u)
+                return none;
+            u = next;
+        }
+        return u;
+    };
+
+    std::vector<std::unique_ptr<PushState>> states(omp_get_max_threads());
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index i = 0; i < static_cast<omp_index>(seeds.size()); ++i) {
+        if (!handler.isRunning())
+            continue;
+
+        auto &statePtr = states[omp_get_thread_num()];
+        if (!statePtr)
+            statePtr = std::make_unique<PushState>(z);
+        PushState &state = *statePtr;
+
+        const node s = seeds[i];
+        state.touch(s);
+        state.residual[s] = 1;
+        state.queue.push_back(s);
+        for (index head = 0; head < state.queue.size(); ++head)
+            push(state, state.queue[head]);
+        state.queue.clear();
+
+        if (monteCarloWalks > 0) {
+            double totalResidual = 0;
+            for (const node u : state.touched)
+                totalResidual += state.residual[u];
+
+            if (totalResidual > 0) {
+                auto urng = Aux::Random::streamURNG(walkSeed, i);
+                // walks can add new nodes to touched, so only iterate over the current ones
+                const count numTouched = state.touched.size();
+                for (index j = 0; j < numTouched; ++j) {
+                    const node u = state.touched[j];
+                    const double res = state.residual[u];
+                    if (res <= 0)
+                        continue;
+                    const auto numWalks = static_cast<count>(std::ceil(
+                        res / totalResidual * static_cast<double>(monteCarloWalks)));
+                    const double share = res / static_cast<double>(numWalks);
+                    for (count k = 0; k < numWalks; ++k) {
+                        const node t = walk(urng, u);
+                        if (t != none) {
+                            state.touch(t);
+                            state.pr[t] += share;
+                        }
+                    }
+                }
+            }
+        }
+
+        auto &result = scores[i];
+        for (const node u : state.touched) {
+            if (state.pr[u] > 0)
+                result.emplace_back(u, state.pr[u]);
+            state.pr[u] = 0;
+            state.residual[u] = 0;
+            state.isTouched[u] = 0;
+        }
+        state.touched.clear();
+
+        if (topK > 0) {
+            auto higher = [](const std::pair<node, double> &a, const std::pair<node, double> &b) {
+                return a.second > b.second || (a.second == b.second && a.first < b.first);
+            };
+            if (result.size() > topK) {
+                std::nth_element(result.begin(), result.begin() + topK, result.end(), higher);
+                result.resize(topK);
+                result.shrink_to_fit();
+            }
+            std::sort(result.begin(), result.end(), higher);
+        }
+    }
+
+    handler.assureRunning();
+    hasRun = true;
+}
+
+} /* namespace NetworKit */
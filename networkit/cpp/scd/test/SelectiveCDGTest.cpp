@@ -1,7 +1,11 @@
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <memory>
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/coarsening/ParallelPartitionCoarsening.hpp>
 #include <networkit/community/Conductance.hpp>
 #include <networkit/community/Modularity.hpp>
@@ -11,6 +15,7 @@
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/io/SNAPGraphReader.hpp>
 #include <networkit/scd/ApproximatePageRank.hpp>
+#include <networkit/scd/BatchApproximatePageRank.hpp>
 #include <networkit/scd/CliqueDetect.hpp>
 #include <networkit/scd/CombinedSCD.hpp>
 #include <networkit/scd/GCE.hpp>
@@ -37,6 +42,120 @@ TEST_F(SelectiveCDGTest, testRunApproximatePageRank) {
     const auto prVector = apr.run(0);
 }
 
+TEST_F(SelectiveCDGTest, testBatchApproximatePageRank) {
+    SNAPGraphReader reader;
+    auto G = reader.read("./input/wiki-Vote.txt");
+    const double alpha = 0.4, epsilon = 1e-7;
+
+    std::vector<node> seeds;
+    for (node u = 0; u < 200; u += 7)
+        seeds.push_back(u);
+    seeds.push_back(seeds.front()); // a seed can occur several times
+
+    BatchApproximatePageRank batch(G, seeds, alpha, epsilon);
+    batch.run();
+    ASSERT_EQ(batch.getScores().size(), seeds.size());
+
+    for (index i = 0; i < seeds.size(); ++i) {
+        ApproximatePageRank apr(G, alpha, epsilon);
+        std::map<node, double> expected;
+        for (const auto &[u, score] : apr.run(seeds[i]))
+            if (score > 0)
+                expected[u] = score;
+
+        const auto &result = batch.getScores(i);
+        EXPECT_EQ(result.size(), expected.size());
+        for (const auto &[u, score] : result) {
+            ASSERT_EQ(expected.count(u), 1u);
+            EXPECT_NEAR(score, expected[u], 1e-12);
+        }
+    }
+
+    // top-k truncation keeps the highest scores in decreasing order
+    const count k = 10;
+    BatchApproximatePageRank topK(G, seeds, alpha, epsilon);
+    topK.setTopK(k);
+    topK.run();
+    for (index i = 0; i < seeds.size(); ++i) {
+        auto all = batch.getScores(i);
+        std::sort(all.begin(), all.end(),
+                  [](const auto &a, const auto &b) { return a.second > b.second; });
+        const auto &result = topK.getScores(i);
+        ASSERT_EQ(result.size(), std::min(k, all.size()));
+        for (index j = 0; j < result.size(); ++j) {
+            EXPECT_DOUBLE_EQ(result[j].second, all[j].second);
+            if (j > 0) {
+                EXPECT_GE(result[j - 1].second, result[j].second);
+            }
+        }
+    }
+}
+
+TEST_F(SelectiveCDGTest, testBatchApproximatePageRankSelfLoops) {
+    Aux::Random::setSeed(42, false);
+    Graph G(20, true);
+    for (node u = 0; u < G.numberOfNodes(); ++u) {
+        G.addEdge(u, (u + 1) % G.numberOfNodes(), 1. + Aux::Random::real());
+        if (u % 3 == 0)
+            G.addEdge(u, u, 1. + Aux::Random::real());
+    }
+    const double alpha = 0.2, epsilon = 1e-6;
+    const std::vector<node> seeds{0, 1, 9};
+
+    BatchApproximatePageRank batch(G, seeds, alpha, epsilon);
+    batch.run();
+    for (index i = 0; i < seeds.size(); ++i) {
+        ApproximatePageRank apr(G, alpha, epsilon);
+        std::map<node, double> expected;
+        for (const auto &[u, score] : apr.run(seeds[i]))
+            if (score > 0)
+                expected[u] = score;
+
+        const auto &result = batch.getScores(i);
+        EXPECT_EQ(result.size(), expected.size());
+        for (const auto &[u, score] : result) {
+            ASSERT_EQ(expected.count(u), 1u);
+            EXPECT_NEAR(score, expected[u], 1e-12);
+        }
+    }
+}
+
+TEST_F(SelectiveCDGTest, testBatchApproximatePageRankMonteCarlo) {
+    Aux::Random::setSeed(42, false);
+    SNAPGraphReader reader;
+    auto G = reader.read("./input/wiki-Vote.txt");
+    const double alpha = 0.2;
+    const std::vector<node> seeds{3, 28, 30};
+
+    BatchApproximatePageRank exact(G, seeds, alpha, 1e-10);
+    exact.run();
+    BatchApproximatePageRank push(G, seeds, alpha, 1e-4);
+    push.run();
+    BatchApproximatePageRank hybrid(G, seeds, alpha, 1e-4);
+    hybrid.setMonteCarloWalks(100000);
+    hybrid.run();
+
+    auto l1Error = [&](const std::vector<std::pair<node, double>> &approx, index i) {
+        std::vector<double> diff(G.upperNodeIdBound(), 0);
+        for (const auto &[u, score] : exact.getScores(i))
+            diff[u] += score;
+        for (const auto &[u, score] : approx)
+            diff[u] -= score;
+        double error = 0;
+        for (const double d : diff)
+            error += std::abs(d);
+        return error;
+    };
+
+    for (index i = 0; i < seeds.size(); ++i) {
+        double mass = 0;
+        for (const auto &[u, score] : hybrid.getScores(i))
+            mass += score;
+        EXPECT_NEAR(mass, 1, 1e-6);
+        EXPECT_LT(l1Error(hybrid.getScores(i), i), l1Error(push.getScores(i), i));
+    }
+}
+
 TEST_F(SelectiveCDGTest, testRandomBFS) {
     Aux::Random::setSeed(32, false);
     METISGraphReader reader;
@@ -1737,29 +1737,34 @@ cdef class ReverseBFS(SSSP):
 cdef extern from "<networkit/distance/PrunedLandmarkLabeling.hpp>":
 
 	cdef cppclass _PrunedLandmarkLabeling "NetworKit::PrunedLandmarkLabeling"(_Algorithm):
-		_PrunedLandmarkLabeling(_Graph G) except +
+		_PrunedLandmarkLabeling(_Graph G, count bitParallelRoots) except +
 		count query(node u, node v) except +
+		vector[count] queryBatch(vector[pair[node, node]] pairs) nogil except +
+		void writeIndex(string path) except +
 
 cdef class PrunedLandmarkLabeling(Algorithm):
 	"""
-	PrunedLandmarkLabeling(G)
+	PrunedLandmarkLabeling(G, bitParallelRoots=0)
 
 	Pruned Landmark Labeling algorithm based on the paper "Fast exact shortest-path distance
 	queries on large networks by pruned landmark labeling" from Akiba et al., ACM SIGMOD 2013.
 	The algorithm computes distance labels by performing pruned breadth-first searches from each
 	vertex. Labels are used to quickly retrieve shortest-path distances between node pairs.
-	Note: this algorithm only works for unweighted graphs.
+	The pruned searches run in parallel. Note: this algorithm only works for unweighted graphs.
 
 	Parameters
 	----------
 	G : networkit.Graph
 		The input graph.
+	bitParallelRoots : int, optional
+		Number of bit-parallel searches, each covering a root and up to 64 of its neighbors.
+		Only used for undirected graphs. Default: 0
 	"""
 	cdef Graph _G
 
-	def __cinit__(self, Graph G):
+	def __cinit__(self, Graph G, count bitParallelRoots=0):
 		self._G = G
-		self._this = new _PrunedLandmarkLabeling(G._this)
+		self._this = new _PrunedLandmarkLabeling(G._this, bitParallelRoots)
 
 	def __dealloc__(self):
 		self._G = None
@@ -1784,6 +1789,42 @@ cdef class PrunedLandmarkLabeling(Algorithm):
 		"""
 		return (<_PrunedLandmarkLabeling*>(self._this)).query(u, v)
 
+	def queryBatch(self, vector[pair[node, node]] pairs):
+		"""
+		queryBatch(pairs)
+
+		Returns the shortest-path distances between the given pairs of nodes. The queries
+		are answered in parallel.
+
+		Parameters
+		----------
+		pairs : list(tuple(node, node))
+			Pairs of source and target nodes.
+
+		Returns
+		-------
+		list(int)
+			The shortest-path distance of each pair.
+		"""
+		cdef vector[count] result
+		with nogil:
+			result = (<_PrunedLandmarkLabeling*>(self._this)).queryBatch(pairs)
+		return result
+
+	def writeIndex(self, path):
+		"""
+		writeIndex(path)
+
+		Writes the labels to a file that can be memory-mapped by the C++ class
+		PrunedLandmarkLabelingIndex.
+
+		Parameters
+		----------
+		path : str
+			The output file.
+		"""
+		(<_PrunedLandmarkLabeling*>(self._this)).writeIndex(stdstring(path))
+
 
 cdef extern from "<networkit/distance/DynPrunedLandmarkLabeling.hpp>":
 
@@ -105,3 +105,101 @@ cdef class EdmondsKarp(Algorithm):
 			The flow values of all edges indexed by edge id.
 		"""
 		return (<_EdmondsKarp*>(self._this)).getFlowVector()
+
+cdef extern from "<networkit/flow/PushRelabel.hpp>":
+
+	cdef cppclass _PushRelabel "NetworKit::PushRelabel"(_Algorithm):
+		_PushRelabel(const _Graph &G, vector[node] sources, vector[node] sinks) except +
+		edgeweight getMaxFlow() except +
+		vector[node] getSourceSet() except +
+		edgeweight getFlow(node u, node v) except +
+		edgeweight getFlow(edgeid eid) except +
+		vector[edgeweight] getFlowVector() except +
+
+cdef class PushRelabel(Algorithm):
+	"""
+	PushRelabel(graph, sources, sinks)
+
+	Parallel push-relabel maximum flow algorithm with global relabeling and the gap
+	heuristic. Supports several sources and sinks; edge weights are capacities. Unlike
+	EdmondsKarp, the edges do not need to be indexed unless the flow per edge id is requested.
+
+	Parameters
+	----------
+	graph : networkit.Graph
+		The graph
+	sources : int or list(int)
+		The source node(s) for the flow calculation
+	sinks : int or list(int)
+		The sink node(s) for the flow calculation, disjoint from the sources
+	"""
+	cdef Graph _graph
+
+	def __cinit__(self, Graph graph not None, sources, sinks):
+		self._graph = graph # store reference of graph for memory management, so the graph is not deallocated before this object
+		cdef vector[node] sourceVec = [sources] if isinstance(sources, int) else sources
+		cdef vector[node] sinkVec = [sinks] if isinstance(sinks, int) else sinks
+		self._this = new _PushRelabel(graph._this, sourceVec, sinkVec)
+
+	def getMaxFlow(self):
+		"""
+		getMaxFlow()
+
+		Returns the value of the maximum flow from the sources to the sinks.
+
+		Returns
+		-------
+		float
+			The maximum flow value
+		"""
+		return (<_PushRelabel*>(self._this)).getMaxFlow()
+
+	def getSourceSet(self):
+		"""
+		getSourceSet()
+
+		Returns the set of the nodes on the source side of the flow/minimum cut.
+
+		Returns
+		-------
+		list(int)
+			The set of nodes that form the (smallest) source side of the flow/minimum cut.
+		"""
+		return (<_PushRelabel*>(self._this)).getSourceSet()
+
+	def getFlow(self, node u, node v = none):
+		"""
+		getFlow(u, v = None)
+
+		Get the flow value between two nodes u and v or an edge identified by the edge id u.
+		The variant with an edge id requires indexed edges.
+
+		Parameters
+		----------
+		u : int
+			The first node incident to the edge or the edge id.
+		v : int, optional
+			The second node incident to the edge (optional if edge id is specified). Default: None
+
+		Returns
+		-------
+		float
+			The flow on the specified edge.
+		"""
+		if v == none: # Assume that node and edge ids are the same type
+			return (<_PushRelabel*>(self._this)).getFlow(u)
+		else:
+			return (<_PushRelabel*>(self._this)).getFlow(u, v)
+
+	def getFlowVector(self):
+		"""
+		getFlowVector()
+
+		Return the flow values of all edges. Requires indexed edges.
+
+		Returns
+		-------
+		list(float)
+			The flow values of all edges indexed by edge id.
+		"""
+		return (<_PushRelabel*>(self._this)).getFlowVector()
@@ -128,6 +128,89 @@ cdef class ApproximatePageRank:
 		except TypeError:
 			return self._this.run(<node?>seeds)
 
+cdef extern from "<networkit/scd/BatchApproximatePageRank.hpp>":
+
+	cdef cppclass _BatchApproximatePageRank "NetworKit::BatchApproximatePageRank"(_Algorithm):
+		_BatchApproximatePageRank(_Graph G, vector[node] seeds, double alpha, double epsilon) except +
+		void setTopK(index k) except +
+		void setMonteCarloWalks(index numWalks) except +
+		vector[pair[node, double]] getScores(index i) except +
+		vector[vector[pair[node, double]]] getScores() except +
+
+cdef class BatchApproximatePageRank(Algorithm):
+	"""
+	BatchApproximatePageRank(G, seeds, alpha, epsilon=1e-12)
+
+	Computes approximate PageRank vectors for many seeds in parallel. The vector of each seed
+	is the same as the one computed by ApproximatePageRank. Optionally, the vectors can be
+	truncated to the nodes with the highest scores, and the residual left by the push phase
+	can be distributed by random walks.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		Graph in which the vectors are computed.
+	seeds : list(int)
+		The seed node of each vector.
+	alpha : float
+		Loop probability of random walk.
+	epsilon : float, optional
+		Error tolerance of the push phase. Default: 1e-12
+	"""
+
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, vector[node] seeds, double alpha, double epsilon=1e-12):
+		self._G = G
+		self._this = new _BatchApproximatePageRank(G._this, seeds, alpha, epsilon)
+
+	def setTopK(self, k):
+		"""
+		setTopK(k)
+
+		Keep only the k nodes with the highest scores in each vector; 0 keeps all nodes.
+
+		Parameters
+		----------
+		k : int
+			Number of nodes per vector.
+		"""
+		(<_BatchApproximatePageRank*>(self._this)).setTopK(k)
+
+	def setMonteCarloWalks(self, numWalks):
+		"""
+		setMonteCarloWalks(numWalks)
+
+		Distribute the residual of each vector after the push phase by numWalks random walks
+		in total; 0 disables this phase.
+
+		Parameters
+		----------
+		numWalks : int
+			Number of random walks per vector.
+		"""
+		(<_BatchApproximatePageRank*>(self._this)).setMonteCarloWalks(numWalks)
+
+	def getScores(self, i=None):
+		"""
+		getScores(i=None)
+
+		Returns the vector of the i-th seed, or the vectors of all seeds if i is None.
+
+		Parameters
+		----------
+		i : int, optional
+			Index of the seed.
+
+		Returns
+		-------
+		list(tuple(int, float)) or list(list(tuple(int, float)))
+			Pairs of nodes and scores; sorted by decreasing score if setTopK() was used.
+		"""
+		if i is None:
+			return (<_BatchApproximatePageRank*>(self._this)).getScores()
+		return (<_BatchApproximatePageRank*>(self._this)).getScores(<index?>i)
+
 cdef extern from "<networkit/scd/PageRankNibble.hpp>":
 
 	cdef cppclass _PageRankNibble "NetworKit::PageRankNibble"(_SelectiveCommunityDetector):
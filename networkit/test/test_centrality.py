@@ -77,6 +77,16 @@ class TestCentrality(unittest.TestCase):
 		self.assertAlmostEqual(CLL.centralization(), 1.22, 2)
 		self.assertEqual(CLL.maximum(), 28.0)
 
+	def testBetweennessBatchSize(self):
+		bc = nk.centrality.Betweenness(self.L)
+		default = bc.getBatchSize()
+		bc.setBatchSize(3)
+		self.assertEqual(bc.getBatchSize(), 3)
+		bc.setBatchSize(None)
+		self.assertEqual(bc.getBatchSize(), default)
+		bc.setBatchSize(nk.centrality.none)
+		self.assertEqual(bc.getBatchSize(), default)
+
 	def testCloseness(self):
 		CL = nk.centrality.Closeness(self.L, True, nk.centrality.ClosenessVariant.GENERALIZED)
 		CL.run()